@@ -13,6 +13,7 @@
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteSignalHandler.h"
 #include "Core/AccelByteDataStorageBinaryFile.h"
+#include "Core/Ping/AccelBytePing.h"
 #include "Core/Platform/AccelBytePlatformHandler.h"
 #include "Api/AccelByteGameTelemetryApi.h"
 #include "Api/AccelByteHeartBeatApi.h"
@@ -457,6 +458,7 @@ void FAccelByteUe4SdkModule::OnPreExit()
 	AccelByte::FRegistry::CredentialsRef->Shutdown();
 	AccelByte::FRegistry::HttpRetryScheduler.GetHttpCache().ClearCache();
 	AccelByte::FRegistry::HttpRetryScheduler.Shutdown();
+	FAccelBytePing::ShutdownUdpPinger();
 }
 
 IMPLEMENT_MODULE(FAccelByteUe4SdkModule, AccelByteUe4Sdk)
@@ -534,7 +534,8 @@ namespace IncomingMessage
 
 		if (WebSocket.IsValid() && WebSocket->IsConnected())
 		{
-			WebSocket->Send(FString());
+			// Keeps the connection alive, so it must not wait behind queued messages
+			WebSocket->Send(FString(), EWebSocketSendPriority::High);
 		}
 	}
 
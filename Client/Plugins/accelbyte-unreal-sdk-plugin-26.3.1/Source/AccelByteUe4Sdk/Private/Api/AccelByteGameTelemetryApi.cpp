@@ -4,17 +4,29 @@
 
 #include "Api/AccelByteGameTelemetryApi.h"
 #include "AccelByteUe4SdkModule.h"
+#include "Core/AccelByteDataStorageBinaryFile.h"
 #include "Core/AccelByteSettings.h"
 #include "Core/AccelByteUtilities.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "JsonUtilities.h"
+#include "Misc/Compression.h"
 
 namespace AccelByte
 {
 namespace Api
 {
+
+namespace
+{
+	FString GetEventSpoolDirectory(FString const& TelemetryKey)
+	{
+		// Same location the local data storage writes to, which is the only writable directory on some platforms
+		DataStorageBinaryFile StorageLocation;
+		return StorageLocation.GetAbsoluteFileDirectory().Path / (FAccelByteUtilities::GetCacheFilenameTelemetry() + TEXT("Spool")) / TelemetryKey;
+	}
+}
 	
 GameTelemetry::GameTelemetry(Credentials& InCredentialsRef
 	, Settings const& InSettingsRef
@@ -28,6 +40,15 @@ GameTelemetry::GameTelemetry(Credentials& InCredentialsRef
 	, bRetryOnFailed(bInRetryOnFailed)
 {
 	bCacheEvent = SettingsRef.bEnableGameTelemetryCache;
+
+	int32 MaxEvents = DefaultMaxBatchEvents;
+	int32 MaxBytes = DefaultMaxBatchBytes;
+	bool bCompress = false;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("GameTelemetry"), TEXT("MaxBatchEvents"), MaxEvents);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("GameTelemetry"), TEXT("MaxBatchBytes"), MaxBytes);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("GameTelemetry"), TEXT("bCompressBatches"), bCompress);
+	SetBatchLimits(MaxEvents, MaxBytes);
+	SetBatchCompression(bCompress);
 }
 
 GameTelemetry::~GameTelemetry()
@@ -53,8 +74,11 @@ void GameTelemetry::OnLoginSuccess(FOauth2Token const& Response)
 
 void GameTelemetry::OnLogoutSuccess()
 {
-	EventPtrArrayAccumulation.Empty();
-	EventPtrArray.Empty();
+	FScopeLock ScopeLock(&EventSpoolLock);
+	SpooledEvents.Empty();
+	RecoveredEvents.Empty();
+	EventSpool.Reset();
+	EventSpoolKey.Empty();
 }
 
 void GameTelemetry::SetBatchFrequency(FTimespan Interval)
@@ -68,12 +92,23 @@ void GameTelemetry::SetBatchFrequency(FTimespan Interval)
 		UE_LOG(LogAccelByte, Warning, TEXT("Telemetry schedule interval is too small! Set to %f seconds."), MINIMUM_INTERVAL_TELEMETRY.GetTotalSeconds());
 		TelemetryInterval = MINIMUM_INTERVAL_TELEMETRY;
 	}
-	if (bTelemetryJobStarted)
-	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(GameTelemetryTickDelegateHandle);
-		GameTelemetryTickDelegateHandle.Reset();
-		GameTelemetryTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
-	}
+}
+
+void GameTelemetry::SetBatchLimits(int32 MaxEvents, int32 MaxBytes)
+{
+	MaxBatchEvents = FMath::Max(MaxEvents, 1);
+	MaxBatchBytes = FMath::Max(MaxBytes, 1024);
+}
+
+void GameTelemetry::SetBatchCompression(bool bEnable)
+{
+	bCompressBatches = bEnable;
+}
+
+FAccelByteTelemetryBatchStats GameTelemetry::GetBatchStats() const
+{
+	FScopeLock ScopeLock(&BatchStatsLock);
+	return BatchStats;
 }
 
 void GameTelemetry::SetImmediateEventList(TArray<FString> const& EventNames)
@@ -114,7 +149,7 @@ void GameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody
 	else
 	{
 		TelemetryBodyPtr TelemetryPtr = MakeShared<FAccelByteModelsTelemetryBody, ESPMode::ThreadSafe>(TelemetryBody);
-		JobQueue.Enqueue(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>{ TelemetryPtr, OnSuccess, OnError });
+		EnqueueJob(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>{ TelemetryPtr, OnSuccess, OnError });
 		if (bCacheEvent || CriticalEvents.Contains(TelemetryBody.EventName))
 		{
 			GameTelemetryWPtr GameTelemetryWeak = AsShared();
@@ -130,8 +165,10 @@ void GameTelemetry::Send(FAccelByteModelsTelemetryBody TelemetryBody
 		if (bTelemetryJobStarted == false)
 		{
 			bTelemetryJobStarted = true;
+			LastFlushTime = FPlatformTime::Seconds();
+			// Ticks at the minimum interval so a full queue does not wait for the whole batch interval
 			GameTelemetryTickDelegate = FTickerDelegate::CreateThreadSafeSP(AsShared(), &GameTelemetry::PeriodicTelemetry);
-			GameTelemetryTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(TelemetryInterval.GetTotalSeconds()));
+			GameTelemetryTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(GameTelemetryTickDelegate, static_cast<float>(MINIMUM_INTERVAL_TELEMETRY.GetTotalSeconds()));
 		}
 	}
 }
@@ -140,7 +177,7 @@ void GameTelemetry::Flush()
 {
 	if (bTelemetryJobStarted)
 	{
-		PeriodicTelemetry(0);
+		SendQueuedEvents(MAX_int32);
 	}
 }
 
@@ -182,112 +219,279 @@ bool GameTelemetry::PeriodicTelemetry(float DeltaTime)
 #ifdef ACCELBYTE_ACTIVATE_PROFILER
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(TEXT("AccelBytePeriodicTelemetry"));
 #endif
-	if (!JobQueue.IsEmpty())
+	if (JobQueue.IsEmpty())
+	{
+		return true;
+	}
+
+	const bool bIntervalElapsed = FPlatformTime::Seconds() - LastFlushTime >= TelemetryInterval.GetTotalSeconds();
+	const bool bQueueFull = QueuedEventCount.load() >= MaxBatchEvents;
+	if (bIntervalElapsed || bQueueFull || bFlushBacklog)
+	{
+		SendQueuedEvents(MaxBatchEvents * MaxBatchesPerFlush);
+	}
+	return true;
+}
+
+void GameTelemetry::SendQueuedEvents(int32 MaxEvents)
+{
+	LastFlushTime = FPlatformTime::Seconds();
+	if (JobQueue.IsEmpty())
+	{
+		bFlushBacklog = false;
+		return;
+	}
+
+	FReport::Log(FString(__FUNCTION__));
+
+	TArray<TelemetryBodyPtr> TelemetryBodies;
+	TArray<FVoidHandler> OnSuccessCallbacks;
+	TArray<FErrorHandler> OnErrorCallbacks;
+	TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler> DequeueResult;
+	while (TelemetryBodies.Num() < MaxEvents && JobQueue.Dequeue(DequeueResult))
 	{
-		FReport::Log(FString(__FUNCTION__));
+		QueuedEventCount--;
+		TelemetryBodies.Add(DequeueResult.Get<0>());
+		OnSuccessCallbacks.Add(DequeueResult.Get<1>());
+		OnErrorCallbacks.Add(DequeueResult.Get<2>());
+	}
+	bFlushBacklog = !JobQueue.IsEmpty();
+
+	TArray<FString> Contents;
+	TArray<TArray<int32>> EventIndices;
+	SerializeBatches(TelemetryBodies, Contents, EventIndices);
 
-		TArray<TelemetryBodyPtr> TelemetryBodies;
-		TArray<FVoidHandler> OnSuccessCallbacks;
-		TArray<FErrorHandler> OnErrorCallbacks;
-		while (!JobQueue.IsEmpty())
+	GameTelemetryWPtr GameTelemetryWeak = AsShared();
+	for (int32 BatchIndex = 0; BatchIndex < Contents.Num(); BatchIndex++)
+	{
+		TArray<TelemetryBodyPtr> BatchBodies;
+		TArray<FVoidHandler> BatchOnSuccessCallbacks;
+		TArray<FErrorHandler> BatchOnErrorCallbacks;
+		for (int32 EventIndex : EventIndices[BatchIndex])
 		{
-			TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler> DequeueResult;
-			if (JobQueue.Dequeue(DequeueResult))
-			{
-				TelemetryBodies.Add(DequeueResult.Get<0>());
-				OnSuccessCallbacks.Add(DequeueResult.Get<1>());
-				OnErrorCallbacks.Add(DequeueResult.Get<2>());
-			}
+			BatchBodies.Add(TelemetryBodies[EventIndex]);
+			BatchOnSuccessCallbacks.Add(OnSuccessCallbacks[EventIndex]);
+			BatchOnErrorCallbacks.Add(OnErrorCallbacks[EventIndex]);
 		}
-		GameTelemetryWPtr GameTelemetryWeak = AsShared();
-		SendProtectedEvents(TelemetryBodies
+
+		SendBatch(Contents[BatchIndex]
+			, BatchBodies.Num()
 			, FVoidHandler::CreateLambda(
-				[GameTelemetryWeak, OnSuccessCallbacks, TelemetryBodies]()
+				[GameTelemetryWeak, BatchOnSuccessCallbacks, BatchBodies]()
 				{
-					AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [TelemetryBodies, GameTelemetryWeak]()
+					AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [BatchBodies, GameTelemetryWeak]()
 						{
 							const auto GameTelemetryApi = GameTelemetryWeak.Pin();
 							if (GameTelemetryApi.IsValid())
 							{
-								GameTelemetryApi->RemoveEventsFromCache(TelemetryBodies);
+								GameTelemetryApi->RemoveEventsFromCache(BatchBodies);
 							}
 						});
-					for (auto& OnSuccessCallback : OnSuccessCallbacks)
+					for (auto& OnSuccessCallback : BatchOnSuccessCallbacks)
 					{
 						OnSuccessCallback.ExecuteIfBound();
 					}
 				})
 			, FErrorHandler::CreateLambda(
-				[GameTelemetryWeak, OnSuccessCallbacks, OnErrorCallbacks, TelemetryBodies](int32 Code, FString Message)
+				[GameTelemetryWeak, BatchOnSuccessCallbacks, BatchOnErrorCallbacks, BatchBodies](int32 Code, FString Message)
 				{
 					const auto GameTelemetryApi = GameTelemetryWeak.Pin();
 					if (GameTelemetryApi.IsValid() 
 						&& GameTelemetryApi->bRetryOnFailed 
 						&& Code != (int32)ErrorCodes::StatusUnprocessableEntity)
 					{
-						for (int i = 0; i < TelemetryBodies.Num(); i++)
+						for (int i = 0; i < BatchBodies.Num(); i++)
 						{
-							GameTelemetryApi->JobQueue.Enqueue(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>
+							GameTelemetryApi->EnqueueJob(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>
 							{
-								TelemetryBodies[i],
-									i < OnSuccessCallbacks.Num() ? OnSuccessCallbacks[i] : FVoidHandler{},
-									i < OnErrorCallbacks.Num() ? OnErrorCallbacks[i] : FErrorHandler{}
+								BatchBodies[i],
+									i < BatchOnSuccessCallbacks.Num() ? BatchOnSuccessCallbacks[i] : FVoidHandler{},
+									i < BatchOnErrorCallbacks.Num() ? BatchOnErrorCallbacks[i] : FErrorHandler{}
 							});
 						}
 					}
 					else
 					{
-						for (auto& OnErrorCallback : OnErrorCallbacks)
+						for (auto& OnErrorCallback : BatchOnErrorCallbacks)
 						{
 							OnErrorCallback.ExecuteIfBound(Code, Message);
 						}
 					}
 				}));
 	}
-	return true;
+}
+
+void GameTelemetry::EnqueueJob(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler> const& Job)
+{
+	JobQueue.Enqueue(Job);
+	QueuedEventCount++;
 }
 
 void GameTelemetry::SendProtectedEvents(TArray<TelemetryBodyPtr> const& Events
 	, FVoidHandler const& OnSuccess
 	, FErrorHandler const& OnError)
 {
-
 	FReport::Log(FString(__FUNCTION__));
 
-	const FString Url = FString::Printf(TEXT("%s/v1/protected/events")
-		, *SettingsRef.GameTelemetryServerUrl);
+	TArray<FString> Contents;
+	TArray<TArray<int32>> EventIndices;
+	SerializeBatches(Events, Contents, EventIndices);
+	for (int32 BatchIndex = 0; BatchIndex < Contents.Num(); BatchIndex++)
+	{
+		SendBatch(Contents[BatchIndex], EventIndices[BatchIndex].Num(), OnSuccess, OnError);
+	}
+}
 
-	FString Content = TEXT("");
-	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	for (auto const& Event : Events)
+void GameTelemetry::SerializeBatches(TArray<TelemetryBodyPtr> const& Events
+	, TArray<FString>& OutContents
+	, TArray<TArray<int32>>& OutEventIndices)
+{
+	// Fields shared by every event of this flush
+	const FString ClientTimestamp = FAccelByteUtilities::GetCurrentServerTime().ToIso8601();
+	const FString FlightId = FAccelByteUtilities::GetFlightId();
+	const FString DeviceType = FAccelByteUtilities::GetPlatformName();
+
+	FString Content;
+	TArray<int32> Indices;
+	FString EventJson;
+	for (int32 EventIndex = 0; EventIndex < Events.Num(); EventIndex++)
 	{
-		TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
-		JsonObject->SetStringField("EventNamespace", Event->EventNamespace);
-		JsonObject->SetStringField("EventName", Event->EventName);
-		JsonObject->SetObjectField("Payload", Event->Payload);
-		JsonObject->SetStringField("ClientTimestamp", FAccelByteUtilities::GetCurrentServerTime().ToIso8601());
-		JsonObject->SetStringField("FlightId", FAccelByteUtilities::GetFlightId());
-		JsonObject->SetStringField("DeviceType", FAccelByteUtilities::GetPlatformName());
+		TelemetryBodyPtr const& Event = Events[EventIndex];
+		if (!Event.IsValid())
+		{
+			continue;
+		}
+
+		EventJson.Reset();
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&EventJson);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("EventNamespace"), Event->EventNamespace);
+		Writer->WriteValue(TEXT("EventName"), Event->EventName);
+		if (Event->Payload.IsValid())
+		{
+			const TSharedPtr<FJsonValue> Payload = MakeShared<FJsonValueObject>(Event->Payload);
+			FJsonSerializer::Serialize(Payload, TEXT("Payload"), Writer, false);
+		}
+		else
+		{
+			Writer->WriteObjectStart(TEXT("Payload"));
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteValue(TEXT("ClientTimestamp"), ClientTimestamp);
+		Writer->WriteValue(TEXT("FlightId"), FlightId);
+		Writer->WriteValue(TEXT("DeviceType"), DeviceType);
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		// Sizes are counted in characters, close enough to the UTF-8 body size for a limit
+		const bool bBatchFull = Indices.Num() >= MaxBatchEvents || Content.Len() + EventJson.Len() + 2 > MaxBatchBytes;
+		if (Indices.Num() > 0 && bBatchFull)
+		{
+			Content += TEXT("]");
+			OutContents.Add(MoveTemp(Content));
+			OutEventIndices.Add(MoveTemp(Indices));
+			Content.Reset();
+			Indices.Reset();
+		}
 
-		JsonArray.Add(MakeShared<FJsonValueObject>(JsonObject));
+		Content += Indices.Num() == 0 ? TEXT("[") : TEXT(",");
+		Content += EventJson;
+		Indices.Add(EventIndex);
+	}
+
+	if (Indices.Num() > 0)
+	{
+		Content += TEXT("]");
+		OutContents.Add(MoveTemp(Content));
+		OutEventIndices.Add(MoveTemp(Indices));
 	}
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
-	FJsonSerializer::Serialize(JsonArray, Writer);
+}
+
+void GameTelemetry::SendBatch(FString const& Content
+	, int32 EventCount
+	, FVoidHandler const& OnSuccess
+	, FErrorHandler const& OnError
+	, bool bIsUncompressedResend)
+{
+	const FString Url = FString::Printf(TEXT("%s/v1/protected/events")
+		, *SettingsRef.GameTelemetryServerUrl);
 
 	TMap<FString, FString> Headers;
 	Headers.Add(GHeaderABLogSquelch, TEXT("true"));
 
-	if (ShuttingDown && !bCacheEvent)
+	const bool bFireAndForget = ShuttingDown && !bCacheEvent;
+	if (bFireAndForget && !CredentialsRef->IsSessionValid())
 	{
-		if (CredentialsRef->IsSessionValid())
+		return;
+	}
+
+	FTCHARToUTF8 ContentUtf8(*Content);
+	const int32 UncompressedSize = ContentUtf8.Length();
+
+	TArray<uint8> Compressed;
+	if (!bIsUncompressedResend && bCompressBatches && UncompressedSize >= MinimumCompressionBytes)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, UncompressedSize);
+		Compressed.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, ContentUtf8.Get(), UncompressedSize)
+			&& CompressedSize < UncompressedSize)
+		{
+			Compressed.SetNum(CompressedSize, false);
+		}
+		else
+		{
+			Compressed.Empty();
+		}
+	}
+
+	{
+		FScopeLock ScopeLock(&BatchStatsLock);
+		if (!bIsUncompressedResend)
+		{
+			BatchStats.BatchesSent++;
+			BatchStats.EventsSent += EventCount;
+			BatchStats.UncompressedBytes += UncompressedSize;
+		}
+		BatchStats.SentBytes += Compressed.Num() > 0 ? Compressed.Num() : UncompressedSize;
+		BatchStats.CompressedBatches += Compressed.Num() > 0 ? 1 : 0;
+	}
+
+	if (Compressed.Num() == 0)
+	{
+		if (bFireAndForget)
 		{
 			HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, Headers, FVoidHandler{}, FErrorHandler{});
 		}
+		else
+		{
+			HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, Headers, OnSuccess, OnError);
+		}
+		return;
 	}
-	else
+
+	Headers.Add(TEXT("Content-Type"), TEXT("application/json"));
+	Headers.Add(TEXT("Content-Encoding"), TEXT("gzip"));
+	if (bFireAndForget)
 	{
-		HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, Headers, OnSuccess, OnError);
+		HttpClient.ApiRequest(TEXT("POST"), Url, {}, Compressed, Headers, FVoidHandler{}, FErrorHandler{});
+		return;
 	}
+
+	// A backend that does not accept the encoding gets this batch and the next ones uncompressed
+	GameTelemetryWPtr GameTelemetryWeak = AsShared();
+	HttpClient.ApiRequest(TEXT("POST"), Url, {}, Compressed, Headers, OnSuccess
+		, FErrorHandler::CreateLambda([GameTelemetryWeak, Content, EventCount, OnSuccess, OnError](int32 Code, FString const& Message)
+			{
+				const auto GameTelemetryApi = GameTelemetryWeak.Pin();
+				if (GameTelemetryApi.IsValid() && Code == static_cast<int32>(ErrorCodes::StatusUnsupportedMediaType))
+				{
+					UE_LOG(LogAccelByte, Warning, TEXT("Telemetry backend rejected compressed batches, sending them uncompressed."));
+					GameTelemetryApi->SetBatchCompression(false);
+					GameTelemetryApi->SendBatch(Content, EventCount, OnSuccess, OnError, true);
+					return;
+				}
+				OnError.ExecuteIfBound(Code, Message);
+			}));
 }
 
 //Should be called from async task
@@ -301,6 +505,7 @@ void GameTelemetry::LoadCachedEvents()
 
 	bCacheUpdated = true;
 
+	// Events cached by older versions as a single item are moved to the spool once
 	GameTelemetryWPtr GameTelemetryWeak = AsShared();
 	IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->GetItem(TelemetryKey
 		, THandler<TPair<FString, FString>>::CreateLambda(
@@ -315,152 +520,198 @@ void GameTelemetry::LoadCachedEvents()
 				if (GameTelemetryApi.IsValid()
 					&& GameTelemetryApi->EventsJsonToArray(Pair.Value, EventList))
 				{
-					GameTelemetryApi->SendProtectedEvents(EventList
-						, FVoidHandler::CreateLambda(
-							[GameTelemetryWeak, EventList]()
-							{
-								AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [EventList, GameTelemetryWeak]()
-									{
-										const auto GameTelemetryApi = GameTelemetryWeak.Pin();
-										if (GameTelemetryApi.IsValid())
-										{
-											GameTelemetryApi->RemoveEventsFromCache(EventList);
-										}
-									});
-							})
-						, FErrorHandler::CreateLambda([GameTelemetryWeak, EventList](int32 Code, FString Message)
-							{
-								const auto GameTelemetryApi = GameTelemetryWeak.Pin();
-								if (GameTelemetryApi.IsValid()
-									&& GameTelemetryApi->bRetryOnFailed 
-									&& Code != (int32)ErrorCodes::StatusUnprocessableEntity)
-								{
-									for (int i = 0; i < EventList.Num(); i++)
-									{
-										GameTelemetryApi->JobQueue.Enqueue(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>
-										{ EventList[i], FVoidHandler{}, FErrorHandler{} });
-									}
-								}
-							})
-					);
+					for (auto const& Event : EventList)
+					{
+						GameTelemetryApi->AppendEventToCache(Event);
+					}
+					IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->DeleteItem(Pair.Key
+						, FVoidHandler{}
+						, FAccelByteUtilities::GetCacheFilenameTelemetry());
+					GameTelemetryApi->SendCachedEvents(EventList);
 				}
 			})
 		, FAccelByteUtilities::GetCacheFilenameTelemetry());
-}
 
-//Should be called from async task
-void GameTelemetry::AppendEventToCache(TelemetryBodyPtr Telemetry)
-{
-	FString TelemetryKey = GetTelemetryKey();
-	if (TelemetryKey.IsEmpty())
+	TArray<TelemetryBodyPtr> EventList;
 	{
-		return;
-	}
-	FScopeLock ScopeLock(&EventPtrArrayLock);
-	int AddedIndex = EventPtrArray.Add(Telemetry);
-	
-	//Mimicking GameTelemetry::JobArrayQueueAsJsonString
-	{
-		//Create new array if empty, or open the end of the bracket
-		if (EventPtrArrayAccumulation.IsEmpty())
-		{
-			EventPtrArrayAccumulation += "{\"telemetry\":[";
-		}
-		else
+		FScopeLock ScopeLock(&EventSpoolLock);
+		FAccelByteTelemetrySpool* Spool = GetEventSpool();
+		if (Spool == nullptr)
 		{
-			bool bCharRemoved = false;
-			EventPtrArrayAccumulation.RemoveFromEnd("]}");
-			EventPtrArrayAccumulation += ",";
+			return;
 		}
-	
+
+		TArray<int64> UnreadableEvents;
+		for (auto const& Recovered : RecoveredEvents)
 		{
-			TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
-			JsonObj->SetStringField("EventName", EventPtrArray[AddedIndex]->EventName);
-			JsonObj->SetStringField("EventNamespace", EventPtrArray[AddedIndex]->EventNamespace);
-			JsonObj->SetObjectField("Payload", EventPtrArray[AddedIndex]->Payload);
-			JsonObj->SetNumberField("ClientTimestamp", EventPtrArray[AddedIndex]->ClientTimestamp.ToUnixTimestamp());
-			TSharedRef<FJsonValueObject> JsonValue = MakeShared<FJsonValueObject>(JsonObj);
-			FString WrittenResult{};
-			TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&WrittenResult);
-			if (FJsonSerializer::Serialize(JsonObj, Writer))
+			TSharedPtr<FJsonObject> JsonObj;
+			TelemetryBodyPtr Event;
+			if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Recovered.Payload), JsonObj))
+			{
+				Event = EventFromJsonObject(JsonObj);
+			}
+
+			if (Event.IsValid())
 			{
-				EventPtrArrayAccumulation+=(WrittenResult);
+				SpooledEvents.Add(Event, Recovered.Sequence);
+				EventList.Add(Event);
+			}
+			else
+			{
+				UnreadableEvents.Add(Recovered.Sequence);
 			}
-			EventPtrArrayAccumulation += "]}";
 		}
+		RecoveredEvents.Empty();
+		Spool->Acknowledge(UnreadableEvents);
 	}
 
-	IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->SaveItemOverwiteEntireFile(TelemetryKey
-		, EventPtrArrayAccumulation
-		, THandler<bool>::CreateLambda([](bool IsSuccess){})
-		, FAccelByteUtilities::GetCacheFilenameTelemetry());
+	if (EventList.Num() > 0)
+	{
+		SendCachedEvents(EventList);
+	}
+}
 
-	bCacheUpdated = true;
+void GameTelemetry::SendCachedEvents(TArray<TelemetryBodyPtr> const& Events)
+{
+	TArray<FString> Contents;
+	TArray<TArray<int32>> EventIndices;
+	SerializeBatches(Events, Contents, EventIndices);
+
+	GameTelemetryWPtr GameTelemetryWeak = AsShared();
+	for (int32 BatchIndex = 0; BatchIndex < Contents.Num(); BatchIndex++)
+	{
+		TArray<TelemetryBodyPtr> EventList;
+		for (int32 EventIndex : EventIndices[BatchIndex])
+		{
+			EventList.Add(Events[EventIndex]);
+		}
+
+		SendBatch(Contents[BatchIndex]
+			, EventList.Num()
+			, FVoidHandler::CreateLambda(
+				[GameTelemetryWeak, EventList]()
+				{
+					AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [EventList, GameTelemetryWeak]()
+						{
+							const auto GameTelemetryApi = GameTelemetryWeak.Pin();
+							if (GameTelemetryApi.IsValid())
+							{
+								GameTelemetryApi->RemoveEventsFromCache(EventList);
+							}
+						});
+				})
+			, FErrorHandler::CreateLambda([GameTelemetryWeak, EventList](int32 Code, FString Message)
+				{
+					const auto GameTelemetryApi = GameTelemetryWeak.Pin();
+					if (GameTelemetryApi.IsValid()
+						&& GameTelemetryApi->bRetryOnFailed 
+						&& Code != (int32)ErrorCodes::StatusUnprocessableEntity)
+					{
+						for (int i = 0; i < EventList.Num(); i++)
+						{
+							GameTelemetryApi->EnqueueJob(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>
+							{ EventList[i], FVoidHandler{}, FErrorHandler{} });
+						}
+					}
+				}));
+	}
 }
 
 //Should be called from async task
-void GameTelemetry::RemoveEventsFromCache(TArray<TelemetryBodyPtr> const& Events)
+void GameTelemetry::AppendEventToCache(TelemetryBodyPtr Telemetry)
 {
-	FString TelemetryKey = GetTelemetryKey();
-	if (TelemetryKey.IsEmpty())
+	FString Payload;
+	if (!Telemetry.IsValid() || !EventToJsonString(*Telemetry, Payload))
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&EventSpoolLock);
+	FAccelByteTelemetrySpool* Spool = GetEventSpool();
+	if (Spool == nullptr)
 	{
 		return;
 	}
 
-	if (!bCacheUpdated)
+	const int64 Sequence = Spool->Append(Payload);
+	if (Sequence != INDEX_NONE)
+	{
+		SpooledEvents.Add(Telemetry, Sequence);
+		bCacheUpdated = true;
+	}
+}
+
+//Should be called from async task
+void GameTelemetry::RemoveEventsFromCache(TArray<TelemetryBodyPtr> const& Events)
+{
+	FScopeLock ScopeLock(&EventSpoolLock);
+	if (!EventSpool.IsValid() || SpooledEvents.Num() == 0)
 	{
 		return;
 	}
 
-	if (EventPtrArray.Num() != 0)
+	TArray<int64> Sequences;
+	Sequences.Reserve(Events.Num());
+	for (auto const& Event : Events)
 	{
-		FScopeLock ScopeLock(&EventPtrArrayLock);
-		for (const auto& Event : Events)
+		int64 Sequence = INDEX_NONE;
+		if (SpooledEvents.RemoveAndCopyValue(Event, Sequence))
 		{
-			EventPtrArray.Remove(Event);
+			Sequences.Add(Sequence);
 		}
 	}
-	EventPtrArrayAccumulation.Empty();
-
-	FString TelemetryValues;
-	JobArrayQueueAsJsonString(TelemetryValues);
-	IAccelByteUe4SdkModuleInterface::Get().GetLocalDataStorage()->SaveItem(TelemetryKey
-		, TelemetryValues
-		, THandler<bool>::CreateLambda([](bool IsSuccess) {})
-		, FAccelByteUtilities::GetCacheFilenameTelemetry());
+	EventSpool->Acknowledge(Sequences);
 
 	bCacheUpdated = false;
 }
 
-bool GameTelemetry::JobArrayQueueAsJsonString(FString& OutJsonString)
+FAccelByteTelemetrySpool* GameTelemetry::GetEventSpool()
 {
-	TSharedRef<FJsonObject> TelemetryObj = MakeShared<FJsonObject>();
-	TArray<TSharedPtr<FJsonValue>> EventsObjArray;
-	TArray<TelemetryBodyPtr> TempEventPtrArray;
+	const FString TelemetryKey = GetTelemetryKey();
+	if (TelemetryKey.IsEmpty())
 	{
-		FScopeLock ScopeLock(&EventPtrArrayLock);
-		TempEventPtrArray = EventPtrArray;
+		return nullptr;
 	}
-	for (auto& EventPtr : TempEventPtrArray)
+
+	if (!EventSpool.IsValid() || EventSpoolKey != TelemetryKey)
 	{
-		if (EventPtr.IsValid())
-		{
-			TSharedPtr<FJsonObject> JsonObj = MakeShared<FJsonObject>();
-			JsonObj->SetStringField("EventName", EventPtr->EventName);
-			JsonObj->SetStringField("EventNamespace", EventPtr->EventNamespace);
-			JsonObj->SetObjectField("Payload", EventPtr->Payload);
-			JsonObj->SetNumberField("ClientTimestamp", EventPtr->ClientTimestamp.ToUnixTimestamp());
-			TSharedRef<FJsonValueObject> JsonValue = MakeShared<FJsonValueObject>(JsonObj);
-			EventsObjArray.Add(JsonValue);
-		}
+		int32 MaxSegmentBytes = static_cast<int32>(FAccelByteTelemetrySpool::DefaultMaxSegmentBytes);
+		int32 MaxTotalBytes = static_cast<int32>(FAccelByteTelemetrySpool::DefaultMaxTotalBytes);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("GameTelemetry"), TEXT("SpoolMaxSegmentBytes"), MaxSegmentBytes);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("GameTelemetry"), TEXT("SpoolMaxTotalBytes"), MaxTotalBytes);
+
+		EventSpool = MakeUnique<FAccelByteTelemetrySpool>(GetEventSpoolDirectory(TelemetryKey), MaxSegmentBytes, MaxTotalBytes);
+		EventSpoolKey = TelemetryKey;
+		SpooledEvents.Empty();
+		RecoveredEvents = EventSpool->Open();
 	}
-	TelemetryObj->SetArrayField("telemetry", EventsObjArray);
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJsonString);
-	if (!FJsonSerializer::Serialize(TelemetryObj, Writer))
+	return EventSpool.Get();
+}
+
+bool GameTelemetry::EventToJsonString(FAccelByteModelsTelemetryBody const& Event, FString& OutJsonString)
+{
+	TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
+	JsonObj->SetStringField("EventName", Event.EventName);
+	JsonObj->SetStringField("EventNamespace", Event.EventNamespace);
+	JsonObj->SetObjectField("Payload", Event.Payload);
+	JsonObj->SetNumberField("ClientTimestamp", Event.ClientTimestamp.ToUnixTimestamp());
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonString);
+	return FJsonSerializer::Serialize(JsonObj, Writer);
+}
+
+TelemetryBodyPtr GameTelemetry::EventFromJsonObject(TSharedPtr<FJsonObject> const& JsonObj)
+{
+	if (!JsonObj.IsValid())
 	{
-		return false;
+		return nullptr;
 	}
-	return true;
+
+	FAccelByteModelsTelemetryBody TelemetryBody;
+	TelemetryBody.EventName = JsonObj->GetStringField(TEXT("EventName"));
+	TelemetryBody.EventNamespace = JsonObj->GetStringField(TEXT("EventNamespace"));
+	TelemetryBody.Payload = JsonObj->GetObjectField(TEXT("Payload"));
+	TelemetryBody.ClientTimestamp = FDateTime::FromUnixTimestamp(JsonObj->GetIntegerField(TEXT("ClientTimestamp")));
+	return MakeShared<FAccelByteModelsTelemetryBody, ESPMode::ThreadSafe>(TelemetryBody);
 }
 
 const FString GameTelemetry::GetEventNamespace()
@@ -495,17 +746,11 @@ bool GameTelemetry::EventsJsonToArray(FString& InJsonString
 
 	for (auto& ArrayItem : *ArrayValue)
 	{
-		auto& JsonObj = ArrayItem->AsObject();
-		FString EventName;
-		TSharedPtr<FJsonObject> const* Payload = nullptr;
-		int32 ClientTimestamp = 0;
-		FAccelByteModelsTelemetryBody TelemetryBody;
-		TelemetryBody.EventName = JsonObj->GetStringField(TEXT("EventName"));
-		TelemetryBody.EventNamespace = JsonObj->GetStringField(TEXT("EventNamespace"));
-		TelemetryBody.Payload = JsonObj->GetObjectField(TEXT("Payload"));
-		ClientTimestamp = JsonObj->GetIntegerField(TEXT("ClientTimestamp"));
-		TelemetryBody.ClientTimestamp = FDateTime::FromUnixTimestamp(ClientTimestamp);
-		OutArray.Add(MakeShared<FAccelByteModelsTelemetryBody, ESPMode::ThreadSafe>(TelemetryBody));
+		TelemetryBodyPtr TelemetryBody = EventFromJsonObject(ArrayItem->AsObject());
+		if (TelemetryBody.IsValid())
+		{
+			OutArray.Add(TelemetryBody);
+		}
 	}
 	return true;
 }
@@ -457,6 +457,47 @@ namespace Api
 
 #undef FORM_STRING_ENUM_PAIR
 
+FLobbyMessageTypeId Lobby::IdentifyMessageType(FString const& MessageType)
+{
+	// FName comparison is case insensitive, same as the FString keys of the maps it is built from
+	static const TMap<FName, FLobbyMessageTypeId> MessageTypeTable = []()
+	{
+		TMap<FName, FLobbyMessageTypeId> Table;
+		Table.Reserve(ResponseStringEnumMap.Num() + NotifStringEnumMap.Num() + 1);
+		for (TPair<FString, Response> const& Pair : ResponseStringEnumMap)
+		{
+			Table.Add(FName(*Pair.Key), FLobbyMessageTypeId{ELobbyMessageKind::Response, Pair.Value});
+		}
+		for (TPair<FString, Notif> const& Pair : NotifStringEnumMap)
+		{
+			Table.Add(FName(*Pair.Key), FLobbyMessageTypeId{ELobbyMessageKind::Notif, Pair.Value});
+		}
+		Table.Add(FName(*LobbyResponse::SessionNotif), FLobbyMessageTypeId{ELobbyMessageKind::SessionNotif, 0});
+		return Table;
+	}();
+
+	// FNAME_Find does not add unknown types to the name table
+	const FName MessageTypeName(*MessageType, FNAME_Find);
+	if (!MessageTypeName.IsNone())
+	{
+		if (const FLobbyMessageTypeId* TypeId = MessageTypeTable.Find(MessageTypeName))
+		{
+			return *TypeId;
+		}
+	}
+
+	FLobbyMessageTypeId TypeId;
+	if (MessageType.Contains(Suffix::Response))
+	{
+		TypeId.Kind = ELobbyMessageKind::Response;
+	}
+	else if (MessageType.Contains(Suffix::Notif))
+	{
+		TypeId.Kind = ELobbyMessageKind::Notif;
+	}
+	return TypeId;
+}
+
 void Lobby::Connect(FString const& Token)
 {
 	FReport::Log(FString(__FUNCTION__));
@@ -528,7 +569,8 @@ void Lobby::SendPing()
 
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
-		WebSocket->Send(FString());
+		// Keeps the connection alive, so it must not wait behind queued requests
+		WebSocket->Send(FString(), EWebSocketSendPriority::High);
 	}
 }
 
@@ -776,9 +818,25 @@ FString Lobby::SendSetPresenceStatus(EAvailability Availability
 		return "";
 	}
 	FString CopyActivity = MessageParser::EscapeString(Activity);
-	SEND_RAW_REQUEST_CACHED_RESPONSE_RETURNED(SetUserPresence
-		, Presence
-		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *CopyActivity))
+
+	// Only the latest presence matters, a newer one replaces a presence still waiting in the outbound queue
+	EWebSocketSendResult SendResult = EWebSocketSendResult::Sent;
+	const FString MessageId = SendRawRequest(LobbyRequest::SetUserPresence
+		, Prefix::Presence
+		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *CopyActivity)
+		, FName(*LobbyRequest::SetUserPresence)
+		, &SendResult);
+	if (!MessageId.IsEmpty())
+	{
+		if (SendResult == EWebSocketSendResult::Coalesced)
+		{
+			// The replaced request will never be answered
+			ID_RESPONSE_MAP(SetUserPresence).Remove(QueuedSetUserPresenceMessageId);
+		}
+		QueuedSetUserPresenceMessageId = MessageId;
+		ID_RESPONSE_MAP(SetUserPresence).Emplace(MessageId, MESSAGE_SUCCESS_HANDLER(SetUserPresence));
+	}
+	return MessageId;
 }
 
 FString Lobby::SendGetOnlineUsersRequest()
@@ -1863,30 +1921,77 @@ void AccelByte::Api::Lobby::OnTokenReceived(FString const& Token)
 
 bool Lobby::Tick(float DeltaTime)
 {
+	{
+		// Buffered notifications are only sent with an access token, they are kept until there is one again
+		FScopeLock Lock(&NotificationBufferLock);
+		if (!CredentialsRef->GetAccessToken().IsEmpty() && NotificationBuffer.ShouldRelease())
+		{
+			UE_LOG(LogAccelByteLobby, Warning, TEXT("Timed out waiting for missing notification(s), sending buffered notification(s)"));
+			SendBufferedNotifications();
+		}
+	}
+
 	if(NotificationQueue.IsEmpty())
 	{
 		return true;
 	}
 
+	const double StartTime = FPlatformTime::Seconds();
+	int32 Dispatched = 0;
+	double DispatchSeconds = 0.0;
+	double MaxDispatchSeconds = 0.0;
+
 	FHandleLobbyMessageData Message;
-	if(!NotificationQueue.Dequeue(Message))
+	while (Dispatched < NotificationDrainMaxMessages)
 	{
-		if(NotificationQueue.IsLocked())
-    	{
-    		UE_LOG(LogAccelByteLobby, VeryVerbose, TEXT("Notification queue is locked, not broadcasting notification"));
-    	}
-		else
+		if(!NotificationQueue.Dequeue(Message))
 		{
-			UE_LOG(LogAccelByteLobby, VeryVerbose, TEXT("Failed to dequeue notification, not broadcasting notification"));
+			if(NotificationQueue.IsLocked())
+			{
+				UE_LOG(LogAccelByteLobby, VeryVerbose, TEXT("Notification queue is locked, not broadcasting notification"));
+			}
+			else if (Dispatched == 0)
+			{
+				UE_LOG(LogAccelByteLobby, VeryVerbose, TEXT("Failed to dequeue notification, not broadcasting notification"));
+			}
+			break;
+		}
+
+		const double MessageStartTime = FPlatformTime::Seconds();
+		DispatchQueuedNotification(Message);
+		const double MessageEndTime = FPlatformTime::Seconds();
+
+		Dispatched++;
+		DispatchSeconds += MessageEndTime - MessageStartTime;
+		MaxDispatchSeconds = FMath::Max(MaxDispatchSeconds, MessageEndTime - MessageStartTime);
+
+		if (NotificationDrainMaxSeconds > 0.0 && MessageEndTime - StartTime >= NotificationDrainMaxSeconds)
+		{
+			break;
 		}
-		return true;
 	}
 
+	FScopeLock Lock(&NotificationDrainStatsLock);
+	NotificationDrainStats.BacklogDepth = NotificationQueue.Num();
+	if (Dispatched > 0)
+	{
+		NotificationDrainStats.LastTickDispatched = Dispatched;
+		NotificationDrainStats.TotalDispatched += Dispatched;
+		TotalDispatchSeconds += DispatchSeconds;
+		NotificationDrainStats.AverageDispatchSeconds = TotalDispatchSeconds / NotificationDrainStats.TotalDispatched;
+		NotificationDrainStats.MaxDispatchSeconds = FMath::Max(NotificationDrainStats.MaxDispatchSeconds, MaxDispatchSeconds);
+	}
+
+	return true;
+}
+
+void Lobby::DispatchQueuedNotification(FHandleLobbyMessageData const& Message)
+{
 	switch (Message.Type)
 	{
 		case EHandleLobbyMessageDataType::Other:
 			{
-				HandleMessageNotif(Message.MessageType, Message.ParsedJsonString, Message.ParsedJsonObject, Message.bSkipConditioner);
+				HandleMessageNotif(static_cast<Notif>(Message.MessageTypeId.Value), Message.MessageType, Message.ParsedJsonString, Message.ParsedJsonObject, Message.bSkipConditioner);
 				break;
 			}
 		case EHandleLobbyMessageDataType::V2Matchmaking:
@@ -1905,27 +2010,24 @@ bool Lobby::Tick(float DeltaTime)
 				break;
 			};
 	}
-	
-	return true;
 }
 
 void Lobby::HandleLobbyMessageByType(FHandleLobbyMessageData const& MessageData)
 {
-	if (MessageData.MessageType.Equals(LobbyResponse::SessionNotif))
+	switch (MessageData.MessageTypeId.Kind)
 	{
-		HandleV2SessionNotif(MessageData.ParsedJsonString, MessageData.bSkipConditioner);
-	}
-	else if (MessageData.MessageType.Contains(Suffix::Response))
-	{
-		HandleMessageResponse(MessageData.MessageType, MessageData.ParsedJsonString, MessageData.ParsedJsonObject, nullptr);
-	}
-	else if (MessageData.MessageType.Contains(Suffix::Notif))
-	{
-		HandleMessageNotif(MessageData.MessageType, MessageData.ParsedJsonString, MessageData.ParsedJsonObject, MessageData.bSkipConditioner);
-	}
-	else // undefined; not Response nor Notif
-	{
-		ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse message. Neither a response nor a notif type. %s, Raw: %s"), *MessageData.MessageType, *MessageData.ParsedJsonString));
+		case ELobbyMessageKind::SessionNotif:
+			HandleV2SessionNotif(MessageData.ParsedJsonString, MessageData.bSkipConditioner);
+			break;
+		case ELobbyMessageKind::Response:
+			HandleMessageResponse(static_cast<Response>(MessageData.MessageTypeId.Value), MessageData.MessageType, MessageData.ParsedJsonString, MessageData.ParsedJsonObject, nullptr);
+			break;
+		case ELobbyMessageKind::Notif:
+			HandleMessageNotif(static_cast<Notif>(MessageData.MessageTypeId.Value), MessageData.MessageType, MessageData.ParsedJsonString, MessageData.ParsedJsonObject, MessageData.bSkipConditioner);
+			break;
+		default: // undefined; not Response nor Notif
+			ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse message. Neither a response nor a notif type. %s, Raw: %s"), *MessageData.MessageType, *MessageData.ParsedJsonString));
+			break;
 	}
 }
 
@@ -1934,6 +2036,21 @@ TSharedPtr<FAccelByteKey> Lobby::LockNotifications()
 	return NotificationQueue.LockQueue();
 }
 
+void Lobby::SetNotificationDrainBudget(int32 MaxMessages, double MaxSeconds)
+{
+	NotificationDrainMaxMessages = FMath::Max(MaxMessages, 1);
+	NotificationDrainMaxSeconds = MaxSeconds;
+}
+
+FAccelByteLobbyNotificationDrainStats Lobby::GetNotificationDrainStats() const
+{
+	FScopeLock Lock(&NotificationDrainStatsLock);
+	FAccelByteLobbyNotificationDrainStats Stats = NotificationDrainStats;
+	Stats.BacklogHighWaterMark = NotificationQueue.GetHighWaterMark();
+	Stats.DroppedNotifications = NotificationQueue.GetDroppedCount();
+	return Stats;
+}
+
 FAccelByteTaskWPtr Lobby::GetNotifications(THandler<FAccelByteModelsGetUserNotificationsResponse> const& OnSuccess
 	, FErrorHandler const& OnError
 	, FDateTime const& StartTime
@@ -2308,10 +2425,46 @@ void Lobby::OnMassiveOutage(FMassiveOutageInfo const& MassiveOutageInfo)
 {
 	MassiveOutage.Broadcast(MassiveOutageInfo);
 }
+
+void Lobby::OnSendDropped(TArray<FString> const& Messages)
+{
+	const FString IdPrefix = TEXT("id: ");
+	for (FString const& Message : Messages)
+	{
+		TArray<FString> Lines;
+		Message.ParseIntoArrayLines(Lines);
+		const FString* IdLine = Lines.FindByPredicate([&IdPrefix](FString const& Line)
+			{
+				return Line.StartsWith(IdPrefix, ESearchCase::CaseSensitive);
+			});
+		if (IdLine == nullptr)
+		{
+			continue;
+		}
+
+		// A dropped request is never answered, fail it instead of leaving its response pending
+		const FString MessageId = IdLine->Mid(IdPrefix.Len());
+		if (ID_RESPONSE_MAP(SetUserPresence).Remove(MessageId) > 0)
+		{
+			if (QueuedSetUserPresenceMessageId == MessageId)
+			{
+				QueuedSetUserPresenceMessageId.Reset();
+			}
+			MESSAGE_ERROR_HANDLER(SetUserPresence).ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError)
+				, TEXT("Set presence request dropped, the lobby connection was set up again before it was sent."));
+		}
+		else
+		{
+			UE_LOG(LogAccelByteLobby, Warning, TEXT("Request %s was dropped before it was sent"), *MessageId);
+		}
+	}
+}
 	
 FString Lobby::SendRawRequest(FString const& MessageType
 	, FString const& MessageIDPrefix
-	, FString const& CustomPayload)
+	, FString const& CustomPayload
+	, FName CoalesceKey
+	, EWebSocketSendResult* OutSendResult)
 {
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
@@ -2321,7 +2474,11 @@ FString Lobby::SendRawRequest(FString const& MessageType
 		{
 			Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
 		}
-		WebSocket->Send(Content);
+		const EWebSocketSendResult SendResult = WebSocket->Send(Content, EWebSocketSendPriority::Normal, CoalesceKey);
+		if (OutSendResult != nullptr)
+		{
+			*OutSendResult = SendResult;
+		}
 		UE_LOG(LogAccelByteLobby, Verbose, TEXT("Sending request: %s"), *Content);
 		return MessageID;
 	}
@@ -2375,59 +2532,91 @@ void Lobby::CreateWebSocket(FString const& Token)
 	WebSocket->OnConnectionClosed().AddThreadSafeSP(AsShared(), &Lobby::OnClosed);
 	WebSocket->OnReconnectAttempt().AddThreadSafeSP(AsShared(), &Lobby::OnReconnectAttempt);
 	WebSocket->OnMassiveOutage().AddThreadSafeSP(AsShared(), &Lobby::OnMassiveOutage);
+	WebSocket->OnSendDropped().AddThreadSafeSP(AsShared(), &Lobby::OnSendDropped);
 }
 
 FString Lobby::LobbyMessageToJson(FString const& Message)
 {
+	// Tokenized in place: lines and values are null terminated inside a single copy of the message, so the value
+	// parsers can run on them directly without allocating a string per line.
+	TArray<TCHAR> Buffer;
+	Buffer.Reserve(Message.Len() + 1);
+	Buffer.Append(*Message, Message.Len());
+	Buffer.Add(TEXT('\0'));
+
+	FString JsonString;
+	JsonString.Reserve(Message.Len() + Message.Len() / 4 + 16);
+	JsonString.AppendChar(TEXT('{'));
+
 	bool bFirst = true;
-	FString JsonString = TEXT("{");
-	TArray<FString> Lines;
-	Message.ParseIntoArray(Lines, TEXT("\n"), true);
-	for (const auto& Line : Lines)
+	TCHAR* LineStart = Buffer.GetData();
+	while (*LineStart)
 	{
-		FString Name;
-		FString Value;
+		TCHAR* LineEnd = LineStart;
+		while (*LineEnd && *LineEnd != TEXT('\n')) ++LineEnd;
+		TCHAR* NextLine = *LineEnd ? LineEnd + 1 : LineEnd;
+		*LineEnd = TEXT('\0');
+
+		// empty lines are skipped
+		if (LineEnd == LineStart)
+		{
+			LineStart = NextLine;
+			continue;
+		}
+
 		if (bFirst)
 		{
 			bFirst = false;
 		}
 		else
 		{
-			JsonString.Append(",");
+			JsonString.AppendChar(TEXT(','));
 		}
-		Line.Split(": ", &Name, &Value);
-		JsonString.Appendf(TEXT("\"%s\":"), *Name);
 
-		Value.TrimStartAndEndInline();
+		TCHAR* Separator = LineStart;
+		while (*Separator && !(Separator[0] == TEXT(':') && Separator[1] == TEXT(' '))) ++Separator;
 
-		const TCHAR* Cursor = GetData(Value);
+		// a line without separator has no name and no value
+		const bool bHasSeparator = *Separator != TEXT('\0');
+		JsonString.AppendChar(TEXT('"'));
+		if (bHasSeparator)
+		{
+			JsonString.AppendChars(LineStart, static_cast<int32>(Separator - LineStart));
+		}
+		JsonString.Append(TEXT("\":"));
 
-		if (Cursor == nullptr)
+		TCHAR* Cursor = bHasSeparator ? Separator + 2 : LineEnd;
+		if (Cursor == LineEnd)
 		{
-			JsonString.Append("null");
+			JsonString.Append(TEXT("null"));
+			LineStart = NextLine;
 			continue;
 		}
-		
-		// make sure it's null terminated
-		checkf(*(Cursor + Value.Len()) == 0, TEXT("Invalid value: '%s' length: %d"), *Value, Value.Len());
 
+		// trim the value
+		while (*Cursor && FChar::IsWhitespace(*Cursor)) ++Cursor;
+		TCHAR* ValueEnd = LineEnd;
+		while (ValueEnd > Cursor && FChar::IsWhitespace(ValueEnd[-1])) --ValueEnd;
+		*ValueEnd = TEXT('\0');
+
+		const TCHAR* Value = Cursor;
 		// Array
-		if (*Cursor == '[')
+		if (*Value == '[')
 		{
-			++Cursor;
+			++Value;
 			// skip spaces
-			while (*Cursor && *Cursor == ' ') ++Cursor;
+			while (*Value && *Value == ' ') ++Value;
 			bool bWasArrayParsed;
 			FString JsonArrayString;
 			// array of JSON object
-			if (*Cursor == '{')
+			if (*Value == '{')
 			{
-				bWasArrayParsed = MessageParser::ParseArrayOfObject(Cursor, JsonArrayString);
+				bWasArrayParsed = MessageParser::ParseArrayOfObject(Value, JsonArrayString);
 			}
 			// array of string
 			else
 			{
-				bWasArrayParsed = MessageParser::ParseArrayOfString(Cursor, JsonArrayString);
+				bWasArrayParsed = MessageParser::ParseArrayOfString(Value, JsonArrayString);
 			}
 			
 			if (bWasArrayParsed)
@@ -2438,38 +2627,47 @@ FString Lobby::LobbyMessageToJson(FString const& Message)
 			{
 				// if the array was not parsed, set to empty array
 				JsonString.Append("[]");
-				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid array for field '%s', set to empty array"), *Name);
+				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid array for field '%s', set to empty array")
+					, *FString(static_cast<int32>(Separator - LineStart), LineStart));
 			}
 		}
 		// JSON
-		else if (*Cursor == '{')
+		else if (*Value == '{')
 		{
-			FString ObjectString;
 			// only append valid object
-			if (MessageParser::ParseObject(Cursor, ObjectString))
-			{
-				JsonString.Append(ObjectString);
-			}
-			else
+			const int32 ObjectStart = JsonString.Len();
+			if (!MessageParser::ParseObject(Value, JsonString))
 			{
+				JsonString.LeftInline(ObjectStart);
 				JsonString.Append("{}");
-				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid object for field '%s', set to empty object"), *Name);
+				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid object for field '%s', set to empty object")
+					, *FString(static_cast<int32>(Separator - LineStart), LineStart));
 			}
 		}
 		// JSON string
-		else if (Value.StartsWith("\"") && Value.EndsWith("\""))
+		else if (*Value == '"' && ValueEnd[-1] == '"')
 		{
-			MessageParser::ParseString(Cursor, JsonString);
+			MessageParser::ParseString(Value, JsonString);
 		}
 		// everything else
 		else 
 		{
-			FString Escaped = MessageParser::EscapeString(Value, true);
-			JsonString.Append(Escaped);
+			JsonString.AppendChar(TEXT('"'));
+			for (; *Value; ++Value)
+			{
+				if (*Value == '\\' || *Value == '"')
+				{
+					JsonString.AppendChar(TEXT('\\'));
+				}
+				JsonString.AppendChar(*Value);
+			}
+			JsonString.AppendChar(TEXT('"'));
 		}
+
+		LineStart = NextLine;
 	}
 
-	JsonString += TEXT("}");
+	JsonString.AppendChar(TEXT('}'));
 	return JsonString;
 }
 
@@ -2576,6 +2774,17 @@ void Lobby::HandleMessageResponse(FString const& ReceivedMessageType
 	, FString const& ParsedJsonString
 	, TSharedPtr<FJsonObject> const& ParsedJsonObj
 	, TSharedPtr<FLobbyMessageMetaData> const& MessageMeta = nullptr)
+{
+	const FLobbyMessageTypeId TypeId = IdentifyMessageType(ReceivedMessageType);
+	const Response ResponseEnum = TypeId.Kind == ELobbyMessageKind::Response ? static_cast<Response>(TypeId.Value) : Response::Invalid_Response;
+	HandleMessageResponse(ResponseEnum, ReceivedMessageType, ParsedJsonString, ParsedJsonObj, MessageMeta);
+}
+
+void Lobby::HandleMessageResponse(Response ResponseEnum
+	, FString const& ReceivedMessageType
+	, FString const& ParsedJsonString
+	, TSharedPtr<FJsonObject> const& ParsedJsonObj
+	, TSharedPtr<FLobbyMessageMetaData> const& MessageMeta)
 {
 	int lobbyResponseCode{0};
 	FString ReceivedMessageId{};
@@ -2591,13 +2800,6 @@ void Lobby::HandleMessageResponse(FString const& ReceivedMessageType
 		ReceivedMessageId = ParsedJsonObj->GetStringField(TEXT("id"));
 	}
 
-	Response ResponseEnum = Response::Invalid_Response;
-	Response* ResponseEnumPointer = ResponseStringEnumMap.Find(ReceivedMessageType);
-	if (ResponseEnumPointer)
-	{
-		ResponseEnum = *ResponseEnumPointer;
-	}
-
 	switch (ResponseEnum)
 	{
 		// Party
@@ -3008,12 +3210,17 @@ void Lobby::HandleMessageNotif(FString const& ReceivedMessageType
 	, TSharedPtr<FJsonObject> const& ParsedJsonObj
 	, bool bSkipConditioner)
 {
-	Notif NotifEnum = Notif::Invalid_Notif;
-	if (const Notif* NotifEnumPointer = NotifStringEnumMap.Find(ReceivedMessageType))
-	{
-		NotifEnum = *NotifEnumPointer;
-	}
+	const FLobbyMessageTypeId TypeId = IdentifyMessageType(ReceivedMessageType);
+	const Notif NotifEnum = TypeId.Kind == ELobbyMessageKind::Notif ? static_cast<Notif>(TypeId.Value) : Notif::Invalid_Notif;
+	HandleMessageNotif(NotifEnum, ReceivedMessageType, ParsedJsonString, ParsedJsonObj, bSkipConditioner);
+}
 
+void Lobby::HandleMessageNotif(Notif NotifEnum
+	, FString const& ReceivedMessageType
+	, FString const& ParsedJsonString
+	, TSharedPtr<FJsonObject> const& ParsedJsonObj
+	, bool bSkipConditioner)
+{
 	switch (NotifEnum)
 	{
 		// Party
@@ -3305,8 +3512,7 @@ void Lobby::SendBufferedNotifications()
 		return;
 	}
 
-	TArray<FAccelByteModelsUserNotification> BufferedNotifications = NotificationBuffer.GetSortedBuffer();
-	NotificationBuffer.Clear();
+	TArray<FAccelByteModelsUserNotification> BufferedNotifications = NotificationBuffer.TakeSortedBuffer();
 
 	// send all buffered data sequentially
 	for (const FAccelByteModelsUserNotification& Notification : BufferedNotifications)
@@ -3351,6 +3557,11 @@ bool Lobby::TryBufferNotification(FString const& ParsedJsonString)
 	if (NotificationBuffer.IsBuffering())
 	{
 		NotificationBuffer.TryAddBuffer(ReceivedNotification);
+		if (!CredentialsRef->GetAccessToken().IsEmpty() && NotificationBuffer.ShouldRelease())
+		{
+			UE_LOG(LogAccelByteLobby, Warning, TEXT("Notification buffer reached its limit, sending buffered notification(s) without waiting for the missing one(s)"));
+			SendBufferedNotifications();
+		}
 		return true;
 	}
 
@@ -3362,8 +3573,10 @@ bool Lobby::TryBufferNotification(FString const& ParsedJsonString)
 		UE_LOG(LogAccelByteLobby, Warning, TEXT("Missing notification(s) detected, received: %s"), *ParsedJsonString);
 
 		// get missing notification from the time last valid (still in order) received notification up to the most recent received notification
-		GetNotifications(THandler<FAccelByteModelsGetUserNotificationsResponse>::CreateThreadSafeSP(AsShared(), &Lobby::OnGetMissingNotificationSuccess)
-			,FErrorHandler::CreateThreadSafeSP(AsShared(), &Lobby::OnGetMissingNotificationError));
+		// Tagged with the episode, a response arriving after this episode was released must not feed the next one
+		const uint32 BufferingEpisode = NotificationBuffer.GetBufferingEpisode();
+		GetNotifications(THandler<FAccelByteModelsGetUserNotificationsResponse>::CreateThreadSafeSP(AsShared(), &Lobby::OnGetMissingNotificationSuccess, BufferingEpisode)
+			,FErrorHandler::CreateThreadSafeSP(AsShared(), &Lobby::OnGetMissingNotificationError, BufferingEpisode));
 
 		return true;
 	}
@@ -3371,16 +3584,28 @@ bool Lobby::TryBufferNotification(FString const& ParsedJsonString)
 	return false;
 }
 
-void Lobby::OnGetMissingNotificationSuccess(const FAccelByteModelsGetUserNotificationsResponse& MissingNotifications)
+void Lobby::OnGetMissingNotificationSuccess(const FAccelByteModelsGetUserNotificationsResponse& MissingNotifications, uint32 BufferingEpisode)
 {
 	FScopeLock Lock(&NotificationBufferLock);
+	if (!NotificationBuffer.IsBuffering() || NotificationBuffer.GetBufferingEpisode() != BufferingEpisode)
+	{
+		UE_LOG(LogAccelByteLobby, Log, TEXT("Ignoring missing notification(s) of a buffer already released"));
+		return;
+	}
+
 	UE_LOG(LogAccelByteLobby, Log, TEXT("Missing notification(s) found"));
 	NotificationBuffer.AddMissingNotifications(MissingNotifications.Notifications);
 	SendBufferedNotifications();
 }
 
-void Lobby::OnGetMissingNotificationError(int32 ErrorCode, FString const& ErrorMessage)
+void Lobby::OnGetMissingNotificationError(int32 ErrorCode, FString const& ErrorMessage, uint32 BufferingEpisode)
 {
+	FScopeLock Lock(&NotificationBufferLock);
+	if (!NotificationBuffer.IsBuffering() || NotificationBuffer.GetBufferingEpisode() != BufferingEpisode)
+	{
+		return;
+	}
+
 	// In case of failed retrieving notification via REST API just send anything we have in the buffer
 	UE_LOG(LogAccelByteLobby, Warning, TEXT("Missing notification(s) not found"));
 	SendBufferedNotifications();
@@ -3422,7 +3647,7 @@ void Lobby::OnMessage(FString const& Message, bool bSkipConditioner /* = false *
 		MetaData->Code = FString::FromInt(static_cast<int>(ErrorCodes::JsonDeserializationFailed));
 
 		// handle error message if message type is response. if notif then ignore.
-		if (MetaData->Type.Contains(Suffix::Response))
+		if (IdentifyMessageType(MetaData->Type).Kind == ELobbyMessageKind::Response)
 		{
 			HandleMessageResponse(MetaData->Type, ParsedJsonString, ParsedJsonObj, MetaData);
 		}
@@ -3449,11 +3674,12 @@ void Lobby::OnMessage(FString const& Message, bool bSkipConditioner /* = false *
 	FHandleLobbyMessageData MessageData;
 	MessageData.bSkipConditioner = bSkipConditioner;
 	MessageData.MessageType = ReceivedMessageType;
+	MessageData.MessageTypeId = IdentifyMessageType(ReceivedMessageType);
 	MessageData.ParsedJsonString = ParsedJsonString;
 	MessageData.ParsedJsonObject = ParsedJsonObj;
 	MessageData.Type = EHandleLobbyMessageDataType::Other;
 
-	if (ReceivedMessageType.Equals(LobbyResponse::ConnectedNotif))
+	if (MessageData.MessageTypeId.Kind == ELobbyMessageKind::Notif && MessageData.MessageTypeId.Value == Notif::ConnectedNotif)
 	{
 		if (TryBufferNotification(ParsedJsonString))
 		{
@@ -3704,7 +3930,30 @@ void Lobby::Startup()
 	if (!bIsStarted)
 	{
 		InitializeMessaging();
-		LobbyTickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateThreadSafeSP(AsShared(), &Lobby::Tick), LobbyTickPeriod);
+		IdentifyMessageType(LobbyResponse::ConnectedNotif); // builds the message type table
+
+		int32 MaxMessages = DefaultNotificationDrainMaxMessages;
+		int32 BudgetMicroseconds = DefaultNotificationDrainBudgetMicroseconds;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("Lobby"), TEXT("NotificationDrainMaxMessages"), MaxMessages);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("Lobby"), TEXT("NotificationDrainBudgetMicroseconds"), BudgetMicroseconds);
+		SetNotificationDrainBudget(MaxMessages, BudgetMicroseconds / 1000000.0);
+
+		// Unbounded by default, a capacity makes the oldest notifications give way to the new ones
+		int32 QueueCapacity = 0;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("Lobby"), TEXT("NotificationQueueCapacity"), QueueCapacity);
+		NotificationQueue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::DropOldest, QueueCapacity);
+
+		int32 MaxBufferedNotifications = DefaultMaxBufferedNotifications;
+		int32 BufferGapTimeoutSeconds = DefaultNotificationBufferGapTimeoutSeconds;
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("Lobby"), TEXT("NotificationBufferMaxSize"), MaxBufferedNotifications);
+		FAccelByteUtilities::LoadABConfigFallback(TEXT("Lobby"), TEXT("NotificationBufferGapTimeoutSeconds"), BufferGapTimeoutSeconds);
+		{
+			FScopeLock Lock(&NotificationBufferLock);
+			NotificationBuffer.SetLimits(MaxBufferedNotifications, BufferGapTimeoutSeconds);
+		}
+
+		// Ticks every frame, returns immediately when no notification is queued.
+		LobbyTickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateThreadSafeSP(AsShared(), &Lobby::Tick));
 		bIsStarted = true;
 	}
 }
@@ -7,6 +7,7 @@
 #include "Networking.h"
 #include "Api/AccelByteQosManagerApi.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteUtilities.h"
 #include "Core/Ping/AccelBytePing.h"
 
 namespace AccelByte
@@ -16,6 +17,11 @@ namespace Api
 FAccelByteModelsQosServerList Qos::QosServers = {};
 TArray<TPair<FString, float>> Qos::Latencies = {};
 TMap<FString, TSharedPtr<FInternetAddr>> Qos::ResolvedAddresses = {};
+TMap<FString, FAccelByteLatencyEstimator> Qos::LatencyEstimators = {};
+int32 Qos::LatencyWindowSize = FAccelByteLatencyEstimator::DefaultWindowSize;
+int32 Qos::MaxLatencyPollBackoff = 4;
+int32 Qos::LatencyPollBackoff = 1;
+int32 Qos::LatencyPollRoundsToSkip = 0;
 FDelegateHandleAlias Qos::PollLatenciesHandle;
 FDelegateHandleAlias Qos::PollServerLatenciesHandle;
 
@@ -37,6 +43,11 @@ Qos::Qos(Credentials& InCredentialsRef
 		LobbyConnectedDelegateHandle = MessagingSystemPtr->SubscribeToTopic(EAccelByteMessagingTopic::LobbyConnected, OnLobbyConnectedHandle);
 	}
 
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("Qos"), TEXT("LatencyWindowSize"), LatencyWindowSize);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("Qos"), TEXT("LatencyPollMaxBackoff"), MaxLatencyPollBackoff);
+	LatencyWindowSize = FMath::Max(LatencyWindowSize, 1);
+	MaxLatencyPollBackoff = FMath::Max(MaxLatencyPollBackoff, 1);
+
 	QosUpdateCheckerTickerDelegate = FTickerDelegate::CreateRaw(this, &Qos::CheckQosUpdate);
 	QosUpdateCheckerHandle = FTickerAlias::GetCoreTicker().AddTicker(QosUpdateCheckerTickerDelegate, QosUpdateCheckerIntervalSecs);
 }
@@ -91,9 +102,20 @@ void Qos::CallGetQosServers(const bool bPingRegionsOnSuccess
 		{
 			Qos::QosServers = Result; // Cache for the session
 
+			TSet<FString> Regions;
 			for (FAccelByteModelsQosServer& Server : Qos::QosServers.Servers)
 			{
 				ResolveQosServerAddress(Server);
+				Regions.Add(Server.Region);
+			}
+
+			// Forget the regions that are not served anymore
+			for (auto It = LatencyEstimators.CreateIterator(); It; ++It)
+			{
+				if (!Regions.Contains(It.Key()))
+				{
+					It.RemoveCurrent();
+				}
 			}
 
 			if (bPingRegionsOnSuccess)
@@ -136,10 +158,18 @@ void Qos::PingRegionsSetLatencies(const FAccelByteModelsQosServerList& QosServer
 			FAccelBytePing::SendUdpPing(Server.ResolvedIp, Server.Port, FRegistry::Settings.QosPingTimeout, FPingCompleteDelegate::CreateLambda(
 				[Count, SuccessLatencies, FailedLatencies, Region, OnSuccess, OnError, this](const FPingResult& PingResult)
 				{
-					if (PingResult.Status == FPingResultStatus::Success)
+					// A round where every ping timed out still completes successfully, but has no latency to report
+					const bool bReceived = PingResult.Status == FPingResultStatus::Success && PingResult.Received > 0;
+					float PingDelay = PingResult.AverageRoundTrip * 1000; // convert to milliseconds
+
+					FAccelByteLatencyEstimator& Estimator = FindOrAddLatencyEstimator(Region);
+					Estimator.AddRound(PingDelay, PingResult.Sent, bReceived ? PingResult.Received : 0);
+
+					// A region that answered recently keeps its smoothed latency through a few lost rounds, the loss shows
+					// in its stats and keeps it from being stable. Once it stops answering altogether it is reported failed.
+					if (bReceived || (PingResult.Sent > 0 && Estimator.HasRecentLatency()))
 					{
-						float PingDelay = PingResult.AverageRoundTrip * 1000; // convert to milliseconds
-						SuccessLatencies->Add(TPair<FString, float>(Region, PingDelay));
+						SuccessLatencies->Add(TPair<FString, float>(Region, Estimator.GetLatency()));
 					}
 					else
 					{
@@ -149,6 +179,13 @@ void Qos::PingRegionsSetLatencies(const FAccelByteModelsQosServerList& QosServer
 					int TotalLatencies = SuccessLatencies->Num() + FailedLatencies->Num();
 					if (Count == TotalLatencies)
 					{
+						bool bStable = FailedLatencies->Num() == 0;
+						for (const auto& Latency : *SuccessLatencies)
+						{
+							bStable &= FindOrAddLatencyEstimator(Latency.Key).IsStable();
+						}
+						UpdateLatencyPollBackoff(bStable);
+
 						Qos::Latencies.Empty();
 						Qos::Latencies.Append(*SuccessLatencies);
 
@@ -185,6 +222,9 @@ void Qos::InitGetLatenciesScheduler(float LatencyPollIntervalSecs)
 		return;
 	}
 
+	LatencyPollBackoff = 1;
+	LatencyPollRoundsToSkip = 0;
+
 	// Active (>0): ensure min value to prevent flooding
 	const float AdjustedSecondsPerTick = LatencyPollIntervalSecs < Settings::MinNumSecsQosLatencyPolling
 		? Settings::MinNumSecsQosLatencyPolling
@@ -196,6 +236,14 @@ void Qos::InitGetLatenciesScheduler(float LatencyPollIntervalSecs)
 	Qos::PollLatenciesHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
 		[this](float DeltaTime)
 		{
+			// Stable regions are probed less often, see UpdateLatencyPollBackoff()
+			if (LatencyPollRoundsToSkip > 0)
+			{
+				LatencyPollRoundsToSkip--;
+				return true;
+			}
+
+			LatencyPollRoundsToSkip = LatencyPollBackoff - 1;
 			PingRegionsSetLatencies(Qos::QosServers, nullptr, nullptr);
 			return true;
 			
@@ -255,6 +303,7 @@ void Qos::StopLatencyPollers()
 	RemoveFromTicker(Qos::PollLatenciesHandle);
 	RemoveFromTicker(Qos::PollServerLatenciesHandle);
 	Qos::Latencies.Empty();
+	Qos::LatencyEstimators.Empty();
 }
 
 bool Qos::AreLatencyPollersActive()
@@ -267,6 +316,64 @@ const TArray<TPair<FString, float>>& Qos::GetCachedLatencies()
 	return Qos::Latencies;
 }
 
+TArray<FAccelByteModelsQosRegionLatencyStats> Qos::GetCachedLatencyStats() const
+{
+	TArray<FAccelByteModelsQosRegionLatencyStats> Stats;
+	Stats.Reserve(LatencyEstimators.Num());
+	for (const auto& Estimator : LatencyEstimators)
+	{
+		Stats.Add(ToLatencyStats(Estimator.Key, Estimator.Value));
+	}
+	return Stats;
+}
+
+bool Qos::GetCachedLatencyStats(FString const& Region, FAccelByteModelsQosRegionLatencyStats& OutStats) const
+{
+	const FAccelByteLatencyEstimator* Estimator = LatencyEstimators.Find(Region);
+	if (Estimator == nullptr)
+	{
+		return false;
+	}
+
+	OutStats = ToLatencyStats(Region, *Estimator);
+	return true;
+}
+
+void Qos::UpdateLatencyPollBackoff(bool bStable)
+{
+	if (bStable)
+	{
+		LatencyPollBackoff = FMath::Min(LatencyPollBackoff * 2, MaxLatencyPollBackoff);
+	}
+	else
+	{
+		LatencyPollBackoff = 1;
+		LatencyPollRoundsToSkip = 0;
+	}
+}
+
+FAccelByteLatencyEstimator& Qos::FindOrAddLatencyEstimator(FString const& Region)
+{
+	if (FAccelByteLatencyEstimator* Estimator = LatencyEstimators.Find(Region))
+	{
+		return *Estimator;
+	}
+	return LatencyEstimators.Add(Region, FAccelByteLatencyEstimator(LatencyWindowSize));
+}
+
+FAccelByteModelsQosRegionLatencyStats Qos::ToLatencyStats(FString const& Region, FAccelByteLatencyEstimator const& Estimator)
+{
+	FAccelByteModelsQosRegionLatencyStats Stats;
+	Stats.Region = Region;
+	Stats.Latency = Estimator.GetLatency();
+	Stats.LatencyP95 = Estimator.GetLatencyP95();
+	Stats.Jitter = Estimator.GetJitter();
+	Stats.PacketLoss = Estimator.GetPacketLoss();
+	Stats.RoundCount = Estimator.GetRoundCount();
+	Stats.bStable = Estimator.IsStable();
+	return Stats;
+}
+
 void Qos::SendQosLatenciesMessage()
 {
 	if (Latencies.Num() <= 0)
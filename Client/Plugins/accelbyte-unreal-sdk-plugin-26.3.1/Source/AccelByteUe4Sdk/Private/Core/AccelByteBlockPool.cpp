@@ -0,0 +1,225 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteBlockPool.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteBlockPool);
+
+namespace AccelByte
+{
+namespace Core
+{
+
+FAccelByteBlockPool::FAccelByteBlockPool(size_t PoolSize)
+{
+	const int32 NumSlabs = FMath::Max(1, static_cast<int32>((PoolSize + SlabSize - 1) / SlabSize));
+	Memory = static_cast<uint8*>(FMemory::Malloc(NumSlabs * SlabSize, BlockAlignment));
+
+	Slabs.SetNum(NumSlabs);
+	for (int32 i = NumSlabs - 1; i >= 0; i--)
+	{
+		Slabs[i].NextFreeSlab = FirstFreeSlab;
+		FirstFreeSlab = i;
+	}
+
+	Stats.ReservedBytes = NumSlabs * SlabSize;
+	Stats.TotalSlabs = NumSlabs;
+	Stats.FreeSlabs = NumSlabs;
+}
+
+FAccelByteBlockPool::~FAccelByteBlockPool()
+{
+	if (Stats.UsedBlocks > 0)
+	{
+		UE_LOG(LogAccelByteBlockPool, Warning, TEXT("Block pool destroyed with %d blocks still in use"), Stats.UsedBlocks);
+	}
+	FMemory::Free(Memory);
+	Memory = nullptr;
+}
+
+int32 FAccelByteBlockPool::GetSizeClass(size_t Size)
+{
+	int32 SizeClass = 0;
+	while (SizeClass < NumSizeClasses && GetBlockSize(SizeClass) < Size)
+	{
+		SizeClass++;
+	}
+	return SizeClass < NumSizeClasses ? SizeClass : INDEX_NONE;
+}
+
+int32 FAccelByteBlockPool::GetSlabIndex(const void* Block) const
+{
+	return static_cast<int32>((static_cast<const uint8*>(Block) - Memory) / SlabSize);
+}
+
+bool FAccelByteBlockPool::Owns(const void* Block) const
+{
+	const uint8* Byte = static_cast<const uint8*>(Block);
+	return Byte >= Memory && Byte < Memory + Stats.ReservedBytes;
+}
+
+int32 FAccelByteBlockPool::TakeFreeSlab()
+{
+	const int32 SlabIndex = FirstFreeSlab;
+	if (SlabIndex != INDEX_NONE)
+	{
+		FirstFreeSlab = Slabs[SlabIndex].NextFreeSlab;
+		Slabs[SlabIndex].NextFreeSlab = INDEX_NONE;
+		Stats.FreeSlabs--;
+	}
+	return SlabIndex;
+}
+
+void FAccelByteBlockPool::ReleaseSlab(int32 SlabIndex)
+{
+	FSlab& Slab = Slabs[SlabIndex];
+	Slab.SizeClass = INDEX_NONE;
+	Slab.UsedBlocks = 0;
+	Slab.NextFreeSlab = FirstFreeSlab;
+	FirstFreeSlab = SlabIndex;
+	Stats.FreeSlabs++;
+}
+
+void* FAccelByteBlockPool::Allocate(size_t Size)
+{
+	const int32 SizeClassIndex = GetSizeClass(FMath::Max<size_t>(Size, 1));
+
+	FScopeLock ScopeLock(&Lock);
+
+	if (SizeClassIndex == INDEX_NONE || Memory == nullptr)
+	{
+		Stats.FailedAllocations++;
+		return nullptr;
+	}
+
+	FSizeClass& SizeClass = SizeClasses[SizeClassIndex];
+	const size_t BlockSize = GetBlockSize(SizeClassIndex);
+	void* Block = nullptr;
+
+	if (SizeClass.FreeList != nullptr)
+	{
+		Block = SizeClass.FreeList;
+		SizeClass.FreeList = SizeClass.FreeList->Next;
+	}
+	else
+	{
+		if (SizeClass.BumpSlab == INDEX_NONE || SizeClass.BumpOffset + BlockSize > SlabSize)
+		{
+			SizeClass.BumpSlab = TakeFreeSlab();
+			SizeClass.BumpOffset = 0;
+			if (SizeClass.BumpSlab == INDEX_NONE)
+			{
+				Stats.FailedAllocations++;
+				return nullptr;
+			}
+			Slabs[SizeClass.BumpSlab].SizeClass = SizeClassIndex;
+		}
+
+		Block = Memory + SizeClass.BumpSlab * SlabSize + SizeClass.BumpOffset;
+		SizeClass.BumpOffset += BlockSize;
+	}
+
+	Slabs[GetSlabIndex(Block)].UsedBlocks++;
+
+	Stats.UsedBlocks++;
+	Stats.UsedBytes += BlockSize;
+	Stats.HighWaterUsedBlocks = FMath::Max(Stats.HighWaterUsedBlocks, Stats.UsedBlocks);
+	Stats.HighWaterUsedBytes = FMath::Max(Stats.HighWaterUsedBytes, Stats.UsedBytes);
+
+	return Block;
+}
+
+void FAccelByteBlockPool::Free(void* Block)
+{
+	if (Block == nullptr)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	if (!Owns(Block))
+	{
+		UE_LOG(LogAccelByteBlockPool, Warning, TEXT("Trying to free a block that does not belong to the pool"));
+		return;
+	}
+
+	FSlab& Slab = Slabs[GetSlabIndex(Block)];
+	check(Slab.SizeClass != INDEX_NONE && Slab.UsedBlocks > 0);
+
+	FFreeBlock* FreeBlock = static_cast<FFreeBlock*>(Block);
+	FreeBlock->Next = SizeClasses[Slab.SizeClass].FreeList;
+	SizeClasses[Slab.SizeClass].FreeList = FreeBlock;
+
+	Slab.UsedBlocks--;
+	Stats.UsedBlocks--;
+	Stats.UsedBytes -= GetBlockSize(Slab.SizeClass);
+}
+
+int32 FAccelByteBlockPool::Defragment()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<bool> Reclaimed;
+	Reclaimed.Init(false, Slabs.Num());
+	int32 NumReclaimed = 0;
+
+	for (int32 SlabIndex = 0; SlabIndex < Slabs.Num(); SlabIndex++)
+	{
+		if (Slabs[SlabIndex].SizeClass != INDEX_NONE && Slabs[SlabIndex].UsedBlocks == 0)
+		{
+			Reclaimed[SlabIndex] = true;
+			NumReclaimed++;
+		}
+	}
+
+	if (NumReclaimed == 0)
+	{
+		return 0;
+	}
+
+	// Drop the free blocks that live in reclaimed slabs, the rest keep their order.
+	for (FSizeClass& SizeClass : SizeClasses)
+	{
+		FFreeBlock** Link = &SizeClass.FreeList;
+		while (*Link != nullptr)
+		{
+			if (Reclaimed[GetSlabIndex(*Link)])
+			{
+				*Link = (*Link)->Next;
+			}
+			else
+			{
+				Link = &(*Link)->Next;
+			}
+		}
+
+		if (SizeClass.BumpSlab != INDEX_NONE && Reclaimed[SizeClass.BumpSlab])
+		{
+			SizeClass.BumpSlab = INDEX_NONE;
+			SizeClass.BumpOffset = 0;
+		}
+	}
+
+	for (int32 SlabIndex = 0; SlabIndex < Slabs.Num(); SlabIndex++)
+	{
+		if (Reclaimed[SlabIndex])
+		{
+			ReleaseSlab(SlabIndex);
+		}
+	}
+
+	UE_LOG(LogAccelByteBlockPool, Verbose, TEXT("Block pool reclaimed %d free slabs"), NumReclaimed);
+	return NumReclaimed;
+}
+
+FAccelByteBlockPoolStats FAccelByteBlockPool::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+}
+}
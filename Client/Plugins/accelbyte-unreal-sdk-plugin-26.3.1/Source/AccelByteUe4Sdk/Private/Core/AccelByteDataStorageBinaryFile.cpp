@@ -7,6 +7,9 @@
 #include "JsonUtilities.h"
 #include "Misc/FileHelper.h"
 #include "Containers/UnrealString.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeLock.h"
 #if PLATFORM_SWITCH
 #include "SwitchFileSystem.h"
 #include "SwitchPathManager.h"
@@ -17,6 +20,39 @@ DEFINE_LOG_CATEGORY(LogAccelByteDataStorageBinaryFile);
 
 namespace AccelByte
 {
+namespace
+{
+	constexpr uint32 BinaryFileMagic = 0x564B4241; // "ABKV"
+	constexpr uint32 BinaryFileVersion = 1;
+	constexpr int32 BinaryFileHeaderSize = sizeof(uint32) * 2;
+	/** Files smaller than this are never compacted, dead records cost less than the rewrite. */
+	constexpr int64 MinCompactionFileSize = 64 * 1024;
+
+	template<typename TValue>
+	void AppendValue(TArray<uint8>& Out, const TValue& Value)
+	{
+		Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(TValue));
+	}
+
+	template<typename TValue>
+	bool ReadValue(const TArray<uint8>& In, int64& Offset, TValue& Out)
+	{
+		if (Offset + static_cast<int64>(sizeof(TValue)) > In.Num())
+		{
+			return false;
+		}
+		FMemory::Memcpy(&Out, In.GetData() + Offset, sizeof(TValue));
+		Offset += sizeof(TValue);
+		return true;
+	}
+
+	void AppendHeader(TArray<uint8>& Out)
+	{
+		AppendValue(Out, BinaryFileMagic);
+		AppendValue(Out, BinaryFileVersion);
+	}
+}
+
 DataStorageBinaryFile::DataStorageBinaryFile(FString DirectoryPath)
 {
 	FDirectoryPath DirPath;
@@ -32,9 +68,9 @@ DataStorageBinaryFile::DataStorageBinaryFile(FString DirectoryPath)
 
 void DataStorageBinaryFile::Reset(const THandler<bool>& Result, const FString & FileName)
 {
-	auto Value = TArray<uint8>();
-	FString Path = CompleteAbsoluteFilePath(FileName);
-	Result.ExecuteIfBound(FFileHelper::SaveArrayToFile(Value, *Path));
+	FScopeLock Lock(&StorageLock);
+	FStorageFile& File = StorageFiles.FindOrAdd(FileName);
+	Result.ExecuteIfBound(WriteSnapshot(FileName, {}, File));
 }
 
 FString DataStorageBinaryFile::FABBinaryFileStructureToString(FABBinaryFileStructure* Structure)
@@ -56,57 +92,30 @@ FString DataStorageBinaryFile::FABBinaryFileStructureToString(FABBinaryFileStruc
 
 void DataStorageBinaryFile::DeleteItem(const FString & Key, const FVoidHandler OnDone, const FString & FileName)
 {
-	auto StructurePtr = ParseStructureFromFile(FileName);
-	if (StructurePtr == nullptr)
 	{
-		OnDone.ExecuteIfBound();
-	}
-
-	auto Index = StructurePtr->IndexOfByPredicate([&](FBinaryContentIndependentSegment Segment) { return Segment.Key == Key; });
-	if (Index < 0)
-	{
-		OnDone.ExecuteIfBound();
-		return;
+		FScopeLock Lock(&StorageLock);
+		FStorageFile& File = OpenStorageFile(FileName);
+		if (File.Index.Contains(Key))
+		{
+			AppendRecord(FileName, File, ERecordType::Delete, Key, {});
+		}
 	}
-	StructurePtr->RemoveAt(Index);
-
-	FString SerializedText = FABBinaryFileStructureToString(StructurePtr.Get());
-	
-	TArray<uint8> ByteArray = FAccelByteArrayByteFStringConverter::FStringToBytes(SerializedText);
-
-	FString Path = CompleteAbsoluteFilePath(FileName);
-	FFileHelper::SaveArrayToFile(ByteArray, *Path);
 	OnDone.ExecuteIfBound();
 }
 
 //Specific for telemery optimization
 void DataStorageBinaryFile::SaveItemOverwiteEntireFile(FString Key, FString Item, const THandler<bool>& OnDone, const FString& FileName)
 {
-	TArray<uint8> ContentByteArray = FAccelByteArrayByteFStringConverter::FStringToBytes(Item);
-
-	FABBinaryFileStructure FileCacheStructure = FABBinaryFileStructure();
-	FileCacheStructure.Add({ Key, ContentByteArray });
+	TArray<TPair<FString, TArray<uint8>>> Items;
+	Items.Emplace(Key, FAccelByteArrayByteFStringConverter::FStringToBytes(Item));
 
-	FString SerializedText{};
+	bool bSuccess = false;
 	{
-		//Manual serialization
-		FString ArrayByteAsString{};
-		for (int i = 0; i < ContentByteArray.Num(); i++)
-		{
-			ArrayByteAsString += FString::Printf(TEXT("%d"), ContentByteArray[i]);
-			if (i < ContentByteArray.Num() - 1)
-			{
-				ArrayByteAsString += ",";
-			}
-		}
-		SerializedText = FString::Printf(TEXT("{\"Key\": \"%s\", \"ArrayByte\": [%s]}"), *Key, *ArrayByteAsString);
+		FScopeLock Lock(&StorageLock);
+		FStorageFile& File = StorageFiles.FindOrAdd(FileName);
+		bSuccess = WriteSnapshot(FileName, Items, File);
 	}
 
-	TArray<uint8> FileByteArray = FAccelByteArrayByteFStringConverter::FStringToBytes(SerializedText);
-
-	FString Path = CompleteAbsoluteFilePath(FileName);
-	bool bSuccess = FFileHelper::SaveArrayToFile(FileByteArray, *Path);
-
 	OnDone.ExecuteIfBound(bSuccess);
 }
 
@@ -138,16 +147,16 @@ void DataStorageBinaryFile::GetItem(const FString & Key, const THandler<TPair<FS
 {
 	TPair<FString, TArray<uint8>> Result;
 
-	auto StructurePtr = ParseStructureFromFile(FileName);
-	if (StructurePtr == nullptr)
+	TArray<uint8> Value;
+	bool bFound = false;
 	{
-		OnDone.Execute(Result);
+		FScopeLock Lock(&StorageLock);
+		bFound = ReadRecordValue(FileName, OpenStorageFile(FileName), Key, Value);
 	}
 
-	auto ValuePtr = StructurePtr->FindByPredicate([&](FBinaryContentIndependentSegment Segment) { return Segment.Key == Key; });
-	if (ValuePtr != nullptr && ValuePtr->ArrayByte.Num() > 0)
+	if (bFound && Value.Num() > 0)
 	{
-		Result.Value = TArray<uint8>(ValuePtr->ArrayByte);
+		Result.Value = MoveTemp(Value);
 		Result.Key = Key;
 	}
 	OnDone.Execute(Result);
@@ -157,16 +166,16 @@ void DataStorageBinaryFile::GetItem(const FString & Key, const THandler<TPair<FS
 {
 	TPair<FString, FString> Result;
 
-	auto StructurePtr = ParseStructureFromFile(FileName);
-	if (StructurePtr == nullptr)
+	TArray<uint8> Value;
+	bool bFound = false;
 	{
-		OnDone.Execute(Result);
+		FScopeLock Lock(&StorageLock);
+		bFound = ReadRecordValue(FileName, OpenStorageFile(FileName), Key, Value);
 	}
 
-	auto ValuePtr = StructurePtr->FindByPredicate([&](FBinaryContentIndependentSegment Segment) { return Segment.Key == Key; });
-	if (ValuePtr != nullptr && ValuePtr->ArrayByte.Num() > 0)
+	if (bFound && Value.Num() > 0)
 	{
-		Result.Value = FAccelByteArrayByteFStringConverter::BytesToFString(ValuePtr->ArrayByte, false);
+		Result.Value = FAccelByteArrayByteFStringConverter::BytesToFString(Value, false);
 		Result.Key = Key;
 	}
 	OnDone.Execute(Result);
@@ -176,20 +185,18 @@ void DataStorageBinaryFile::GetItem(const FString & Key, const THandler<TPair<FS
 {
 	TPair<FString, FJsonObjectWrapper> Result;
 
-	auto StructurePtr = ParseStructureFromFile(FileName);
-	if (StructurePtr == nullptr)
+	TArray<uint8> Value;
+	bool bFound = false;
 	{
-		OnDone.Execute(Result);
+		FScopeLock Lock(&StorageLock);
+		bFound = ReadRecordValue(FileName, OpenStorageFile(FileName), Key, Value);
 	}
 
-	auto ValuePtr = StructurePtr->FindByPredicate([&](FBinaryContentIndependentSegment Segment) { return Segment.Key == Key; });
-	if (ValuePtr != nullptr && ValuePtr->ArrayByte.Num() > 0)
+	if (bFound && Value.Num() > 0)
 	{
-		FString Value = FAccelByteArrayByteFStringConverter::BytesToFString(ValuePtr->ArrayByte, false);
-		Result.Value.JsonObjectFromString(Value);
+		Result.Value.JsonObjectFromString(FAccelByteArrayByteFStringConverter::BytesToFString(Value, false));
 		Result.Key = Key;
 	}
-
 	OnDone.Execute(Result);
 }
 
@@ -238,34 +245,295 @@ TOptional<FString> DataStorageBinaryFile::LoadFromFile(const FString& FileName)
 
 bool DataStorageBinaryFile::SaveToFile(const FString& FileName, const FString& Key, const TArray<uint8>& Value)
 {
-	auto StructurePtr = ParseStructureFromFile(FileName);
+	FScopeLock Lock(&StorageLock);
+	return AppendRecord(FileName, OpenStorageFile(FileName), ERecordType::Put, Key, Value);
+}
+
+bool DataStorageBinaryFile::IsBinaryFormat(const TArray<uint8>& Content)
+{
+	int64 Offset = 0;
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	return ReadValue(Content, Offset, Magic) && ReadValue(Content, Offset, Version)
+		&& Magic == BinaryFileMagic && Version == BinaryFileVersion;
+}
+
+void DataStorageBinaryFile::SerializeRecord(ERecordType Type, const FString& Key, const TArray<uint8>& Value, TArray<uint8>& OutRecord, int32& OutValueOffset)
+{
+	FTCHARToUTF8 KeyUtf8(*Key);
+	const int32 KeyLength = KeyUtf8.Length();
+	const int32 ValueLength = Value.Num();
+
+	OutRecord.Reset(sizeof(uint8) + sizeof(int32) * 2 + KeyLength + ValueLength + sizeof(uint32));
+	AppendValue(OutRecord, static_cast<uint8>(Type));
+	AppendValue(OutRecord, KeyLength);
+	OutRecord.Append(reinterpret_cast<const uint8*>(KeyUtf8.Get()), KeyLength);
+	AppendValue(OutRecord, ValueLength);
+	OutValueOffset = OutRecord.Num();
+	OutRecord.Append(Value);
+
+	const uint32 Crc = FCrc::MemCrc32(OutRecord.GetData(), OutRecord.Num());
+	AppendValue(OutRecord, Crc);
+}
+
+DataStorageBinaryFile::FStorageFile& DataStorageBinaryFile::OpenStorageFile(const FString& FileName)
+{
+	if (FStorageFile* Existing = StorageFiles.Find(FileName))
+	{
+		if (!Existing->bNeedsRewrite)
+		{
+			return *Existing;
+		}
+		StorageFiles.Remove(FileName);
+	}
+
+	FStorageFile& File = StorageFiles.Add(FileName);
 
-	//file not exists
-	if (StructurePtr == nullptr) 
+	TArray<uint8> Content;
+	const FString Path = CompleteAbsoluteFilePath(FileName);
+	if (!IsFileExist(FileName) || !FFileHelper::LoadFileToArray(Content, *Path) || Content.Num() == 0)
 	{
-		//create new structure and add Key:Value
-		StructurePtr = MakeShared<FABBinaryFileStructure>();
-		StructurePtr->Add({ Key, Value });
+		return File;
 	}
-	else 
+
+	if (!IsBinaryFormat(Content))
 	{
-		auto ValuePtr = StructurePtr->FindByPredicate([&](FBinaryContentIndependentSegment Segment) { return Segment.Key == Key; });
-		if (ValuePtr == nullptr)
+		if (!MigrateLegacyFile(FileName, File))
+		{
+			UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("Unable to migrate %s to the binary format, keeping it as is"), *FileName);
+			File.bNeedsRewrite = true;
+		}
+		return File;
+	}
+
+	// Replay the log, the last record of a key wins
+	int64 Offset = BinaryFileHeaderSize;
+	while (Offset < Content.Num())
+	{
+		const int64 RecordStart = Offset;
+		uint8 Type = 0;
+		int32 KeyLength = 0;
+		int32 ValueLength = 0;
+		uint32 Crc = 0;
+
+		if (!ReadValue(Content, Offset, Type) || !ReadValue(Content, Offset, KeyLength)
+			|| KeyLength < 0 || Offset + KeyLength > Content.Num())
+		{
+			break;
+		}
+		const int64 KeyOffset = Offset;
+		Offset += KeyLength;
+
+		if (!ReadValue(Content, Offset, ValueLength) || ValueLength < 0 || Offset + ValueLength > Content.Num())
+		{
+			break;
+		}
+		const int64 ValueOffset = Offset;
+		Offset += ValueLength;
+
+		if (!ReadValue(Content, Offset, Crc)
+			|| Crc != FCrc::MemCrc32(Content.GetData() + RecordStart, ValueOffset + ValueLength - RecordStart))
 		{
-			StructurePtr->Add({ Key, Value });
+			break;
+		}
+
+		const FString Key = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Content.GetData() + KeyOffset), KeyLength));
+		const int32 RecordSize = static_cast<int32>(Offset - RecordStart);
+
+		FRecordLocation Previous;
+		if (File.Index.RemoveAndCopyValue(Key, Previous))
+		{
+			File.DeadBytes += Previous.RecordSize;
+		}
+
+		if (Type == static_cast<uint8>(ERecordType::Put))
+		{
+			File.Index.Add(Key, FRecordLocation{ ValueOffset, ValueLength, RecordSize });
 		}
 		else
 		{
-			ValuePtr->ArrayByte = Value;
+			File.DeadBytes += RecordSize;
 		}
+		File.FileSize = Offset;
 	}
 
-	FString SerializedText = FABBinaryFileStructureToString(StructurePtr.Get());
+	if (File.FileSize < Content.Num())
+	{
+		UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("%s has a torn record, keeping the %d items written before it"), *FileName, File.Index.Num());
+
+		TArray<TPair<FString, TArray<uint8>>> Items;
+		for (const TPair<FString, FRecordLocation>& Pair : File.Index)
+		{
+			Items.Emplace(Pair.Key, TArray<uint8>(Content.GetData() + Pair.Value.Offset, Pair.Value.Size));
+		}
+		if (!WriteSnapshot(FileName, Items, File))
+		{
+			File.bNeedsRewrite = true;
+		}
+	}
 
-	TArray<uint8> ByteArray = FAccelByteArrayByteFStringConverter::FStringToBytes(SerializedText);
+	return File;
+}
 
-	FString Path = CompleteAbsoluteFilePath(FileName);
-	return FFileHelper::SaveArrayToFile(ByteArray, *Path);
+bool DataStorageBinaryFile::AppendRecord(const FString& FileName, FStorageFile& File, ERecordType Type, const FString& Key, const TArray<uint8>& Value)
+{
+	if (File.bNeedsRewrite)
+	{
+		// Writing now would truncate the legacy content, or append behind a torn record
+		UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("%s could not be rewritten in the binary format, the record is not written"), *FileName);
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	const bool bNewFile = File.FileSize == 0;
+	if (bNewFile)
+	{
+		AppendHeader(Buffer);
+	}
+
+	TArray<uint8> Record;
+	int32 ValueOffset = 0;
+	SerializeRecord(Type, Key, Value, Record, ValueOffset);
+	const int64 RecordStart = (bNewFile ? BinaryFileHeaderSize : File.FileSize);
+	Buffer.Append(Record);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString Path = CompleteAbsoluteFilePath(FileName);
+	PlatformFile.CreateDirectoryTree(*GetAbsoluteFileDirectory().Path);
+
+	TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*Path, !bNewFile));
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("Unable to open %s for writing"), *Path);
+		return false;
+	}
+
+	// A partial write is dropped by its CRC on the next replay
+	if (!Handle->Write(Buffer.GetData(), Buffer.Num()) || !Handle->Flush(true))
+	{
+		UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("Unable to write a record to %s"), *Path);
+		return false;
+	}
+	Handle.Reset();
+
+	FRecordLocation Previous;
+	if (File.Index.RemoveAndCopyValue(Key, Previous))
+	{
+		File.DeadBytes += Previous.RecordSize;
+	}
+
+	if (Type == ERecordType::Put)
+	{
+		File.Index.Add(Key, FRecordLocation{ RecordStart + ValueOffset, Value.Num(), Record.Num() });
+	}
+	else
+	{
+		File.DeadBytes += Record.Num();
+	}
+	File.FileSize = RecordStart + Record.Num();
+
+	CompactIfNeeded(FileName, File);
+	return true;
+}
+
+bool DataStorageBinaryFile::ReadRecordValue(const FString& FileName, const FStorageFile& File, const FString& Key, TArray<uint8>& OutValue)
+{
+	const FRecordLocation* Location = File.Index.Find(Key);
+	if (Location == nullptr)
+	{
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*CompleteAbsoluteFilePath(FileName)));
+	if (!Handle.IsValid() || !Handle->Seek(Location->Offset))
+	{
+		return false;
+	}
+
+	OutValue.SetNumUninitialized(Location->Size);
+	return Handle->Read(OutValue.GetData(), Location->Size);
+}
+
+bool DataStorageBinaryFile::WriteSnapshot(const FString& FileName, const TArray<TPair<FString, TArray<uint8>>>& Items, FStorageFile& OutFile)
+{
+	TArray<uint8> Buffer;
+	AppendHeader(Buffer);
+
+	FStorageFile Snapshot;
+	TArray<uint8> Record;
+	for (const TPair<FString, TArray<uint8>>& Item : Items)
+	{
+		int32 ValueOffset = 0;
+		SerializeRecord(ERecordType::Put, Item.Key, Item.Value, Record, ValueOffset);
+		Snapshot.Index.Add(Item.Key, FRecordLocation{ Buffer.Num() + ValueOffset, Item.Value.Num(), Record.Num() });
+		Buffer.Append(Record);
+	}
+	Snapshot.FileSize = Buffer.Num();
+
+	// The original stays intact until the complete snapshot replaces it
+	const FString Path = CompleteAbsoluteFilePath(FileName);
+	const FString TempPath = Path + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Buffer, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogAccelByteDataStorageBinaryFile, Warning, TEXT("Unable to write %s"), *Path);
+		return false;
+	}
+
+	OutFile = MoveTemp(Snapshot);
+	return true;
+}
+
+void DataStorageBinaryFile::CompactIfNeeded(const FString& FileName, FStorageFile& File)
+{
+	if (File.FileSize < MinCompactionFileSize || File.DeadBytes * 2 < File.FileSize)
+	{
+		return;
+	}
+
+	TArray<uint8> Content;
+	if (!FFileHelper::LoadFileToArray(Content, *CompleteAbsoluteFilePath(FileName)))
+	{
+		return;
+	}
+
+	TArray<TPair<FString, TArray<uint8>>> Items;
+	Items.Reserve(File.Index.Num());
+	for (const TPair<FString, FRecordLocation>& Pair : File.Index)
+	{
+		if (Pair.Value.Offset + Pair.Value.Size <= Content.Num())
+		{
+			Items.Emplace(Pair.Key, TArray<uint8>(Content.GetData() + Pair.Value.Offset, Pair.Value.Size));
+		}
+	}
+
+	WriteSnapshot(FileName, Items, File);
+}
+
+bool DataStorageBinaryFile::MigrateLegacyFile(const FString& FileName, FStorageFile& OutFile)
+{
+	auto LoadedString = LoadFromFile(FileName);
+	if (!LoadedString.IsSet())
+	{
+		return false;
+	}
+
+	TSharedPtr<FABBinaryFileStructure> Structure = ParseStructureOnly(LoadedString.GetValue());
+
+	// A duplicated key keeps its latest value
+	TArray<TPair<FString, TArray<uint8>>> Items;
+	TMap<FString, int32> ItemIndex;
+	for (const FBinaryContentIndependentSegment& Segment : *Structure)
+	{
+		if (const int32* Existing = ItemIndex.Find(Segment.Key))
+		{
+			Items[*Existing].Value = Segment.ArrayByte;
+			continue;
+		}
+		ItemIndex.Add(Segment.Key, Items.Emplace(Segment.Key, Segment.ArrayByte));
+	}
+
+	UE_LOG(LogAccelByteDataStorageBinaryFile, Log, TEXT("Migrating %s to the binary format with %d items"), *FileName, Items.Num());
+	return WriteSnapshot(FileName, Items, OutFile);
 }
 
 TSharedPtr<FABBinaryFileStructure> DataStorageBinaryFile::ParseStructureFromFile(const FString& FileName)
@@ -367,6 +635,13 @@ void DataStorageBinaryFile::MoveOldCacheToNewCacheFiles(const FABBinaryFileStruc
 
 void DataStorageBinaryFile::ConvertExistingCache(const FString& OldCacheFilename, const FString& NewCacheFilenameForTelemetry, const FString& NewCacheFilenameForGeneralPurpose)
 {
+	// Files written in the JSON lines format are converted to the binary format here instead of on first access
+	{
+		FScopeLock Lock(&StorageLock);
+		OpenStorageFile(NewCacheFilenameForTelemetry);
+		OpenStorageFile(NewCacheFilenameForGeneralPurpose);
+	}
+
 	auto LoadedOldCache = LoadFromFile(OldCacheFilename);
 	//If new cache format is found, no need to do a migration
 	//If OldCache exist but new cache not found, then execute migration
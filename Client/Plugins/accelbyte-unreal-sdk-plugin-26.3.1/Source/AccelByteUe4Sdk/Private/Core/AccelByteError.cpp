@@ -3,6 +3,7 @@
 // and restrictions contact your company contract manager.
 
 #include "Core/AccelByteError.h"
+#include "Core/AccelByteUtilities.h"
 
 namespace AccelByte
 {
@@ -626,5 +627,16 @@ namespace AccelByte
 		}
 	}
 
+	int32 GetHttpAsyncParseThresholdBytes()
+	{
+		static const int32 Threshold = []()
+		{
+			int32 Value = 64 * 1024;
+			FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("AsyncParseThresholdBytes"), Value);
+			return Value;
+		}();
+		return Threshold;
+	}
+
 } // Namespace AccelByte
 
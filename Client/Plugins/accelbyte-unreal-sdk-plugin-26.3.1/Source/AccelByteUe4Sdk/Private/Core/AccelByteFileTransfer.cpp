@@ -0,0 +1,355 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteFileTransfer.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteFileTransfer);
+
+namespace AccelByte
+{
+
+namespace
+{
+	/**
+	 * @brief Parse a "bytes <first>-<last>/<total>" Content-Range header, where the span or the total can be "*".
+	 */
+	bool ParseContentRange(FString const& ContentRange, int64& OutFirstByte, int64& OutTotalBytes)
+	{
+		FString Unit, Range;
+		if (!ContentRange.TrimStartAndEnd().Split(TEXT(" "), &Unit, &Range) || !Unit.Equals(TEXT("bytes"), ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+
+		FString Span, Total;
+		if (!Range.Split(TEXT("/"), &Span, &Total))
+		{
+			return false;
+		}
+
+		FString FirstByte, LastByte;
+		OutFirstByte = Span.Split(TEXT("-"), &FirstByte, &LastByte) ? FCString::Atoi64(*FirstByte) : INDEX_NONE;
+		OutTotalBytes = Total == TEXT("*") ? INDEX_NONE : FCString::Atoi64(*Total);
+		return true;
+	}
+
+	/**
+	 * @brief Value to send as If-Range, If-Range only accepts strong entity tags.
+	 */
+	FString GetValidator(FHttpResponsePtr const& Response)
+	{
+		const FString ETag = Response->GetHeader(TEXT("ETag"));
+		if (!ETag.IsEmpty() && !ETag.StartsWith(TEXT("W/")))
+		{
+			return ETag;
+		}
+		return Response->GetHeader(TEXT("Last-Modified"));
+	}
+}
+
+FAccelByteFileDownload::FAccelByteFileDownload(FHttpRetryScheduler& InScheduler
+	, FString const& InUrl
+	, FString const& InFilePath
+	, FAccelByteTransferProgressDelegate const& InOnProgress
+	, FVoidHandler const& InOnDownloaded
+	, FErrorHandler const& InOnError
+	, int64 InChunkBytes
+	, int32 InMaxResumeAttempts)
+	: Scheduler(InScheduler)
+	, Url(InUrl)
+	, FilePath(InFilePath)
+	, PartialFilePath(GetPartialFilePath(InFilePath))
+	, ValidatorFilePath(GetValidatorFilePath(InFilePath))
+	, OnProgress(InOnProgress)
+	, OnDownloaded(InOnDownloaded)
+	, OnError(InOnError)
+	, ChunkBytes(FMath::Max<int64>(InChunkBytes, 1))
+	, MaxResumeAttempts(FMath::Max(InMaxResumeAttempts, 0))
+{
+}
+
+FString FAccelByteFileDownload::GetPartialFilePath(FString const& FilePath)
+{
+	return FilePath + TEXT(".part");
+}
+
+FString FAccelByteFileDownload::GetValidatorFilePath(FString const& FilePath)
+{
+	return FilePath + TEXT(".part.meta");
+}
+
+void FAccelByteFileDownload::Start()
+{
+	bCancelled = false;
+	ResumeAttempts = 0;
+	TotalBytes = INDEX_NONE;
+	Validator.Reset();
+	Offset = FMath::Max<int64>(IFileManager::Get().FileSize(*PartialFilePath), 0);
+	if (Offset > 0)
+	{
+		if (LoadValidator())
+		{
+			UE_LOG(LogAccelByteFileTransfer, Log, TEXT("Resuming download of %s from byte %lld"), *Url, Offset);
+		}
+		else
+		{
+			// Without a validator there is no way to tell whether the bytes on disk still match the content
+			UE_LOG(LogAccelByteFileTransfer, Log, TEXT("Discarding %lld bytes of %s that cannot be validated"), Offset, *PartialFilePath);
+			DiscardPartialFile();
+		}
+	}
+
+	RequestNextChunk();
+}
+
+void FAccelByteFileDownload::Cancel()
+{
+	bCancelled = true;
+	if (FAccelByteTaskPtr Task = CurrentTask.Pin())
+	{
+		Task->Cancel();
+	}
+	CurrentTask.Reset();
+}
+
+void FAccelByteFileDownload::RequestNextChunk()
+{
+	if (bCancelled)
+	{
+		return;
+	}
+
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Url);
+	Request->SetVerb(TEXT("GET"));
+	Request->SetHeader(TEXT("Accept"), TEXT("application/octet-stream"));
+	Request->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-%lld"), Offset, Offset + ChunkBytes - 1));
+	if (Offset > 0 && !Validator.IsEmpty())
+	{
+		Request->SetHeader(TEXT("If-Range"), Validator);
+	}
+
+	TSharedRef<FAccelByteFileDownload, ESPMode::ThreadSafe> Self = AsShared();
+	const int64 ChunkOffset = Offset;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+	Request->OnRequestProgress64().BindLambda([Self, ChunkOffset](FHttpRequestPtr, uint64, uint64 BytesReceived)
+#else
+	Request->OnRequestProgress().BindLambda([Self, ChunkOffset](FHttpRequestPtr, int32, int32 BytesReceived)
+#endif
+		{
+			Self->OnProgress.ExecuteIfBound(ChunkOffset + static_cast<int64>(BytesReceived), Self->TotalBytes);
+		});
+
+	CurrentTask = Scheduler.ProcessRequest(Request
+		, FHttpRequestCompleteDelegate::CreateSP(Self, &FAccelByteFileDownload::OnChunkCompleted)
+		, FPlatformTime::Seconds());
+	if (!CurrentTask.IsValid())
+	{
+		Fail(static_cast<int32>(ErrorCodes::NetworkError), TEXT("Request not sent."));
+	}
+}
+
+void FAccelByteFileDownload::OnChunkCompleted(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+	CurrentTask.Reset();
+	if (bCancelled)
+	{
+		return;
+	}
+
+	if (!bSucceeded || !Response.IsValid())
+	{
+		Resume(TEXT("Connection dropped"));
+		return;
+	}
+
+	const int32 ResponseCode = Response->GetResponseCode();
+	if (ResponseCode == static_cast<int32>(ErrorCodes::StatusPartialContent))
+	{
+		int64 FirstByte = INDEX_NONE;
+		int64 ContentTotalBytes = INDEX_NONE;
+		if (!ParseContentRange(Response->GetHeader(TEXT("Content-Range")), FirstByte, ContentTotalBytes) || FirstByte != Offset)
+		{
+			Fail(static_cast<int32>(ErrorCodes::InvalidResponse), FString::Printf(TEXT("Unexpected content range received for %s"), *Url));
+			return;
+		}
+
+		const FString ResponseValidator = GetValidator(Response);
+		if (Offset > 0 && !Validator.IsEmpty() && !ResponseValidator.IsEmpty() && ResponseValidator != Validator)
+		{
+			// Only a server ignoring If-Range gets here, the next request starts over
+			UE_LOG(LogAccelByteFileTransfer, Warning, TEXT("Content of %s changed after %lld bytes were downloaded"), *Url, Offset);
+			DiscardPartialFile();
+			Resume(TEXT("Content changed"));
+			return;
+		}
+
+		TArray<uint8> const& Content = Response->GetContent();
+		if (Content.Num() == 0)
+		{
+			Resume(TEXT("Empty chunk received"));
+			return;
+		}
+		if (Offset == 0)
+		{
+			SaveValidator(Response);
+		}
+		if (!WriteChunk(Content, false))
+		{
+			return;
+		}
+
+		Offset += Content.Num();
+		TotalBytes = ContentTotalBytes;
+		ResumeAttempts = 0;
+		OnProgress.ExecuteIfBound(Offset, TotalBytes);
+
+		const bool bComplete = TotalBytes != INDEX_NONE ? Offset >= TotalBytes : Content.Num() < ChunkBytes;
+		if (bComplete)
+		{
+			Finish();
+		}
+		else
+		{
+			RequestNextChunk();
+		}
+	}
+	else if (EHttpResponseCodes::IsOk(ResponseCode))
+	{
+		// The server ignored the range, or the content changed since the partial file was written, and sent it whole
+		if (Offset > 0)
+		{
+			UE_LOG(LogAccelByteFileTransfer, Log, TEXT("Discarding %lld bytes previously downloaded from %s, the whole content was sent"), Offset, *Url);
+			DiscardPartialFile();
+		}
+
+		TArray<uint8> const& Content = Response->GetContent();
+		SaveValidator(Response);
+		if (!WriteChunk(Content, true))
+		{
+			return;
+		}
+
+		Offset = Content.Num();
+		TotalBytes = Offset;
+		OnProgress.ExecuteIfBound(Offset, TotalBytes);
+		Finish();
+	}
+	else if (ResponseCode == static_cast<int32>(ErrorCodes::StatusRequestedRangeNotSatisfiable) && Offset > 0)
+	{
+		int64 FirstByte = INDEX_NONE;
+		int64 ContentTotalBytes = INDEX_NONE;
+		if (ParseContentRange(Response->GetHeader(TEXT("Content-Range")), FirstByte, ContentTotalBytes) && ContentTotalBytes == Offset)
+		{
+			// A previous attempt already received everything
+			TotalBytes = ContentTotalBytes;
+			Finish();
+			return;
+		}
+
+		// The partial file does not belong to the current content anymore
+		UE_LOG(LogAccelByteFileTransfer, Warning, TEXT("Discarding %lld bytes previously downloaded from %s"), Offset, *Url);
+		DiscardPartialFile();
+		Resume(TEXT("Stale partial file"));
+	}
+	else
+	{
+		int32 Code;
+		FString Message;
+		HandleHttpError(Request, Response, Code, Message);
+		Fail(Code, Message);
+	}
+}
+
+bool FAccelByteFileDownload::WriteChunk(TArray<uint8> const& Content, bool bTruncate)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(PartialFilePath));
+
+	TUniquePtr<IFileHandle> FileHandle(PlatformFile.OpenWrite(*PartialFilePath, !bTruncate));
+	if (!FileHandle.IsValid() || !FileHandle->Write(Content.GetData(), Content.Num()) || !FileHandle->Flush())
+	{
+		Fail(static_cast<int32>(ErrorCodes::UnknownError), FString::Printf(TEXT("Unable to write %s"), *PartialFilePath));
+		return false;
+	}
+	return true;
+}
+
+void FAccelByteFileDownload::Resume(FString const& Reason)
+{
+	if (ResumeAttempts >= MaxResumeAttempts)
+	{
+		Fail(static_cast<int32>(ErrorCodes::NetworkError), FString::Printf(TEXT("%s while downloading %s"), *Reason, *Url));
+		return;
+	}
+
+	ResumeAttempts++;
+	UE_LOG(LogAccelByteFileTransfer, Log, TEXT("%s, resuming download of %s from byte %lld (attempt %d/%d)")
+		, *Reason, *Url, Offset, ResumeAttempts, MaxResumeAttempts);
+	RequestNextChunk();
+}
+
+bool FAccelByteFileDownload::LoadValidator()
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *ValidatorFilePath) || Lines.Num() < 2 || Lines[0] != Url || Lines[1].IsEmpty())
+	{
+		return false;
+	}
+
+	Validator = Lines[1];
+	return true;
+}
+
+void FAccelByteFileDownload::SaveValidator(FHttpResponsePtr const& Response)
+{
+	Validator = GetValidator(Response);
+	if (Validator.IsEmpty())
+	{
+		IFileManager::Get().Delete(*ValidatorFilePath, false, false, true);
+		return;
+	}
+
+	const TArray<FString> Lines{Url, Validator};
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *ValidatorFilePath))
+	{
+		UE_LOG(LogAccelByteFileTransfer, Warning, TEXT("Unable to write %s, the download of %s cannot be resumed later"), *ValidatorFilePath, *Url);
+	}
+}
+
+void FAccelByteFileDownload::DiscardPartialFile()
+{
+	IFileManager::Get().Delete(*PartialFilePath, false, false, true);
+	IFileManager::Get().Delete(*ValidatorFilePath, false, false, true);
+	Validator.Reset();
+	Offset = 0;
+	TotalBytes = INDEX_NONE;
+}
+
+void FAccelByteFileDownload::Finish()
+{
+	if (!IFileManager::Get().Move(*FilePath, *PartialFilePath, true))
+	{
+		Fail(static_cast<int32>(ErrorCodes::UnknownError), FString::Printf(TEXT("Unable to move the downloaded content to %s"), *FilePath));
+		return;
+	}
+	IFileManager::Get().Delete(*ValidatorFilePath, false, false, true);
+
+	OnDownloaded.ExecuteIfBound();
+}
+
+void FAccelByteFileDownload::Fail(int32 Code, FString const& Message)
+{
+	UE_LOG(LogAccelByteFileTransfer, Warning, TEXT("Download of %s stopped at byte %lld: %s"), *Url, Offset, *Message);
+	OnError.ExecuteIfBound(Code, Message);
+}
+
+} // Namespace AccelByte
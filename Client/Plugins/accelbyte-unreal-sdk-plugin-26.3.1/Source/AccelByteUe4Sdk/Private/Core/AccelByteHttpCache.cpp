@@ -64,6 +64,9 @@ namespace AccelByte
 				}
 			}
 
+			// Requests a part of the resource only
+			const FString Range = TEXT("Range");
+
 			namespace Verb
 			{
 				const FString Delete = TEXT("DELETE");
@@ -87,11 +90,22 @@ namespace AccelByte
 			{
 			case EHttpCacheType::MEMORY:
 				CachedItemsInternal = MakeShareable<FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>());
-				return;
+				break;
 			case EHttpCacheType::STORAGE:
 			default:
 				CachedItemsInternal = MakeShareable<FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>());
-				return;
+				break;
+			}
+
+			// Non positive values keep the default capacity
+			int32 MaxCount = 0;
+			FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("HttpCacheMaxCount"), MaxCount);
+			int32 MaxSizeBytes = 0;
+			FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("HttpCacheMaxSizeBytes"), MaxSizeBytes);
+			if (MaxCount > 0 || MaxSizeBytes > 0)
+			{
+				CachedItemsInternal->SetCapacity(MaxSizeBytes > 0 ? static_cast<size_t>(MaxSizeBytes) : CachedItemsInternal->GetMaxSizeBytes()
+					, MaxCount > 0 ? MaxCount : CachedItemsInternal->GetMaxCount());
 			}
 		}
 
@@ -127,6 +141,12 @@ namespace AccelByte
 				return false;
 			}
 
+			if (!CompletedRequest->GetHeader(HTTPHeader::Range).IsEmpty())
+			{
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Request only asked for a part of the resource"));
+				return false;
+			}
+
 			const FHttpResponsePtr ResponsePtr = CompletedRequest->GetResponse();
 			if (ResponsePtr == nullptr)
 			{
@@ -398,10 +418,16 @@ namespace AccelByte
 
 		FName FAccelByteHttpCache::ConstructKey(const FHttpRequestPtr& Request)
 		{
-			const FString KeyString = FAccelByteUtilities::GenerateHashString(FString::Printf(TEXT("%s-%s")
-				, *Request->GetVerb()
-				, *Request->GetURL()
-			));
+			// Parts of a resource must not be mistaken for the whole resource, or for each other
+			const FString Range = Request->GetHeader(HTTPHeader::Range);
+			const FString KeyString = FAccelByteUtilities::GenerateHashString(Range.IsEmpty()
+				? FString::Printf(TEXT("%s-%s")
+					, *Request->GetVerb()
+					, *Request->GetURL())
+				: FString::Printf(TEXT("%s-%s-%s")
+					, *Request->GetVerb()
+					, *Request->GetURL()
+					, *Range));
 
 			const FName Key = FName(*KeyString);
 
@@ -0,0 +1,382 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpRateLimiter.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace AccelByte
+{
+
+FRWLock FHttpRateLimiter::PoliciesLock;
+TArray<TPair<FString, FAccelByteRateLimitPolicy>> FHttpRateLimiter::Policies{};
+float FHttpRateLimiter::DefaultMaxWaitSeconds = 5.0f;
+
+namespace
+{
+	/** Bucket probes before giving up and sharing the home bucket with another endpoint. */
+	constexpr int32 MaxBucketProbes = 16;
+
+	int64 ToMicroseconds(double Seconds)
+	{
+		return static_cast<int64>(Seconds * 1000000.0);
+	}
+
+	FString GetEndpoint(const FString& Url)
+	{
+		int32 QueryIndex = INDEX_NONE;
+		if (Url.FindChar(TEXT('?'), QueryIndex))
+		{
+			return Url.Left(QueryIndex);
+		}
+		return Url;
+	}
+
+	bool IsIdSegment(const FString& Segment)
+	{
+		if (Segment.IsEmpty())
+		{
+			return false;
+		}
+
+		bool bAllDigits = true;
+		bool bAllHex = true;
+		for (const TCHAR Char : Segment)
+		{
+			bAllDigits &= FChar::IsDigit(Char);
+			bAllHex &= FChar::IsHexDigit(Char) || Char == TEXT('-');
+		}
+		// Numeric ids, and user, session or item ids which are 32 hex digits, optionally as a dashed UUID.
+		return bAllDigits || (bAllHex && Segment.Len() >= 16);
+	}
+
+	/** Stats are per route, otherwise every user or session id in a URL would get an entry of its own. */
+	FString GetRoute(const FString& Endpoint)
+	{
+		TArray<FString> Segments;
+		Endpoint.ParseIntoArray(Segments, TEXT("/"), false);
+		for (FString& Segment : Segments)
+		{
+			if (IsIdSegment(Segment))
+			{
+				Segment = TEXT("{id}");
+			}
+		}
+		return FString::Join(Segments, TEXT("/"));
+	}
+}
+
+FHttpRateLimiter::FHttpRateLimiter()
+	: Buckets(MakeUnique<FBucket[]>(MaxBuckets))
+{
+	SetRate(FHttpRetryScheduler::DefaultRateLimit);
+}
+
+void FHttpRateLimiter::SetRate(uint32 RequestsPerSecond)
+{
+	RequestsPerSecond = FMath::Max<uint32>(RequestsPerSecond, 1);
+	const int64 Interval = ToMicroseconds(1.0) / RequestsPerSecond;
+	IntervalMicroseconds = Interval;
+	// A full second worth of requests may go out at once, like the previous per second window.
+	BurstMicroseconds = Interval * RequestsPerSecond;
+}
+
+bool FHttpRateLimiter::IsBucketIdle(const FBucket& Bucket, int64 NowMicroseconds)
+{
+	// Nothing is queued and every token is back, so the bucket holds nothing a fresh one wouldn't.
+	return Bucket.Waiting.load(std::memory_order_acquire) == 0 && Bucket.Tat.load(std::memory_order_relaxed) <= NowMicroseconds;
+}
+
+int32 FHttpRateLimiter::FindBucket(const FString& Endpoint, double Time)
+{
+	uint64 Key = CityHash64(reinterpret_cast<const char*>(*Endpoint), Endpoint.Len() * sizeof(TCHAR));
+	if (Key == 0)
+	{
+		Key = 1;
+	}
+
+	const int64 Now = ToMicroseconds(Time);
+	const int32 Home = static_cast<int32>(Key % MaxBuckets);
+	int32 IdleIndex = INDEX_NONE;
+	for (int32 Probe = 0; Probe < MaxBucketProbes; ++Probe)
+	{
+		const int32 Index = (Home + Probe) % MaxBuckets;
+		FBucket& Bucket = Buckets[Index];
+
+		uint64 Existing = Bucket.Key.load(std::memory_order_acquire);
+		if (Existing == Key)
+		{
+			return Index;
+		}
+		if (Existing == 0 && Bucket.Key.compare_exchange_strong(Existing, Key, std::memory_order_acq_rel))
+		{
+			return Index;
+		}
+		// Lost the race to claim an empty bucket, it may have been claimed for this endpoint.
+		if (Existing == Key)
+		{
+			return Index;
+		}
+		if (IdleIndex == INDEX_NONE && IsBucketIdle(Bucket, Now))
+		{
+			IdleIndex = Index;
+		}
+	}
+
+	// Every probed bucket is claimed, e.g. by URLs that embed ids, take over one that went idle.
+	// A request of the previous endpoint racing with this only spends one token of the new endpoint.
+	if (IdleIndex != INDEX_NONE)
+	{
+		FBucket& Bucket = Buckets[IdleIndex];
+		uint64 Existing = Bucket.Key.load(std::memory_order_acquire);
+		if (IsBucketIdle(Bucket, Now) && Bucket.Key.compare_exchange_strong(Existing, Key, std::memory_order_acq_rel))
+		{
+			return IdleIndex;
+		}
+		if (Existing == Key)
+		{
+			return IdleIndex;
+		}
+	}
+
+	return Home;
+}
+
+bool FHttpRateLimiter::TryAcquireToken(FBucket& Bucket, double Time, double& OutAvailableTime) const
+{
+	const int64 Now = ToMicroseconds(Time);
+	const int64 Interval = IntervalMicroseconds.load(std::memory_order_relaxed);
+	const int64 Burst = BurstMicroseconds.load(std::memory_order_relaxed);
+
+	int64 Tat = Bucket.Tat.load(std::memory_order_relaxed);
+	while (true)
+	{
+		const int64 NewTat = FMath::Max(Tat, Now) + Interval;
+		if (NewTat - Now > Burst)
+		{
+			OutAvailableTime = static_cast<double>(NewTat - Burst) / 1000000.0;
+			return false;
+		}
+		if (Bucket.Tat.compare_exchange_weak(Tat, NewTat, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+}
+
+FAccelByteRateLimitPolicy FHttpRateLimiter::FindPolicy(const FString& Url)
+{
+	FAccelByteRateLimitPolicy Result;
+	FReadScopeLock ReadLock(PoliciesLock);
+	for (const TPair<FString, FAccelByteRateLimitPolicy>& Policy : Policies)
+	{
+		if (Url.Contains(Policy.Key))
+		{
+			Result = Policy.Value;
+			break;
+		}
+	}
+
+	if (Result.MaxWaitSeconds < 0.0f)
+	{
+		Result.MaxWaitSeconds = DefaultMaxWaitSeconds;
+	}
+	return Result;
+}
+
+void FHttpRateLimiter::SetPolicy(const FString& UrlPattern, const FAccelByteRateLimitPolicy& Policy)
+{
+	FWriteScopeLock WriteLock(PoliciesLock);
+	for (TPair<FString, FAccelByteRateLimitPolicy>& Existing : Policies)
+	{
+		if (Existing.Key == UrlPattern)
+		{
+			Existing.Value = Policy;
+			return;
+		}
+	}
+	Policies.Emplace(UrlPattern, Policy);
+}
+
+bool FHttpRateLimiter::RemovePolicy(const FString& UrlPattern)
+{
+	FWriteScopeLock WriteLock(PoliciesLock);
+	return Policies.RemoveAll([&UrlPattern](const TPair<FString, FAccelByteRateLimitPolicy>& Policy)
+		{
+			return Policy.Key == UrlPattern;
+		}) > 0;
+}
+
+void FHttpRateLimiter::SetDefaultMaxWaitSeconds(float Seconds)
+{
+	FWriteScopeLock WriteLock(PoliciesLock);
+	DefaultMaxWaitSeconds = Seconds;
+}
+
+bool FHttpRateLimiter::AcquireOrQueue(const FAccelByteTaskPtr& Task, const FString& Url, double Time)
+{
+	const FAccelByteRateLimitPolicy Policy = FindPolicy(Url);
+	if (Policy.Priority == EAccelByteRateLimitPriority::Critical)
+	{
+		return true;
+	}
+
+	const FString Endpoint = GetEndpoint(Url);
+	const int32 BucketIndex = FindBucket(Endpoint, Time);
+	FBucket& Bucket = Buckets[BucketIndex];
+
+	double AvailableTime = 0.0;
+	if (Bucket.Waiting.load(std::memory_order_acquire) == 0 && TryAcquireToken(Bucket, Time, AvailableTime))
+	{
+		return true;
+	}
+
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Rate limit reached, request queued for up to %.1f seconds %s"), Policy.MaxWaitSeconds, *Url);
+
+	Bucket.Waiting.fetch_add(1, std::memory_order_acq_rel);
+	Incoming.Enqueue(FIncomingTask{
+		FQueuedTask{ Task, Endpoint, Policy.Priority, Time + Policy.MaxWaitSeconds, NextSequence.fetch_add(1, std::memory_order_relaxed) },
+		BucketIndex });
+
+	return false;
+}
+
+double FHttpRateLimiter::Poll(double Time, const FOnTaskReleased& OnDispatch, const FOnTaskReleased& OnTimedOut)
+{
+	FIncomingTask IncomingTask;
+	while (Incoming.Dequeue(IncomingTask))
+	{
+		FindOrAddStats(IncomingTask.Queued.Endpoint, Time).TotalQueued++;
+
+		Queues.FindOrAdd(IncomingTask.BucketIndex).HeapPush(MoveTemp(IncomingTask.Queued));
+	}
+
+	double NextPollTime = MAX_dbl;
+
+	for (auto It = Queues.CreateIterator(); It; ++It)
+	{
+		FBucket& Bucket = Buckets[It.Key()];
+		TArray<FQueuedTask>& Queue = It.Value();
+		int32 Released = 0;
+
+		const int32 Expired = Queue.RemoveAll([&](const FQueuedTask& Queued)
+			{
+				if (Queued.Deadline > Time)
+				{
+					return false;
+				}
+				UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, rate limit reached and waited too long %s"), *Queued.Endpoint);
+				FindOrAddStats(Queued.Endpoint, Time).TotalTimedOut++;
+				OnTimedOut.ExecuteIfBound(Queued.Task);
+				return true;
+			});
+		if (Expired > 0)
+		{
+			Queue.Heapify();
+		}
+		Released += Expired;
+
+		while (Queue.Num() > 0)
+		{
+			double AvailableTime = 0.0;
+			if (!TryAcquireToken(Bucket, Time, AvailableTime))
+			{
+				NextPollTime = FMath::Min(NextPollTime, AvailableTime);
+				break;
+			}
+
+			FQueuedTask Queued;
+			Queue.HeapPop(Queued);
+			OnDispatch.ExecuteIfBound(Queued.Task);
+			++Released;
+		}
+
+		for (const FQueuedTask& Queued : Queue)
+		{
+			NextPollTime = FMath::Min(NextPollTime, Queued.Deadline);
+		}
+
+		Bucket.Waiting.fetch_sub(Released, std::memory_order_acq_rel);
+
+		if (Queue.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Depth is recomputed every poll because endpoints may share a bucket.
+	for (TPair<FString, FRouteStats>& RouteStats : Stats)
+	{
+		RouteStats.Value.Stats.QueueDepth = 0;
+	}
+	for (const TPair<int32, TArray<FQueuedTask>>& Queue : Queues)
+	{
+		for (const FQueuedTask& Queued : Queue.Value)
+		{
+			FAccelByteRateLimitEndpointStats& EndpointStats = FindOrAddStats(Queued.Endpoint, Time);
+			EndpointStats.QueueDepth++;
+			EndpointStats.PeakQueueDepth = FMath::Max(EndpointStats.PeakQueueDepth, EndpointStats.QueueDepth);
+		}
+	}
+
+	return NextPollTime;
+}
+
+FAccelByteRateLimitEndpointStats& FHttpRateLimiter::FindOrAddStats(const FString& Endpoint, double Time)
+{
+	const FString Route = GetRoute(Endpoint);
+	if (FRouteStats* Existing = Stats.Find(Route))
+	{
+		Existing->LastQueuedTime = Time;
+		return Existing->Stats;
+	}
+
+	if (Stats.Num() >= MaxStatsEndpoints)
+	{
+		// Routes with queued requests are still counted, only an idle one is forgotten.
+		FString Oldest;
+		double OldestTime = MAX_dbl;
+		for (const TPair<FString, FRouteStats>& RouteStats : Stats)
+		{
+			if (RouteStats.Value.Stats.QueueDepth == 0 && RouteStats.Value.LastQueuedTime < OldestTime)
+			{
+				Oldest = RouteStats.Key;
+				OldestTime = RouteStats.Value.LastQueuedTime;
+			}
+		}
+		if (OldestTime != MAX_dbl)
+		{
+			Stats.Remove(Oldest);
+		}
+	}
+
+	FRouteStats& RouteStats = Stats.Add(Route);
+	RouteStats.Stats.Endpoint = Route;
+	RouteStats.LastQueuedTime = Time;
+	return RouteStats.Stats;
+}
+
+void FHttpRateLimiter::Empty()
+{
+	Incoming.Empty();
+	Queues.Empty();
+	for (int32 Index = 0; Index < MaxBuckets; ++Index)
+	{
+		Buckets[Index].Waiting = 0;
+	}
+}
+
+TArray<FAccelByteRateLimitEndpointStats> FHttpRateLimiter::GetStats() const
+{
+	TArray<FAccelByteRateLimitEndpointStats> Result;
+	Result.Reserve(Stats.Num());
+	for (const TPair<FString, FRouteStats>& RouteStats : Stats)
+	{
+		Result.Add(RouteStats.Value.Stats);
+	}
+	return Result;
+}
+
+}
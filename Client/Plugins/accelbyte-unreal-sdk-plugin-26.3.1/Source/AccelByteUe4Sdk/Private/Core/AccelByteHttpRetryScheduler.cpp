@@ -31,6 +31,11 @@ FString FHttpRetryScheduler::HeaderGameClientVersion = TEXT("");
 
 TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> FHttpRetryScheduler::ResponseCodeDelegates{};
 
+FCriticalSection FHttpRetryScheduler::SharedPollingLock;
+TArray<FHttpRetryScheduler::FSharedPollingEntryPtr> FHttpRetryScheduler::SharedPollingSchedulers{};
+int32 FHttpRetryScheduler::SharedPollingCursor = 0;
+FDelegateHandleAlias FHttpRetryScheduler::SharedPollingHandle{};
+
 typedef FHttpRetryScheduler::FBearerAuthRejectedRefresh FBearerAuthRejectedRefresh;
 
 FHttpRetryScheduler::FHttpRetryScheduler()
@@ -39,8 +44,11 @@ FHttpRetryScheduler::FHttpRetryScheduler()
 
 FHttpRetryScheduler::~FHttpRetryScheduler()
 {
+	StopPolling();
 	TaskQueue.Empty();
-	RequestsBucket.Empty();
+	ScheduledTasks.Empty();
+	ReadyTasks->Empty();
+	RateLimiter.Empty();
 }
 
 void FHttpRetryScheduler::InitializeRateLimit()
@@ -50,6 +58,133 @@ void FHttpRetryScheduler::InitializeRateLimit()
 	{
 		RateLimit = DefaultRateLimit;
 	}
+	RateLimiter.SetRate(RateLimit);
+
+	float MaxWaitSeconds = DefaultRateLimitMaxWaitSeconds;
+	FString MaxWaitSecondsString;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("RateLimitMaxWaitSeconds"), MaxWaitSecondsString);
+	if (MaxWaitSecondsString.IsNumeric())
+	{
+		MaxWaitSeconds = FCString::Atof(*MaxWaitSecondsString);
+	}
+	FHttpRateLimiter::SetDefaultMaxWaitSeconds(MaxWaitSeconds >= 0.0f ? MaxWaitSeconds : DefaultRateLimitMaxWaitSeconds);
+}
+
+void FHttpRetryScheduler::InitializeRequestCoalescing()
+{
+	bEnableRequestCoalescing = true;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("bEnableRequestCoalescing"), bEnableRequestCoalescing);
+}
+
+void FHttpRetryScheduler::InitializeSharedPolling()
+{
+	bSharedPolling = false;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("HTTP"), TEXT("bSharedPollingTicker"), bSharedPolling);
+}
+
+int32 FHttpRetryScheduler::GetSharedPollingSchedulerCount()
+{
+	FScopeLock Lock(&SharedPollingLock);
+	return SharedPollingSchedulers.Num();
+}
+
+void FHttpRetryScheduler::StartPolling()
+{
+	if (!bSharedPolling)
+	{
+		// Ticks every frame, PollRetry returns immediately unless a task is due or a request completed.
+		PollRetryHandle = FTickerAlias::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateLambda([this](float DeltaTime)
+			{
+				PollRetry(FPlatformTime::Seconds());
+
+				return true;
+			}));
+		return;
+	}
+
+	if (SharedPollingEntry.IsValid())
+	{
+		return;
+	}
+	SharedPollingEntry = MakeShared<FSharedPollingEntry, ESPMode::ThreadSafe>();
+	SharedPollingEntry->Scheduler = this;
+
+	FScopeLock Lock(&SharedPollingLock);
+	SharedPollingSchedulers.Add(SharedPollingEntry);
+	if (!SharedPollingHandle.IsValid())
+	{
+		SharedPollingHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FHttpRetryScheduler::PollSharedSchedulers));
+	}
+}
+
+void FHttpRetryScheduler::StopPolling()
+{
+	if (PollRetryHandle.IsValid())
+	{
+		// Core ticker by this point in engine shutdown has already been torn down - only remove ticker if this is not an engine shutdown
+		if (!IsEngineExitRequested())
+		{
+			FTickerAlias::GetCoreTicker().RemoveTicker(PollRetryHandle);
+		}
+		PollRetryHandle.Reset();
+	}
+
+	if (!SharedPollingEntry.IsValid())
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&SharedPollingLock);
+		SharedPollingSchedulers.Remove(SharedPollingEntry);
+		if (SharedPollingSchedulers.Num() == 0 && SharedPollingHandle.IsValid())
+		{
+			if (!IsEngineExitRequested())
+			{
+				FTickerAlias::GetCoreTicker().RemoveTicker(SharedPollingHandle);
+			}
+			SharedPollingHandle.Reset();
+		}
+	}
+
+	{
+		// Waits for a poll of this scheduler in progress on another thread. The lock is recursive, a callback shutting
+		// the scheduler down from its own poll does not block.
+		FScopeLock EntryLock(&SharedPollingEntry->Lock);
+		SharedPollingEntry->Scheduler = nullptr;
+	}
+	SharedPollingEntry.Reset();
+}
+
+bool FHttpRetryScheduler::PollSharedSchedulers(float DeltaTime)
+{
+	TArray<FSharedPollingEntryPtr> Schedulers;
+	int32 Start = 0;
+	{
+		FScopeLock Lock(&SharedPollingLock);
+		Schedulers = SharedPollingSchedulers;
+		SharedPollingCursor = Schedulers.Num() > 0 ? (SharedPollingCursor + 1) % Schedulers.Num() : 0;
+		Start = SharedPollingCursor;
+	}
+
+	const double Time = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Schedulers.Num(); Index++)
+	{
+		const FSharedPollingEntryPtr& Entry = Schedulers[(Start + Index) % Schedulers.Num()];
+
+		// Only this scheduler's entry is held while it is polled, other schedulers can join or leave meanwhile.
+		FScopeLock EntryLock(&Entry->Lock);
+
+		// A callback of a previous scheduler, or another thread, may have shut this one down
+		if (Entry->Scheduler == nullptr)
+		{
+			continue;
+		}
+		Entry->Scheduler->PollRetry(Time);
+	}
+
+	return true;
 }
 
 FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
@@ -84,6 +219,16 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 
 	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
 
+	TWeakPtr<FReadyTaskQueue, ESPMode::ThreadSafe> ReadyTasksWPtr = ReadyTasks;
+	FAccelByteTaskWPtr TaskWPtr = Task;
+	HttpRetryTaskPtr->SetOnRequestCompleted(FSimpleDelegate::CreateLambda([ReadyTasksWPtr, TaskWPtr]()
+		{
+			if (TSharedPtr<FReadyTaskQueue, ESPMode::ThreadSafe> ReadyTasksPtr = ReadyTasksWPtr.Pin())
+			{
+				ReadyTasksPtr->Enqueue(TaskWPtr);
+			}
+		}));
+
 	//Http header
 	Request->SetHeader("Namespace", HeaderNamespace);
 	Request->SetHeader("Game-Client-Version", HeaderGameClientVersion);
@@ -101,44 +246,20 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 		{
 			HttpRetryTaskPtr->FinishFromCached(CachedResponse);
 		}
+		else if (TryCoalesceRequest(Task, Request))
+		{
+			// Finished together with the identical request already in flight.
+			return Task;
+		}
 		else
 		{
-			uint32 AvailableToken = RateLimit;
-			double ResetTokenTime = RequestTime + 1.0f; //Reset every second
-			bool bCancelRequest = false;
-			RequestBucketLock.Lock();
-			if (FRequestBucket* LastRequest = RequestsBucket.Find(Request->GetURL()))
-			{
-				if (RequestTime < LastRequest->ResetTokenTime)
-				{
-					if (LastRequest->AvailableToken <= 0)
-					{
-						UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, rate limit reached %s"), *Request->GetURL());
-						Task->Cancel();
-						bCancelRequest = true;
-					}
-					else
-					{
-						--LastRequest->AvailableToken;
-					}
-				}
-				else
-				{
-					LastRequest->AvailableToken = --AvailableToken;
-					LastRequest->ResetTokenTime = ResetTokenTime;
-				}
-			}
-			else
-			{
-				RequestsBucket.Emplace(Request->GetURL(), FRequestBucket{ --AvailableToken, ResetTokenTime});
-			}
-			RequestBucketLock.Unlock();
-			if (!bCancelRequest)
+			if (!RateLimiter.AcquireOrQueue(Task, Request->GetURL(), RequestTime))
 			{
-				Task->Start();
+				// Started and scheduled by PollRateLimiter once the endpoint has a token again.
+				return Task;
 			}
+			Task->Start();
 		}
-
 	}
 	TaskQueue.Enqueue(Task);
 
@@ -184,6 +305,16 @@ void FHttpRetryScheduler::SetHttpResponseCodeHandlerDelegate(EHttpResponseCodes:
 	FHttpRetryScheduler::ResponseCodeDelegates.Emplace(StatusCode, Handler);
 }
 
+void FHttpRetryScheduler::SetRateLimitPolicy(const FString& UrlPattern, const FAccelByteRateLimitPolicy& Policy)
+{
+	FHttpRateLimiter::SetPolicy(UrlPattern, Policy);
+}
+
+bool FHttpRetryScheduler::RemoveRateLimitPolicy(const FString& UrlPattern)
+{
+	return FHttpRateLimiter::RemovePolicy(UrlPattern);
+}
+
 bool FHttpRetryScheduler::RemoveHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode)
 {
 	bool bResult = false;
@@ -238,24 +369,16 @@ void FHttpRetryScheduler::PauseBearerAuthRequest()
 {
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler PAUSED"));
 	State = EState::Paused;
-	TQueue<FAccelByteTaskPtr, EQueueMode::Spsc> TempQueue;
-	
-	while (FAccelByteTaskPtr *TaskPtr = TaskQueue.Peek())
-	{
-		FAccelByteTaskPtr Task = *TaskPtr;
-		
-		TaskQueue.Pop();
-		Task->Pause();
-		TempQueue.Enqueue(Task);
-	}
 
-	while (FAccelByteTaskPtr *TaskPtr = TempQueue.Peek())
+	DrainIncomingTasks();
+	for (const FScheduledTask& Scheduled : ScheduledTasks)
 	{
-		FAccelByteTaskPtr Task = *TaskPtr;
-		
-		TempQueue.Pop();
-		TaskQueue.Enqueue(Task);
+		if (Scheduled.Task->ScheduledTime == Scheduled.Time)
+		{
+			Scheduled.Task->Pause();
+		}
 	}
+	RescheduleAll();
 }
   
 void FHttpRetryScheduler::ResumeBearerAuthRequest(const FString& AccessToken)
@@ -271,61 +394,273 @@ void FHttpRetryScheduler::ResumeBearerAuthRequest(const FString& AccessToken)
 	{
 		State = EState::Initialized;
 	}
+
+	// Resumed tasks want to retry right away instead of at their pause timeout.
+	RescheduleAll();
 }
 
-bool FHttpRetryScheduler::PollRetry(double Time)
+bool FHttpRetryScheduler::TryCoalesceRequest(const FAccelByteTaskPtr& Task, const FHttpRequestPtr& Request)
 {
-#ifdef ACCELBYTE_ACTIVATE_PROFILER
-	TRACE_CPUPROFILER_EVENT_SCOPE_STR(TEXT("AccelBytePollRetryScheduler"));
-#endif
-	if (TaskQueue.IsEmpty())
+	if (!bEnableRequestCoalescing || !Request->GetVerb().Equals(TEXT("GET"), ESearchCase::IgnoreCase))
 	{
 		return false;
 	}
 
-	TArray<FAccelByteTaskPtr> RemovedTasks;
-	bool Loop = true;
-	do
+	const FName Key = Core::FAccelByteHttpCache::ConstructKey(Request);
+	const FString Authorization = Request->GetHeader(TEXT("Authorization"));
+
+	FScopeLock Lock(&InFlightRequestsLock);
+	if (FInFlightRequest* InFlight = InFlightRequests.Find(Key))
+	{
+		if (InFlight->Authorization == Authorization)
+		{
+			UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Request coalesced into an identical request in flight %s"), *Request->GetURL());
+			if (InFlight->Followers.Num() == 0)
+			{
+				CoalescingStats.SharedResponses++;
+			}
+			InFlight->Followers.Add(Task);
+			CoalescingStats.CoalescedRequests++;
+			return true;
+		}
+		// Different caller, sent on its own and not registered so the first request keeps the entry.
+		return false;
+	}
+
+	InFlightRequests.Emplace(Key, FInFlightRequest{ Task, Authorization, {} });
+	CoalescingStats.InFlightRequests = InFlightRequests.Num();
+	StaticCastSharedPtr< FHttpRetryTask >(Task)->SetCoalescingKey(Key);
+	return false;
+}
+
+void FHttpRetryScheduler::CompleteCoalescedRequests(const FAccelByteTaskPtr& Task)
+{
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	const FName Key = HttpRetryTaskPtr->GetCoalescingKey();
+	if (Key.IsNone())
 	{
-		FAccelByteTaskPtr *TaskPtr = TaskQueue.Peek();
-		if (TaskPtr != nullptr)
+		return;
+	}
+
+	TArray<FAccelByteTaskPtr> Followers;
+	TArray<FAccelByteTaskPtr> CancelledFollowers;
+	FAccelByteTaskPtr PromotedLeader;
+	{
+		FScopeLock Lock(&InFlightRequestsLock);
+		FInFlightRequest* InFlight = InFlightRequests.Find(Key);
+		if (InFlight == nullptr || InFlight->Leader != Task)
 		{
-			FAccelByteTaskPtr Task = *TaskPtr;
+			return;
+		}
 
-			if (Task->Time() < Time)
+		// Followers cancelled by their own caller keep their own outcome.
+		for (const FAccelByteTaskPtr& Follower : InFlight->Followers)
+		{
+			if (Follower->bIsFinished)
 			{
-				TaskQueue.Pop();
-
-				bool WillBeRemoved = false;
-				Task->Tick(Time);
-
-				switch (Task->State())
-				{
-				case EAccelByteTaskState::Completed:
-				case EAccelByteTaskState::Cancelled:
-				case EAccelByteTaskState::Failed:
-					RemovedTasks.Add(Task);
-					WillBeRemoved = true;
-					break;
-				default:
-					break;
-				}
-
-				if (!WillBeRemoved)
-				{
-					TaskQueue.Enqueue(Task);
-				}
+				continue;
 			}
-			else
+			if (Follower->State() == EAccelByteTaskState::Cancelled
+				|| Follower->Token->IsCancelRequested()
+				|| Follower->Token->IsCancelled())
 			{
-				Loop = false;
+				CancelledFollowers.Add(Follower);
+				continue;
 			}
+			Followers.Add(Follower);
+		}
+
+		// A cancelled leader was only cancelled for its own caller, the first live follower sends the request for the rest.
+		// With every follower cancelled as well the entry is dropped, nobody is waiting for the response anymore.
+		if (Task->State() == EAccelByteTaskState::Cancelled && Followers.Num() > 0)
+		{
+			PromotedLeader = Followers[0];
+			Followers.RemoveAt(0);
+			InFlight->Leader = PromotedLeader;
+			InFlight->Followers = Followers;
+			Followers.Empty();
+			StaticCastSharedPtr< FHttpRetryTask >(PromotedLeader)->SetCoalescingKey(Key);
 		}
 		else
 		{
-			Loop = false;
+			InFlightRequests.Remove(Key);
+			CoalescingStats.InFlightRequests = InFlightRequests.Num();
 		}
-	} while (Loop);
+	}
+
+	for (const FAccelByteTaskPtr& Follower : CancelledFollowers)
+	{
+		Follower->Cancel();
+		Follower->Finish();
+	}
+
+	if (PromotedLeader.IsValid())
+	{
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Coalesced request was cancelled, sending it again for the remaining callers %s"), *HttpRetryTaskPtr->GetHttpRequest()->GetURL());
+		const FHttpRequestPtr Request = StaticCastSharedPtr< FHttpRetryTask >(PromotedLeader)->GetHttpRequest();
+		if (RateLimiter.AcquireOrQueue(PromotedLeader, Request->GetURL(), FPlatformTime::Seconds()))
+		{
+			StartTask(PromotedLeader);
+		}
+		return;
+	}
+
+	for (const FAccelByteTaskPtr& Follower : Followers)
+	{
+		StaticCastSharedPtr< FHttpRetryTask >(Follower)->FinishFromCoalesced(*HttpRetryTaskPtr);
+	}
+}
+
+FAccelByteHttpCoalescingStats FHttpRetryScheduler::GetCoalescingStats() const
+{
+	FScopeLock Lock(&InFlightRequestsLock);
+	return CoalescingStats;
+}
+
+void FHttpRetryScheduler::StartTask(const FAccelByteTaskPtr& Task)
+{
+	// Cancelled while it waited for a rate limit token or for its coalesced leader, don't send it.
+	if (Task->State() == EAccelByteTaskState::Cancelled || Task->Token->IsCancelRequested())
+	{
+		// Ticked once more so the cancellation reaches the caller.
+		Task->Cancel();
+		TaskQueue.Enqueue(Task);
+		return;
+	}
+
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	if (State == EState::Paused && HttpRetryTaskPtr->GetHttpRequest()->GetHeader("Authorization").Contains("Bearer"))
+	{
+		Task->Pause();
+	}
+	else
+	{
+		Task->Start();
+	}
+	TaskQueue.Enqueue(Task);
+}
+
+void FHttpRetryScheduler::PollRateLimiter(double Time)
+{
+	RateLimiterPollTime = RateLimiter.Poll(Time
+		, FHttpRateLimiter::FOnTaskReleased::CreateRaw(this, &FHttpRetryScheduler::StartTask)
+		, FHttpRateLimiter::FOnTaskReleased::CreateLambda([this](const FAccelByteTaskPtr& Task)
+			{
+				// Ticked once more so the cancellation reaches the caller.
+				Task->Cancel();
+				TaskQueue.Enqueue(Task);
+			}));
+}
+
+void FHttpRetryScheduler::UpdateNextPollTime()
+{
+	NextPollTime = FMath::Min(ScheduledTasks.Num() > 0 ? ScheduledTasks.HeapTop().Time : MAX_dbl, RateLimiterPollTime);
+}
+
+void FHttpRetryScheduler::ScheduleTask(const FAccelByteTaskPtr& Task, double Time)
+{
+	Task->ScheduledTime = Time;
+	ScheduledTasks.HeapPush(FScheduledTask{ Time, Task });
+	NextPollTime = FMath::Min(NextPollTime, Time);
+}
+
+void FHttpRetryScheduler::DrainIncomingTasks()
+{
+	FAccelByteTaskPtr Task;
+	while (TaskQueue.Dequeue(Task))
+	{
+		ScheduleTask(Task, Task->NextTickTime());
+	}
+}
+
+void FHttpRetryScheduler::RescheduleAll()
+{
+	// Drop stale entries and pick up deadlines that changed outside of a tick.
+	TArray<FScheduledTask> Tasks;
+	Tasks.Reserve(ScheduledTasks.Num());
+	for (FScheduledTask& Scheduled : ScheduledTasks)
+	{
+		if (Scheduled.Task->ScheduledTime == Scheduled.Time)
+		{
+			Scheduled.Time = Scheduled.Task->NextTickTime();
+			Scheduled.Task->ScheduledTime = Scheduled.Time;
+			Tasks.Add(MoveTemp(Scheduled));
+		}
+	}
+	Tasks.Heapify();
+	ScheduledTasks = MoveTemp(Tasks);
+	UpdateNextPollTime();
+}
+
+bool FHttpRetryScheduler::PollRetry(double Time)
+{
+	// Early out without touching the heap, this runs every frame.
+	if (Time < NextPollTime && TaskQueue.IsEmpty() && ReadyTasks->IsEmpty() && !RateLimiter.HasIncoming())
+	{
+		return false;
+	}
+
+#ifdef ACCELBYTE_ACTIVATE_PROFILER
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(TEXT("AccelBytePollRetryScheduler"));
+#endif
+
+	PollRateLimiter(Time);
+	DrainIncomingTasks();
+
+	TArray<FAccelByteTaskPtr> DueTasks;
+
+	FAccelByteTaskWPtr ReadyTaskWPtr;
+	while (ReadyTasks->Dequeue(ReadyTaskWPtr))
+	{
+		FAccelByteTaskPtr Task = ReadyTaskWPtr.Pin();
+		// Invalidate the heap entry, the task is rescheduled after its tick.
+		if (Task.IsValid() && Task->ScheduledTime >= 0.0)
+		{
+			Task->ScheduledTime = -1.0;
+			DueTasks.Add(Task);
+		}
+	}
+
+	while (ScheduledTasks.Num() > 0 && ScheduledTasks.HeapTop().Time <= Time)
+	{
+		FScheduledTask Scheduled;
+		ScheduledTasks.HeapPop(Scheduled);
+		if (Scheduled.Task->ScheduledTime == Scheduled.Time)
+		{
+			Scheduled.Task->ScheduledTime = -1.0;
+			DueTasks.Add(MoveTemp(Scheduled.Task));
+		}
+	}
+
+	TArray<FAccelByteTaskPtr> RemovedTasks;
+	for (const FAccelByteTaskPtr& Task : DueTasks)
+	{
+		// A callback of a previous task may have paused the scheduler, don't resend with the rejected token.
+		if (State == EState::Paused && Task->State() == EAccelByteTaskState::Retrying
+			&& StaticCastSharedPtr< FHttpRetryTask >(Task)->GetHttpRequest()->GetHeader("Authorization").Contains("Bearer"))
+		{
+			Task->Pause();
+			ScheduleTask(Task, Task->NextTickTime());
+			continue;
+		}
+
+		Task->Tick(Time);
+
+		switch (Task->State())
+		{
+		case EAccelByteTaskState::Completed:
+		case EAccelByteTaskState::Cancelled:
+		case EAccelByteTaskState::Failed:
+			RemovedTasks.Add(Task);
+			break;
+		default:
+			// Pushed after the heap was drained, so a task that is due again right away waits for the next poll.
+			ScheduleTask(Task, Task->NextTickTime());
+			break;
+		}
+	}
+
+	UpdateNextPollTime();
 
 	const bool bIsHttpCacheEnabled = UAccelByteBlueprintsSettings::IsHttpCacheEnabled();
 	for (auto& Task : RemovedTasks)
@@ -337,23 +672,18 @@ bool FHttpRetryScheduler::PollRetry(double Time)
 		}
 		
 		Task->Finish();
+		CompleteCoalescedRequests(Task);
 	}
 
-	return true;
+	return DueTasks.Num() > 0;
 }
 
 void FHttpRetryScheduler::Startup()
 {
 	InitializeRateLimit();
-	
-	PollRetryHandle = FTickerAlias::GetCoreTicker().AddTicker(
-        FTickerDelegate::CreateLambda([this](float DeltaTime)
-        {
-            PollRetry(FPlatformTime::Seconds());
-
-            return true;
-        }),
-        0.2f);
+	InitializeRequestCoalescing();
+	InitializeSharedPolling();
+	StartPolling();
 
 	State = EState::Initialized;
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler has been INITIALIZED"));
@@ -365,23 +695,26 @@ void FHttpRetryScheduler::Shutdown()
 {
 	State = EState::ShuttingDown;
 
-	if (PollRetryHandle.IsValid())
 	{
-		// Core ticker by this point in engine shutdown has already been torn down - only remove ticker if this is not an engine shutdown
-		if (!IsEngineExitRequested())
-		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(PollRetryHandle);
-		}
-		PollRetryHandle.Reset();
+		FScopeLock Lock(&InFlightRequestsLock);
+		InFlightRequests.Empty();
+		CoalescingStats.InFlightRequests = 0;
 	}
 
+	StopPolling();
+
 	// flush http requests
-	if (!TaskQueue.IsEmpty())
+	if (!TaskQueue.IsEmpty() || ScheduledTasks.Num() > 0)
 	{
 		// Don't flush if we're on the game thread, and we're not exiting, as it causes stutters.
 		if (IsInGameThread() && !IsEngineExitRequested())
 		{
 			TaskQueue.Empty();
+			ScheduledTasks.Empty();
+			ReadyTasks->Empty();
+			RateLimiter.Empty();
+			RateLimiterPollTime = MAX_dbl;
+			NextPollTime = MAX_dbl;
 			return;
 		}
 
@@ -405,6 +738,11 @@ void FHttpRetryScheduler::Shutdown()
 
 		// cancel unfinished http requests, so don't hinder the shutdown
 		TaskQueue.Empty();
+		ScheduledTasks.Empty();
+		ReadyTasks->Empty();
+		RateLimiter.Empty();
+		RateLimiterPollTime = MAX_dbl;
+		NextPollTime = MAX_dbl;
 	}
 }
 
@@ -61,9 +61,17 @@ namespace AccelByte
 			return false;
 		}
 
+		const bool bWasWaiting = TaskState == EAccelByteTaskState::Paused || TaskState == EAccelByteTaskState::Retrying;
+
 		Request->CancelRequest();
 		TaskState = EAccelByteTaskState::Cancelled;
 
+		// No request completion will wake the scheduler, ask for a tick so the caller hears about it right away.
+		if (bWasWaiting)
+		{
+			OnRequestCompleted.ExecuteIfBound();
+		}
+
 		return FAccelByteTask::Cancel();
 	}
 
@@ -234,6 +242,24 @@ namespace AccelByte
 		TaskState = NextState;
 	}
 
+	double FHttpRetryTask::NextTickTime() const
+	{
+		switch (TaskState)
+		{
+		// Capped like running requests so a cancellation requested through the token is noticed soon.
+		case EAccelByteTaskState::Retrying:
+			return FMath::Min(NextRetryTime, TaskTime + FHttpRetryScheduler::MaxRunningTickInterval);
+		case EAccelByteTaskState::Paused:
+			return FMath::Min(PauseTime + FHttpRetryScheduler::PauseTimeout - PauseDuration, TaskTime + FHttpRetryScheduler::MaxRunningTickInterval);
+		case EAccelByteTaskState::Running:
+			// Completion wakes the scheduler through OnRequestCompleted, this is only the timeout check.
+			// Capped so a request that never reports completion is still noticed.
+			return FMath::Min(RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout, TaskTime + FHttpRetryScheduler::MaxRunningTickInterval);
+		default:
+			return TaskTime;
+		}
+	}
+
 	bool FHttpRetryTask::Finish()
 	{
 		if (TaskState == EAccelByteTaskState::Running)
@@ -261,6 +287,28 @@ namespace AccelByte
 		return FAccelByteTask::Finish();
 	}
 
+	bool FHttpRetryTask::FinishFromCoalesced(FHttpRetryTask& Leader)
+	{
+		// Cancelled by its own caller while waiting, the leader's outcome is not this Task's.
+		if (bIsFinished)
+		{
+			return false;
+		}
+		if (TaskState == EAccelByteTaskState::Cancelled)
+		{
+			return Finish();
+		}
+
+		TaskState = Leader.TaskState;
+		ResponseTime = Leader.ResponseTime;
+
+		const FHttpResponsePtr Response = Leader.Request.IsValid() ? Leader.Request->GetResponse() : nullptr;
+		FReport::LogHttpResponse(Request, Response);
+		CompleteDelegate.ExecuteIfBound(Request, Response, Leader.Request.IsValid() && Leader.IsFinished());
+
+		return FAccelByteTask::Finish();
+	}
+
 	void FHttpRetryTask::InitializeDefaultDelegates()
 	{
 		ResponseCodeDelegates = {
@@ -413,5 +461,6 @@ namespace AccelByte
 		bool bConnectedSuccessfully)
 	{
 		SetResponseTime(FDateTime::UtcNow());
+		OnRequestCompleted.ExecuteIfBound();
 	}
 }
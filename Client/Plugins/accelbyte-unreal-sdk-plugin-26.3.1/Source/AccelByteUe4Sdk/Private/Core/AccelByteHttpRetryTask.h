@@ -29,9 +29,15 @@ namespace AccelByte
 		virtual bool Start() override;
 		virtual bool Cancel() override;
 		virtual void Tick(double CurrentTime) override;
+		virtual double NextTickTime() const override;
 		virtual bool Finish() override;
 		bool FinishFromCached(const FHttpResponsePtr& Response);
 
+		/**
+		 * @brief Finish with the outcome of an identical request this Task was coalesced into, without sending its own request.
+		 */
+		bool FinishFromCoalesced(FHttpRetryTask& Leader);
+
 		virtual EAccelByteTaskState Pause() override;
 
 		FHttpRequestPtr GetHttpRequest() const { return Request; };
@@ -43,6 +49,15 @@ namespace AccelByte
 
 		bool IsResponseFromCache() { return bIsResponseFromCache; };
 
+		/**
+		 * @brief Called when the underlying request completes, possibly off the game thread, so the scheduler can tick the Task right away.
+		 */
+		void SetOnRequestCompleted(const FSimpleDelegate& InOnRequestCompleted) { OnRequestCompleted = InOnRequestCompleted; }
+
+		/** Key of the in-flight entry other requests are coalesced into, NAME_None if there is none. */
+		void SetCoalescingKey(const FName& InCoalescingKey) { CoalescingKey = InCoalescingKey; }
+		FName GetCoalescingKey() const { return CoalescingKey; }
+
 	private:
 		FHttpRequestPtr Request{};
 		const FHttpRequestCompleteDelegate CompleteDelegate{};
@@ -58,6 +73,8 @@ namespace AccelByte
 		TMap<int32, FHttpRetryScheduler::FHttpResponseCodeHandler> ResponseCodeDelegates{};
 		FDateTime ResponseTime{0};
 		bool bIsResponseFromCache{false};
+		FSimpleDelegate OnRequestCompleted{};
+		FName CoalescingKey{NAME_None};
 
 		void InitializeDefaultDelegates();
 		void BearerAuthUpdated(const FString& AccessToken);
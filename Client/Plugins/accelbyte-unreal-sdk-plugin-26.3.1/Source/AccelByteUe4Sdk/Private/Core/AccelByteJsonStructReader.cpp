@@ -0,0 +1,852 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteJsonStructReader.h"
+#include "JsonObjectWrapper.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	using EResult = FAccelByteJsonStructReader::EResult;
+
+	constexpr int32 MaxDepth = 64;
+	constexpr int32 MaxNumberLength = 64;
+	/** Largest magnitude below which every integer is exact in a double. */
+	constexpr double MaxExactDouble = 9007199254740992.0;
+
+	/**
+	 * @brief Properties of a struct by name, matched case-insensitively like FJsonObjectConverter does.
+	 */
+	struct FStructLookup
+	{
+		TMap<FString, FProperty*> Properties;
+	};
+
+	FRWLock LookupCacheLock;
+	TMap<const UStruct*, TSharedRef<FStructLookup, ESPMode::ThreadSafe>> LookupCache;
+
+	TSharedRef<FStructLookup, ESPMode::ThreadSafe> GetStructLookup(const UStruct* Definition)
+	{
+		{
+			FReadScopeLock ReadLock(LookupCacheLock);
+			if (const TSharedRef<FStructLookup, ESPMode::ThreadSafe>* Found = LookupCache.Find(Definition))
+			{
+				return *Found;
+			}
+		}
+
+		TSharedRef<FStructLookup, ESPMode::ThreadSafe> Lookup = MakeShared<FStructLookup, ESPMode::ThreadSafe>();
+		for (TFieldIterator<FProperty> PropertyIt(Definition); PropertyIt; ++PropertyIt)
+		{
+			Lookup->Properties.Add(PropertyIt->GetName(), *PropertyIt);
+		}
+
+		FWriteScopeLock WriteLock(LookupCacheLock);
+		return LookupCache.FindOrAdd(Definition, Lookup);
+	}
+
+	void AppendRun(FString& Out, const TCHAR* Start, int32 Length)
+	{
+		Out.AppendChars(Start, Length);
+	}
+
+	void AppendRun(FString& Out, const ANSICHAR* Start, int32 Length)
+	{
+		FUTF8ToTCHAR Converter(Start, Length);
+		Out.AppendChars(Converter.Get(), Converter.Length());
+	}
+
+	template<typename CharType>
+	class TJsonStructReader
+	{
+	public:
+		TJsonStructReader(const CharType* InJson, int32 InLength)
+			: Cur(InJson)
+			, End(InJson + InLength)
+		{
+		}
+
+		EResult ReadRootObject(const UStruct* Definition, void* OutStruct)
+		{
+			SkipWhitespace();
+			EResult Result = ReadObject(Definition, OutStruct, 0);
+			return Result == EResult::Success ? ExpectEnd() : Result;
+		}
+
+		EResult ReadRootArray(const UStruct* ElementDefinition, TFunctionRef<void*()> AddElement)
+		{
+			SkipWhitespace();
+			if (!Consume('['))
+			{
+				return EResult::Unsupported;
+			}
+
+			SkipWhitespace();
+			if (Consume(']'))
+			{
+				return ExpectEnd();
+			}
+
+			while (true)
+			{
+				SkipWhitespace();
+				EResult Result = ReadObject(ElementDefinition, AddElement(), 1);
+				if (Result != EResult::Success)
+				{
+					return Result;
+				}
+
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				if (Consume(']'))
+				{
+					return ExpectEnd();
+				}
+				return EResult::Malformed;
+			}
+		}
+
+	private:
+		const CharType* Cur;
+		const CharType* End;
+		FString KeyBuffer;
+		FString StringBuffer;
+		FString RawBuffer;
+
+		bool IsEnd() const
+		{
+			return Cur >= End;
+		}
+
+		CharType Peek() const
+		{
+			return IsEnd() ? CharType(0) : *Cur;
+		}
+
+		bool Consume(ANSICHAR Char)
+		{
+			if (!IsEnd() && *Cur == Char)
+			{
+				++Cur;
+				return true;
+			}
+			return false;
+		}
+
+		bool ConsumeLiteral(const ANSICHAR* Literal)
+		{
+			const CharType* Start = Cur;
+			for (; *Literal != '\0'; ++Literal)
+			{
+				if (!Consume(*Literal))
+				{
+					Cur = Start;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		void SkipWhitespace()
+		{
+			while (!IsEnd() && (*Cur == ' ' || *Cur == '\t' || *Cur == '\n' || *Cur == '\r'))
+			{
+				++Cur;
+			}
+		}
+
+		EResult ExpectEnd()
+		{
+			SkipWhitespace();
+			return IsEnd() ? EResult::Success : EResult::Malformed;
+		}
+
+		static int32 HexValue(CharType Char)
+		{
+			if (Char >= '0' && Char <= '9')
+			{
+				return Char - '0';
+			}
+			if (Char >= 'a' && Char <= 'f')
+			{
+				return Char - 'a' + 10;
+			}
+			if (Char >= 'A' && Char <= 'F')
+			{
+				return Char - 'A' + 10;
+			}
+			return INDEX_NONE;
+		}
+
+		EResult ReadString(FString& Out)
+		{
+			if (!Consume('"'))
+			{
+				return EResult::Malformed;
+			}
+
+			Out.Reset();
+			while (true)
+			{
+				const CharType* RunStart = Cur;
+				while (!IsEnd() && *Cur != '"' && *Cur != '\\')
+				{
+					++Cur;
+				}
+				if (Cur > RunStart)
+				{
+					AppendRun(Out, RunStart, static_cast<int32>(Cur - RunStart));
+				}
+
+				if (IsEnd())
+				{
+					return EResult::Malformed;
+				}
+				if (Consume('"'))
+				{
+					return EResult::Success;
+				}
+
+				++Cur; // Backslash
+				if (IsEnd())
+				{
+					return EResult::Malformed;
+				}
+
+				const CharType Escape = *Cur++;
+				switch (Escape)
+				{
+				case '"': Out.AppendChar(TEXT('"')); break;
+				case '\\': Out.AppendChar(TEXT('\\')); break;
+				case '/': Out.AppendChar(TEXT('/')); break;
+				case 'b': Out.AppendChar(TEXT('\b')); break;
+				case 'f': Out.AppendChar(TEXT('\f')); break;
+				case 'n': Out.AppendChar(TEXT('\n')); break;
+				case 'r': Out.AppendChar(TEXT('\r')); break;
+				case 't': Out.AppendChar(TEXT('\t')); break;
+				case 'u':
+				{
+					if (End - Cur < 4)
+					{
+						return EResult::Malformed;
+					}
+					int32 CodeUnit = 0;
+					for (int32 Index = 0; Index < 4; Index++)
+					{
+						const int32 Digit = HexValue(*Cur++);
+						if (Digit == INDEX_NONE)
+						{
+							return EResult::Malformed;
+						}
+						CodeUnit = (CodeUnit << 4) | Digit;
+					}
+					// Surrogate halves are appended one by one, the same way the DOM reader does
+					Out.AppendChar(static_cast<TCHAR>(CodeUnit));
+					break;
+				}
+				default:
+					return EResult::Malformed;
+				}
+			}
+		}
+
+		bool IsDigit() const
+		{
+			const CharType Char = Peek();
+			return Char >= '0' && Char <= '9';
+		}
+
+		bool TakeNumberChar(TCHAR* Buffer, int32& Length)
+		{
+			if (Length == MaxNumberLength)
+			{
+				return false;
+			}
+			Buffer[Length++] = static_cast<TCHAR>(*Cur++);
+			return true;
+		}
+
+		/**
+		 * @brief Copy a number following the JSON grammar into Buffer, which holds MaxNumberLength + 1 characters.
+		 *
+		 * @param bOutIsInteger Whether the number has neither a fraction nor an exponent.
+		 */
+		EResult ReadNumberText(TCHAR* Buffer, bool& bOutIsInteger)
+		{
+			int32 Length = 0;
+			if (Peek() == '-' && !TakeNumberChar(Buffer, Length))
+			{
+				return EResult::Unsupported;
+			}
+			if (!IsDigit())
+			{
+				return EResult::Malformed;
+			}
+
+			// A leading zero is the whole integer part, the grammar has no octal or padded integers
+			if (Peek() == '0')
+			{
+				TakeNumberChar(Buffer, Length);
+				if (IsDigit())
+				{
+					return EResult::Malformed;
+				}
+			}
+			while (IsDigit())
+			{
+				if (!TakeNumberChar(Buffer, Length))
+				{
+					return EResult::Unsupported;
+				}
+			}
+
+			bOutIsInteger = true;
+			if (Peek() == '.')
+			{
+				bOutIsInteger = false;
+				if (!TakeNumberChar(Buffer, Length))
+				{
+					return EResult::Unsupported;
+				}
+				if (!IsDigit())
+				{
+					return EResult::Malformed;
+				}
+				while (IsDigit())
+				{
+					if (!TakeNumberChar(Buffer, Length))
+					{
+						return EResult::Unsupported;
+					}
+				}
+			}
+
+			if (Peek() == 'e' || Peek() == 'E')
+			{
+				bOutIsInteger = false;
+				if (!TakeNumberChar(Buffer, Length))
+				{
+					return EResult::Unsupported;
+				}
+				if ((Peek() == '+' || Peek() == '-') && !TakeNumberChar(Buffer, Length))
+				{
+					return EResult::Unsupported;
+				}
+				if (!IsDigit())
+				{
+					return EResult::Malformed;
+				}
+				while (IsDigit())
+				{
+					if (!TakeNumberChar(Buffer, Length))
+					{
+						return EResult::Unsupported;
+					}
+				}
+			}
+
+			Buffer[Length] = TEXT('\0');
+			return EResult::Success;
+		}
+
+		EResult ReadNumber(double& OutNumber)
+		{
+			TCHAR Buffer[MaxNumberLength + 1];
+			bool bIsInteger = false;
+			EResult Result = ReadNumberText(Buffer, bIsInteger);
+			if (Result == EResult::Success)
+			{
+				OutNumber = FCString::Atod(Buffer);
+			}
+			return Result;
+		}
+
+		/**
+		 * @brief Read an integer without going through double, which only holds 53 bits exactly.
+		 */
+		EResult ReadInteger(FNumericProperty* Property, void* OutValue)
+		{
+			TCHAR Buffer[MaxNumberLength + 1];
+			bool bIsInteger = false;
+			EResult Result = ReadNumberText(Buffer, bIsInteger);
+			if (Result != EResult::Success)
+			{
+				return Result;
+			}
+
+			if (!bIsInteger)
+			{
+				// Engine versions disagree on rounding fractional values into integers
+				const double Number = FCString::Atod(Buffer);
+				const int64 IntValue = static_cast<int64>(Number);
+				if (static_cast<double>(IntValue) != Number || FMath::Abs(Number) > MaxExactDouble)
+				{
+					return EResult::Unsupported;
+				}
+				Property->SetIntPropertyValue(OutValue, IntValue);
+				return EResult::Success;
+			}
+
+			bool bNegative = false;
+			uint64 Magnitude = 0;
+			if (!ParseInteger(Buffer, bNegative, Magnitude))
+			{
+				return EResult::Unsupported;
+			}
+
+			if (!bNegative && IsUnsignedProperty(Property))
+			{
+				Property->SetIntPropertyValue(OutValue, Magnitude);
+				return EResult::Success;
+			}
+
+			int64 Value = 0;
+			if (!ToSigned(bNegative, Magnitude, Value))
+			{
+				return EResult::Unsupported;
+			}
+			Property->SetIntPropertyValue(OutValue, Value);
+			return EResult::Success;
+		}
+
+		/**
+		 * @brief Split an integer literal checked by ReadNumberText into its sign and magnitude.
+		 *
+		 * @return False when the magnitude does not fit 64 bits.
+		 */
+		static bool ParseInteger(const TCHAR* Buffer, bool& bOutNegative, uint64& OutMagnitude)
+		{
+			bOutNegative = Buffer[0] == TEXT('-');
+			OutMagnitude = 0;
+			for (const TCHAR* Digit = Buffer + (bOutNegative ? 1 : 0); *Digit != TEXT('\0'); ++Digit)
+			{
+				const uint64 DigitValue = static_cast<uint64>(*Digit - TEXT('0'));
+				if (OutMagnitude > (MAX_uint64 - DigitValue) / 10)
+				{
+					return false;
+				}
+				OutMagnitude = OutMagnitude * 10 + DigitValue;
+			}
+			return true;
+		}
+
+		static bool ToSigned(bool bNegative, uint64 Magnitude, int64& OutValue)
+		{
+			if (Magnitude > static_cast<uint64>(MAX_int64) + (bNegative ? 1 : 0))
+			{
+				return false;
+			}
+			// Negating the magnitude as unsigned keeps MIN_int64 representable
+			OutValue = bNegative ? static_cast<int64>(0 - Magnitude) : static_cast<int64>(Magnitude);
+			return true;
+		}
+
+		static bool IsUnsignedProperty(const FNumericProperty* Property)
+		{
+			return Property->IsA<FByteProperty>() || Property->IsA<FUInt16Property>()
+				|| Property->IsA<FUInt32Property>() || Property->IsA<FUInt64Property>();
+		}
+
+		bool IsNumberStart() const
+		{
+			const CharType Char = Peek();
+			return Char == '-' || (Char >= '0' && Char <= '9');
+		}
+
+		EResult SkipValue(int32 Depth)
+		{
+			if (Depth > MaxDepth)
+			{
+				return EResult::Unsupported;
+			}
+
+			const CharType Char = Peek();
+			if (Char == '"')
+			{
+				return ReadString(StringBuffer);
+			}
+			if (IsNumberStart())
+			{
+				TCHAR Ignored[MaxNumberLength + 1];
+				bool bIsInteger = false;
+				return ReadNumberText(Ignored, bIsInteger);
+			}
+			if (ConsumeLiteral("true") || ConsumeLiteral("false") || ConsumeLiteral("null"))
+			{
+				return EResult::Success;
+			}
+
+			const bool bObject = Consume('{');
+			if (!bObject && !Consume('['))
+			{
+				return EResult::Malformed;
+			}
+
+			const ANSICHAR Close = bObject ? '}' : ']';
+			SkipWhitespace();
+			if (Consume(Close))
+			{
+				return EResult::Success;
+			}
+
+			while (true)
+			{
+				SkipWhitespace();
+				if (bObject)
+				{
+					if (ReadString(KeyBuffer) != EResult::Success)
+					{
+						return EResult::Malformed;
+					}
+					SkipWhitespace();
+					if (!Consume(':'))
+					{
+						return EResult::Malformed;
+					}
+					SkipWhitespace();
+				}
+
+				EResult Result = SkipValue(Depth + 1);
+				if (Result != EResult::Success)
+				{
+					return Result;
+				}
+
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				return Consume(Close) ? EResult::Success : EResult::Malformed;
+			}
+		}
+
+		EResult ReadObject(const UStruct* Definition, void* OutStruct, int32 Depth)
+		{
+			if (Depth > MaxDepth || Definition == nullptr || Definition == FJsonObjectWrapper::StaticStruct())
+			{
+				return EResult::Unsupported;
+			}
+			if (!Consume('{'))
+			{
+				return Peek() == '[' || Peek() == '"' || IsNumberStart() || Peek() == 'n' || Peek() == 't' || Peek() == 'f'
+					? EResult::Unsupported
+					: EResult::Malformed;
+			}
+
+			const TSharedRef<FStructLookup, ESPMode::ThreadSafe> Lookup = GetStructLookup(Definition);
+
+			SkipWhitespace();
+			if (Consume('}'))
+			{
+				return EResult::Success;
+			}
+
+			while (true)
+			{
+				SkipWhitespace();
+				if (ReadString(KeyBuffer) != EResult::Success)
+				{
+					return EResult::Malformed;
+				}
+				SkipWhitespace();
+				if (!Consume(':'))
+				{
+					return EResult::Malformed;
+				}
+				SkipWhitespace();
+
+				EResult Result = EResult::Success;
+				if (FProperty* const* Property = Lookup->Properties.Find(KeyBuffer))
+				{
+					Result = ReadProperty(*Property, (*Property)->ContainerPtrToValuePtr<void>(OutStruct), Depth + 1);
+				}
+				else
+				{
+					Result = SkipValue(Depth + 1);
+				}
+				if (Result != EResult::Success)
+				{
+					return Result;
+				}
+
+				SkipWhitespace();
+				if (Consume(','))
+				{
+					continue;
+				}
+				return Consume('}') ? EResult::Success : EResult::Malformed;
+			}
+		}
+
+		EResult ReadEnum(const UEnum* Enum, FNumericProperty* UnderlyingProperty, void* OutValue)
+		{
+			if (Enum == nullptr || UnderlyingProperty == nullptr)
+			{
+				return EResult::Unsupported;
+			}
+
+			int64 Value = INDEX_NONE;
+			if (Peek() == '"')
+			{
+				EResult Result = ReadString(StringBuffer);
+				if (Result != EResult::Success)
+				{
+					return Result;
+				}
+				Value = Enum->GetValueByName(FName(*StringBuffer));
+				if (Value == INDEX_NONE)
+				{
+					return EResult::Unsupported;
+				}
+			}
+			else if (IsNumberStart())
+			{
+				TCHAR Buffer[MaxNumberLength + 1];
+				bool bIsInteger = false;
+				EResult Result = ReadNumberText(Buffer, bIsInteger);
+				if (Result != EResult::Success)
+				{
+					return Result;
+				}
+
+				bool bNegative = false;
+				uint64 Magnitude = 0;
+				if (!bIsInteger || !ParseInteger(Buffer, bNegative, Magnitude) || !ToSigned(bNegative, Magnitude, Value))
+				{
+					return EResult::Unsupported;
+				}
+				if (Enum->GetNameByValue(Value) == NAME_None)
+				{
+					return EResult::Unsupported;
+				}
+			}
+			else
+			{
+				return EResult::Unsupported;
+			}
+
+			UnderlyingProperty->SetIntPropertyValue(OutValue, Value);
+			return EResult::Success;
+		}
+
+		/**
+		 * @brief Read an FDateTime from its ISO 8601 string, other spellings are left to the DOM converter.
+		 */
+		EResult ReadDateTime(FDateTime* OutValue)
+		{
+			if (Peek() != '"')
+			{
+				return EResult::Unsupported;
+			}
+			EResult Result = ReadString(StringBuffer);
+			if (Result != EResult::Success)
+			{
+				return Result;
+			}
+			// The DOM converter also accepts "min", "max", "now" and FDateTime::Parse, none of which parse as ISO 8601
+			return FDateTime::ParseIso8601(*StringBuffer, *OutValue) ? EResult::Success : EResult::Unsupported;
+		}
+
+		/**
+		 * @brief Fill an FJsonObjectWrapper from the raw text of the object, the way the DOM converter does.
+		 */
+		EResult ReadJsonObjectWrapper(FJsonObjectWrapper* OutValue, int32 Depth)
+		{
+			if (Peek() != '{')
+			{
+				return EResult::Unsupported;
+			}
+
+			const CharType* Start = Cur;
+			EResult Result = SkipValue(Depth);
+			if (Result != EResult::Success)
+			{
+				return Result;
+			}
+
+			RawBuffer.Reset();
+			AppendRun(RawBuffer, Start, static_cast<int32>(Cur - Start));
+			if (!OutValue->JsonObjectFromString(RawBuffer))
+			{
+				return EResult::Malformed;
+			}
+			// Condensed like the DOM converter writes it, not the raw text with its original spacing
+			OutValue->JsonObjectToString(OutValue->JsonString);
+			return EResult::Success;
+		}
+
+		EResult ReadProperty(FProperty* Property, void* OutValue, int32 Depth)
+		{
+			if (Property->ArrayDim != 1)
+			{
+				return EResult::Unsupported;
+			}
+
+			// The DOM converter skips null fields and null array elements, the value keeps what it had
+			if (Peek() == 'n')
+			{
+				return ConsumeLiteral("null") ? EResult::Success : EResult::Malformed;
+			}
+
+			if (FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+			{
+				return Peek() == '"' ? ReadString(*StrProperty->GetPropertyValuePtr(OutValue)) : EResult::Unsupported;
+			}
+			if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+			{
+				if (Peek() != '"')
+				{
+					return EResult::Unsupported;
+				}
+				EResult Result = ReadString(StringBuffer);
+				if (Result == EResult::Success)
+				{
+					NameProperty->SetPropertyValue(OutValue, FName(*StringBuffer));
+				}
+				return Result;
+			}
+			if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+			{
+				if (Peek() != '"')
+				{
+					return EResult::Unsupported;
+				}
+				EResult Result = ReadString(StringBuffer);
+				if (Result == EResult::Success)
+				{
+					TextProperty->SetPropertyValue(OutValue, FText::FromString(StringBuffer));
+				}
+				return Result;
+			}
+			if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				if (ConsumeLiteral("true"))
+				{
+					BoolProperty->SetPropertyValue(OutValue, true);
+					return EResult::Success;
+				}
+				if (ConsumeLiteral("false"))
+				{
+					BoolProperty->SetPropertyValue(OutValue, false);
+					return EResult::Success;
+				}
+				return EResult::Unsupported;
+			}
+			if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+			{
+				return ReadEnum(EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty(), OutValue);
+			}
+			if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+			{
+				if (NumericProperty->IsEnum())
+				{
+					return ReadEnum(NumericProperty->GetIntPropertyEnum(), NumericProperty, OutValue);
+				}
+				if (!IsNumberStart())
+				{
+					return EResult::Unsupported;
+				}
+
+				if (!NumericProperty->IsFloatingPoint())
+				{
+					return ReadInteger(NumericProperty, OutValue);
+				}
+
+				double Number = 0.0;
+				EResult Result = ReadNumber(Number);
+				if (Result == EResult::Success)
+				{
+					NumericProperty->SetFloatingPointPropertyValue(OutValue, Number);
+				}
+				return Result;
+			}
+			if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (StructProperty->Struct == TBaseStructure<FDateTime>::Get())
+				{
+					return ReadDateTime(static_cast<FDateTime*>(OutValue));
+				}
+				if (StructProperty->Struct->IsChildOf(FJsonObjectWrapper::StaticStruct()))
+				{
+					return ReadJsonObjectWrapper(static_cast<FJsonObjectWrapper*>(OutValue), Depth);
+				}
+				return ReadObject(StructProperty->Struct, OutValue, Depth);
+			}
+			if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+			{
+				if (!Consume('['))
+				{
+					return EResult::Unsupported;
+				}
+
+				// Same as the DOM converter resizing the array: elements already there are read over in place, so their
+				// fields missing from the JSON keep their values, extra elements are removed at the end.
+				FScriptArrayHelper ArrayHelper(ArrayProperty, OutValue);
+				int32 Count = 0;
+
+				SkipWhitespace();
+				if (!Consume(']'))
+				{
+					while (true)
+					{
+						SkipWhitespace();
+						const int32 Index = Count < ArrayHelper.Num() ? Count : ArrayHelper.AddValue();
+						++Count;
+						EResult Result = ReadProperty(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index), Depth + 1);
+						if (Result != EResult::Success)
+						{
+							return Result;
+						}
+
+						SkipWhitespace();
+						if (Consume(','))
+						{
+							continue;
+						}
+						if (Consume(']'))
+						{
+							break;
+						}
+						return EResult::Malformed;
+					}
+				}
+
+				if (ArrayHelper.Num() > Count)
+				{
+					ArrayHelper.RemoveValues(Count, ArrayHelper.Num() - Count);
+				}
+				return EResult::Success;
+			}
+
+			return EResult::Unsupported;
+		}
+	};
+}
+
+FAccelByteJsonStructReader::EResult FAccelByteJsonStructReader::ReadObject(const TCHAR* Json, int32 Length, const UStruct* Definition, void* OutStruct)
+{
+	return TJsonStructReader<TCHAR>(Json, Length).ReadRootObject(Definition, OutStruct);
+}
+
+FAccelByteJsonStructReader::EResult FAccelByteJsonStructReader::ReadObject(const ANSICHAR* Utf8Json, int32 Length, const UStruct* Definition, void* OutStruct)
+{
+	return TJsonStructReader<ANSICHAR>(Utf8Json, Length).ReadRootObject(Definition, OutStruct);
+}
+
+FAccelByteJsonStructReader::EResult FAccelByteJsonStructReader::ReadArray(const TCHAR* Json, int32 Length, const UStruct* ElementDefinition, TFunctionRef<void*()> AddElement)
+{
+	return TJsonStructReader<TCHAR>(Json, Length).ReadRootArray(ElementDefinition, AddElement);
+}
+
+FAccelByteJsonStructReader::EResult FAccelByteJsonStructReader::ReadArray(const ANSICHAR* Utf8Json, int32 Length, const UStruct* ElementDefinition, TFunctionRef<void*()> AddElement)
+{
+	return TJsonStructReader<ANSICHAR>(Utf8Json, Length).ReadRootArray(ElementDefinition, AddElement);
+}
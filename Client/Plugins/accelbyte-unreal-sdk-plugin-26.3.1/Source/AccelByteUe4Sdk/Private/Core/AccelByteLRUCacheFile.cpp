@@ -0,0 +1,502 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteLRUCacheFile.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLRUCacheFile, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteLRUCacheFile);
+
+namespace AccelByte
+{
+namespace Core
+{
+
+namespace
+{
+	constexpr uint32 IndexFileMagic = 0x41424349; // ABCI
+	constexpr int32 IndexFileVersion = 1;
+
+	const FString IndexExtension = TEXT(".index");
+	const FString SegmentExtension = TEXT(".segment");
+	const FString LegacyCacheExtension = TEXT(".cache");
+}
+
+FAccelByteCacheFileStore::FAccelByteCacheFileStore(const FString& InDirectory, const FString& InPrefix)
+	: Directory(InDirectory)
+	, Prefix(InPrefix)
+{
+}
+
+FAccelByteCacheFileStore::~FAccelByteCacheFileStore()
+{
+	WaitForCompaction();
+
+	FScopeLock ScopeLock(&Lock);
+	FlushLocked();
+	ActiveSegmentHandle.Reset();
+}
+
+void FAccelByteCacheFileStore::WaitForCompaction()
+{
+	// Waited on outside the lock, the compaction takes it for every item it moves
+	TFuture<void> PendingCompaction;
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingCompaction = MoveTemp(Compaction);
+	}
+
+	if (PendingCompaction.IsValid())
+	{
+		PendingCompaction.Wait();
+	}
+}
+
+FString FAccelByteCacheFileStore::GetIndexPath() const
+{
+	return Directory / Prefix + IndexExtension;
+}
+
+FString FAccelByteCacheFileStore::GetSegmentPath(int32 Segment) const
+{
+	return Directory / FString::Printf(TEXT("%s_%d%s"), *Prefix, Segment, *SegmentExtension);
+}
+
+TArray<FAccelByteCacheFileIndexEntry> FAccelByteCacheFileStore::Load()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Index.Empty();
+	Segments.Empty();
+
+	TArray<uint8> IndexBytes;
+	if (!FFileHelper::LoadFileToArray(IndexBytes, *GetIndexPath(), FILEREAD_Silent))
+	{
+		RemoveLegacyFiles();
+		return {};
+	}
+
+	FMemoryReader Reader(IndexBytes);
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
+	if (Reader.IsError() || Magic != IndexFileMagic || Version != IndexFileVersion)
+	{
+		UE_LOG(LogAccelByteLRUCacheFile, Warning, TEXT("Cache index is not recognized, the cache starts empty"));
+		RemoveLegacyFiles();
+		return {};
+	}
+
+	TArray<int32> SegmentIds;
+	int32 NumEntries = 0;
+	Reader << NextSegment;
+	Reader << AccessCounter;
+	Reader << SegmentIds;
+	Reader << NumEntries;
+
+	for (int32 Segment : SegmentIds)
+	{
+		const int64 FileSize = IFileManager::Get().FileSize(*GetSegmentPath(Segment));
+		if (FileSize > 0)
+		{
+			Segments.Add(Segment, FSegment{ FileSize, FileSize });
+		}
+		else if (FileSize == 0)
+		{
+			IFileManager::Get().Delete(*GetSegmentPath(Segment), false, true, true);
+		}
+	}
+
+	for (int32 i = 0; i < NumEntries && !Reader.IsError(); i++)
+	{
+		FAccelByteCacheFileIndexEntry Entry;
+		int64 ExpiresAtTicks = 0;
+		Reader << Entry.Key;
+		Reader << Entry.Segment;
+		Reader << Entry.Offset;
+		Reader << Entry.Size;
+		Reader << ExpiresAtTicks;
+		Reader << Entry.ETag;
+		Reader << Entry.LastAccess;
+		Entry.ExpiresAt = FDateTime(ExpiresAtTicks);
+
+		// Drop entries whose segment is gone or was cut short, e.g. by a crash before the index was written
+		FSegment* Segment = Segments.Find(Entry.Segment);
+		if (Reader.IsError() || Segment == nullptr || Entry.Offset + Entry.Size > Segment->Size)
+		{
+			continue;
+		}
+		Segment->DeadBytes -= Entry.Size;
+		Index.Add(Entry.Key, MoveTemp(Entry));
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogAccelByteLRUCacheFile, Warning, TEXT("Cache index is truncated, %d entries were recovered"), Index.Num());
+	}
+
+	// Segments referenced by the index but holding nothing anymore
+	for (auto It = Segments.CreateIterator(); It; ++It)
+	{
+		if (It.Value().DeadBytes >= It.Value().Size)
+		{
+			IFileManager::Get().Delete(*GetSegmentPath(It.Key()), false, true, true);
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<FAccelByteCacheFileIndexEntry> Entries;
+	Index.GenerateValueArray(Entries);
+	Entries.Sort([](const FAccelByteCacheFileIndexEntry& A, const FAccelByteCacheFileIndexEntry& B)
+		{
+			return A.LastAccess < B.LastAccess;
+		});
+
+	UE_LOG(LogAccelByteLRUCacheFile, Verbose, TEXT("Cache index loaded with %d entries in %d segments"), Index.Num(), Segments.Num());
+
+	ScheduleCompaction();
+	return Entries;
+}
+
+void FAccelByteCacheFileStore::RemoveLegacyFiles()
+{
+	// Only done when there is no index, a cache written by an older SDK kept one file per key
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *Directory, nullptr);
+	for (const FString& File : Files)
+	{
+		if (File.StartsWith(Prefix) && (File.EndsWith(LegacyCacheExtension) || File.EndsWith(SegmentExtension)))
+		{
+			IFileManager::Get().Delete(*(Directory / File), false, true, true);
+		}
+	}
+}
+
+void FAccelByteCacheFileStore::OpenNewSegmentLocked()
+{
+	ActiveSegmentHandle.Reset();
+
+	// A segment that never got an item would never be compacted either
+	const FSegment* Previous = Segments.Find(ActiveSegment);
+	if (Previous != nullptr && Previous->Size == 0)
+	{
+		Segments.Remove(ActiveSegment);
+		IFileManager::Get().Delete(*GetSegmentPath(ActiveSegment), false, true, true);
+	}
+
+	ActiveSegment = NextSegment++;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+	ActiveSegmentHandle.Reset(PlatformFile.OpenWrite(*GetSegmentPath(ActiveSegment), false, true));
+	if (!ActiveSegmentHandle.IsValid())
+	{
+		UE_LOG(LogAccelByteLRUCacheFile, Warning, TEXT("Unable to open cache segment %s"), *GetSegmentPath(ActiveSegment));
+		ActiveSegment = INDEX_NONE;
+		return;
+	}
+
+	Segments.Add(ActiveSegment, FSegment{});
+	MarkDirtyLocked();
+}
+
+bool FAccelByteCacheFileStore::AppendLocked(const FString& Key, const TArray<uint8>& Bytes, FAccelByteCacheFileIndexEntry& Entry)
+{
+	// An item bigger than a segment gets one of its own instead of leaving an empty segment behind
+	if (ActiveSegment == INDEX_NONE || !ActiveSegmentHandle.IsValid()
+		|| (Segments[ActiveSegment].Size > 0 && Segments[ActiveSegment].Size + Bytes.Num() > MaxSegmentBytes))
+	{
+		OpenNewSegmentLocked();
+		if (ActiveSegment == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	FSegment& Segment = Segments[ActiveSegment];
+	if (!ActiveSegmentHandle->Write(Bytes.GetData(), Bytes.Num()))
+	{
+		UE_LOG(LogAccelByteLRUCacheFile, Warning, TEXT("Unable to write cache segment %s"), *GetSegmentPath(ActiveSegment));
+		// The segment may be torn, later writes go to a new one
+		Segment.DeadBytes = Segment.Size = ActiveSegmentHandle->Tell();
+		ActiveSegmentHandle.Reset();
+		return false;
+	}
+
+	Entry.Key = Key;
+	Entry.Segment = ActiveSegment;
+	Entry.Offset = Segment.Size;
+	Entry.Size = Bytes.Num();
+	Segment.Size += Bytes.Num();
+	return true;
+}
+
+bool FAccelByteCacheFileStore::ReadLocked(const FAccelByteCacheFileIndexEntry& Entry, TArray<uint8>& OutBytes)
+{
+	if (Entry.Segment == ActiveSegment && ActiveSegmentHandle.IsValid())
+	{
+		ActiveSegmentHandle->Flush();
+	}
+
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*GetSegmentPath(Entry.Segment), true));
+	if (!Handle.IsValid() || !Handle->Seek(Entry.Offset))
+	{
+		return false;
+	}
+
+	OutBytes.SetNumUninitialized(Entry.Size);
+	return Handle->Read(OutBytes.GetData(), Entry.Size);
+}
+
+bool FAccelByteCacheFileStore::Write(const FString& Key, const TArray<uint8>& Bytes, const FDateTime& ExpiresAt, const FString& ETag)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	RemoveLocked(Key);
+
+	FAccelByteCacheFileIndexEntry Entry;
+	if (!AppendLocked(Key, Bytes, Entry))
+	{
+		return false;
+	}
+	Entry.ExpiresAt = ExpiresAt;
+	Entry.ETag = ETag;
+	Entry.LastAccess = ++AccessCounter;
+	Index.Add(Key, MoveTemp(Entry));
+
+	MarkDirtyLocked();
+	return true;
+}
+
+bool FAccelByteCacheFileStore::Read(const FString& Key, TArray<uint8>& OutBytes, FAccelByteCacheFileIndexEntry& OutEntry)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FAccelByteCacheFileIndexEntry* Entry = Index.Find(Key);
+	if (Entry == nullptr || !ReadLocked(*Entry, OutBytes))
+	{
+		return false;
+	}
+
+	Entry->LastAccess = ++AccessCounter;
+	OutEntry = *Entry;
+	bHasPendingAccess = true;
+	return true;
+}
+
+void FAccelByteCacheFileStore::Touch(const FString& Key)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (FAccelByteCacheFileIndexEntry* Entry = Index.Find(Key))
+	{
+		Entry->LastAccess = ++AccessCounter;
+		bHasPendingAccess = true;
+	}
+}
+
+void FAccelByteCacheFileStore::Remove(const FString& Key)
+{
+	FScopeLock ScopeLock(&Lock);
+	RemoveLocked(Key);
+}
+
+void FAccelByteCacheFileStore::RemoveLocked(const FString& Key)
+{
+	FAccelByteCacheFileIndexEntry Entry;
+	if (!Index.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	if (FSegment* Segment = Segments.Find(Entry.Segment))
+	{
+		Segment->DeadBytes += Entry.Size;
+	}
+	MarkDirtyLocked();
+	ScheduleCompaction();
+}
+
+void FAccelByteCacheFileStore::Clear()
+{
+	WaitForCompaction();
+
+	FScopeLock ScopeLock(&Lock);
+
+	ActiveSegmentHandle.Reset();
+	ActiveSegment = INDEX_NONE;
+	for (const TPair<int32, FSegment>& Segment : Segments)
+	{
+		IFileManager::Get().Delete(*GetSegmentPath(Segment.Key), false, true, true);
+	}
+	Segments.Empty();
+	Index.Empty();
+	IFileManager::Get().Delete(*GetIndexPath(), false, true, true);
+	PendingIndexChanges = 0;
+	bHasPendingAccess = false;
+}
+
+void FAccelByteCacheFileStore::Flush()
+{
+	FScopeLock ScopeLock(&Lock);
+	FlushLocked();
+}
+
+void FAccelByteCacheFileStore::MarkDirtyLocked()
+{
+	if (++PendingIndexChanges >= IndexFlushThreshold)
+	{
+		FlushLocked();
+	}
+}
+
+void FAccelByteCacheFileStore::FlushLocked()
+{
+	if (PendingIndexChanges == 0 && !bHasPendingAccess)
+	{
+		return;
+	}
+
+	// Segment data has to be on disk before an index that points at it
+	if (ActiveSegmentHandle.IsValid())
+	{
+		ActiveSegmentHandle->Flush();
+	}
+
+	TArray<uint8> IndexBytes;
+	FMemoryWriter Writer(IndexBytes);
+
+	uint32 Magic = IndexFileMagic;
+	int32 Version = IndexFileVersion;
+	TArray<int32> SegmentIds;
+	Segments.GenerateKeyArray(SegmentIds);
+	int32 NumEntries = Index.Num();
+
+	Writer << Magic;
+	Writer << Version;
+	Writer << NextSegment;
+	Writer << AccessCounter;
+	Writer << SegmentIds;
+	Writer << NumEntries;
+	for (TPair<FString, FAccelByteCacheFileIndexEntry>& Pair : Index)
+	{
+		FAccelByteCacheFileIndexEntry& Entry = Pair.Value;
+		int64 ExpiresAtTicks = Entry.ExpiresAt.GetTicks();
+		Writer << Entry.Key;
+		Writer << Entry.Segment;
+		Writer << Entry.Offset;
+		Writer << Entry.Size;
+		Writer << ExpiresAtTicks;
+		Writer << Entry.ETag;
+		Writer << Entry.LastAccess;
+	}
+
+	// Written next to the index and moved over it, a crash never leaves a half written index behind
+	const FString IndexPath = GetIndexPath();
+	const FString TempPath = IndexPath + TEXT(".tmp");
+	if (FFileHelper::SaveArrayToFile(IndexBytes, *TempPath) && IFileManager::Get().Move(*IndexPath, *TempPath, true, true))
+	{
+		PendingIndexChanges = 0;
+		bHasPendingAccess = false;
+	}
+	else
+	{
+		UE_LOG(LogAccelByteLRUCacheFile, Warning, TEXT("Unable to write cache index %s"), *IndexPath);
+	}
+}
+
+void FAccelByteCacheFileStore::ScheduleCompaction()
+{
+	if (bIsCompacting)
+	{
+		return;
+	}
+
+	// Compact the closed segment with the most dead bytes, once at least half of it is dead
+	int32 Candidate = INDEX_NONE;
+	int64 CandidateDeadBytes = 0;
+	for (const TPair<int32, FSegment>& Segment : Segments)
+	{
+		if (Segment.Key != ActiveSegment
+			&& Segment.Value.DeadBytes * 2 >= Segment.Value.Size
+			&& Segment.Value.DeadBytes > CandidateDeadBytes)
+		{
+			Candidate = Segment.Key;
+			CandidateDeadBytes = Segment.Value.DeadBytes;
+		}
+	}
+
+	if (Candidate == INDEX_NONE)
+	{
+		return;
+	}
+
+	bIsCompacting = true;
+	Compaction = Async(EAsyncExecution::ThreadPool, [this, Candidate]()
+		{
+			Compact(Candidate);
+		});
+}
+
+void FAccelByteCacheFileStore::Compact(int32 Segment)
+{
+	TArray<FString> Keys;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (const TPair<FString, FAccelByteCacheFileIndexEntry>& Pair : Index)
+		{
+			if (Pair.Value.Segment == Segment)
+			{
+				Keys.Add(Pair.Key);
+			}
+		}
+	}
+
+	// One item per lock so the cache stays usable while a segment is compacted
+	for (const FString& Key : Keys)
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		FAccelByteCacheFileIndexEntry* Entry = Index.Find(Key);
+		if (Entry == nullptr || Entry->Segment != Segment)
+		{
+			continue;
+		}
+
+		TArray<uint8> Bytes;
+		FAccelByteCacheFileIndexEntry Moved = *Entry;
+		if (!ReadLocked(*Entry, Bytes) || !AppendLocked(Key, Bytes, Moved))
+		{
+			continue;
+		}
+		Moved.ExpiresAt = Entry->ExpiresAt;
+		Moved.ETag = Entry->ETag;
+		Moved.LastAccess = Entry->LastAccess;
+		*Entry = MoveTemp(Moved);
+		Segments[Segment].DeadBytes += Entry->Size;
+		MarkDirtyLocked();
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	const FSegment* Compacted = Segments.Find(Segment);
+	if (Compacted != nullptr && Compacted->DeadBytes >= Compacted->Size)
+	{
+		// Index first, it must never point at a deleted segment
+		Segments.Remove(Segment);
+		PendingIndexChanges++;
+		FlushLocked();
+		IFileManager::Get().Delete(*GetSegmentPath(Segment), false, true, true);
+		UE_LOG(LogAccelByteLRUCacheFile, Verbose, TEXT("Cache segment %d compacted"), Segment);
+	}
+	bIsCompacting = false;
+}
+
+}
+}
@@ -382,24 +382,36 @@ void MessageParser::ProcessFragmentedMessage(const FString& InMessage
 			, FString& OutMessage
 			, bool& OutIsMessageEnd)
 {
-	OutMessage = "";
+	OutMessage.Reset();
 	if(!InEnvelopeStart.IsEmpty() || !InEnvelopeEnd.IsEmpty())
 	{
-		FString MessageCopy {InMessage};
-		if(!InEnvelopeStart.IsEmpty() && MessageCopy.StartsWith(InEnvelopeStart))
+		int32 ContentStart = 0;
+		if(!InEnvelopeStart.IsEmpty() && InMessage.StartsWith(InEnvelopeStart))
 		{
-			InOutEnvelopeBuffer = "";
-			MessageCopy.RemoveFromStart(InEnvelopeStart);
+			InOutEnvelopeBuffer.Reset();
+			ContentStart = InEnvelopeStart.Len();
 		}
-
-		InOutEnvelopeBuffer.Append(MessageCopy);
+		const int32 ContentLength = InMessage.Len() - ContentStart;
 
 		if(InEnvelopeEnd.IsEmpty())
 		{
 			UE_LOG(LogAccelByte, Warning, TEXT("WsEnvelopeEnd is empty string, "
 				"even though WsEnvelopeStart is not empty.\nWill not detect fragmented message"));
 		}
-		else
+
+		// whole message in a single frame, copy the content out once without going through the buffer
+		if(InOutEnvelopeBuffer.IsEmpty()
+			&& (InEnvelopeEnd.IsEmpty() || (ContentLength >= InEnvelopeEnd.Len() && InMessage.EndsWith(InEnvelopeEnd))))
+		{
+			OutMessage = InMessage.Mid(ContentStart, ContentLength - InEnvelopeEnd.Len());
+			OutIsMessageEnd = true;
+			return;
+		}
+
+		// the buffer keeps its allocation between messages, Reset does not free it
+		InOutEnvelopeBuffer.AppendChars(*InMessage + ContentStart, ContentLength);
+
+		if(!InEnvelopeEnd.IsEmpty())
 		{
 			if(!InOutEnvelopeBuffer.EndsWith(InEnvelopeEnd))
 			{
@@ -407,14 +419,11 @@ void MessageParser::ProcessFragmentedMessage(const FString& InMessage
 				OutIsMessageEnd = false;
 				return;
 			}
-			else
-			{
-				InOutEnvelopeBuffer.RemoveFromEnd(InEnvelopeEnd);
-			}
+			InOutEnvelopeBuffer.RemoveFromEnd(InEnvelopeEnd);
 		}
 
 		OutMessage = InOutEnvelopeBuffer;
-		InOutEnvelopeBuffer = "";
+		InOutEnvelopeBuffer.Reset();
 	}
 	else // both message envelope is empty, just pass the inMessage directly
 	{
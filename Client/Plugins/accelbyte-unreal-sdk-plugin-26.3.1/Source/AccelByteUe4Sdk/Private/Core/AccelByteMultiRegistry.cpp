@@ -3,91 +3,126 @@
 // and restrictions contact your company contract manager.
 
 #include "Core/AccelByteMultiRegistry.h"
+#include "Misc/ScopeLock.h"
 
 namespace AccelByte
 {
 
 FApiClientPtr AccelByte::FMultiRegistry::GetApiClient(const FString &Key, bool bCreateIfNotFound)
 {
-	if (!ApiClientInstances.Contains(Key))
 	{
-		if (!bCreateIfNotFound)
+		FScopeLock Lock(&InstancesLock);
+		if (FApiClientPtr* Found = ApiClientInstances.Find(Key))
 		{
-			return nullptr;
+			return *Found;
 		}
+	}
 
-		FApiClientPtr NewClient = nullptr;
-		
-		if (Key.Compare(TEXT("default")) == 0) 
-		{
-			NewClient = MakeShared<FApiClient, ESPMode::ThreadSafe>(FRegistry::CredentialsRef.Get(), FRegistry::HttpRetryScheduler, FRegistry::MessagingSystem);
-		}
-		else 
-		{
-			NewClient = MakeShared<FApiClient, ESPMode::ThreadSafe>();
-		}
+	if (!bCreateIfNotFound)
+	{
+		return nullptr;
+	}
+
+	// Constructing a client starts its scheduler and credentials, so it is done outside the lock
+	FApiClientPtr NewClient = nullptr;
+	
+	if (Key.Compare(TEXT("default")) == 0) 
+	{
+		NewClient = MakeShared<FApiClient, ESPMode::ThreadSafe>(FRegistry::CredentialsRef.Get(), FRegistry::HttpRetryScheduler, FRegistry::MessagingSystem);
+	}
+	else 
+	{
+		NewClient = MakeShared<FApiClient, ESPMode::ThreadSafe>();
+	}
 
-		ApiClientInstances.Add(Key, NewClient);
+	FScopeLock Lock(&InstancesLock);
+	if (FApiClientPtr* Found = ApiClientInstances.Find(Key))
+	{
+		// Another thread created it first, ours is released after the lock
+		return *Found;
 	}
+	ApiClientInstances.Add(Key, NewClient);
 
-	return ApiClientInstances[Key];
+	return NewClient;
 }
 
 FServerApiClientPtr AccelByte::FMultiRegistry::GetServerApiClient(const FString &Key)
 {
-	if (!ServerApiClientInstances.Contains(Key))
 	{
-		FServerApiClientPtr NewClient = nullptr;
-		
-		if (Key.Compare(TEXT("default")) == 0) 
-		{
-			NewClient = MakeShared<FServerApiClient, ESPMode::ThreadSafe>(FRegistry::ServerCredentialsRef.Get(), FRegistry::HttpRetryScheduler);
-		}
-		else 
+		FScopeLock Lock(&InstancesLock);
+		if (FServerApiClientPtr* Found = ServerApiClientInstances.Find(Key))
 		{
-			NewClient = MakeShared<FServerApiClient, ESPMode::ThreadSafe>();
+			return *Found;
 		}
+	}
+
+	FServerApiClientPtr NewClient = nullptr;
+	
+	if (Key.Compare(TEXT("default")) == 0) 
+	{
+		NewClient = MakeShared<FServerApiClient, ESPMode::ThreadSafe>(FRegistry::ServerCredentialsRef.Get(), FRegistry::HttpRetryScheduler);
+	}
+	else 
+	{
+		NewClient = MakeShared<FServerApiClient, ESPMode::ThreadSafe>();
+	}
 
-		ServerApiClientInstances.Add(Key, NewClient);
+	FScopeLock Lock(&InstancesLock);
+	if (FServerApiClientPtr* Found = ServerApiClientInstances.Find(Key))
+	{
+		return *Found;
 	}
+	ServerApiClientInstances.Add(Key, NewClient);
 	
-	return ServerApiClientInstances[Key];
+	return NewClient;
 }
 
 bool FMultiRegistry::RegisterApiClient(FString const &Key, FApiClientPtr ApiClient)
 {
-	bool bResult = false;
+	if (Key.IsEmpty())
+	{
+		return false;
+	}
 
-	if (!Key.IsEmpty())
+	FApiClientPtr Replaced;
 	{
+		FScopeLock Lock(&InstancesLock);
+		ApiClientInstances.RemoveAndCopyValue(Key, Replaced);
 		ApiClientInstances.Add(Key, ApiClient);
-		bResult = true;
 	}
 
-	return bResult;
+	return true;
 }
 
 bool FMultiRegistry::RemoveApiClient(const FString &Key)
 {
-	bool bResult = false;
+	if (Key.IsEmpty())
+	{
+		return false;
+	}
 
-    if (!Key.IsEmpty())
-    {
-        const int32 RemovedNum = ApiClientInstances.Remove(Key);
-        bResult = RemovedNum > 0;
-    }
+	FApiClientPtr Removed;
+	bool bResult = false;
+	{
+		FScopeLock Lock(&InstancesLock);
+		bResult = ApiClientInstances.RemoveAndCopyValue(Key, Removed);
+	}
 
-    return bResult;
+	return bResult;
 }
 
 bool FMultiRegistry::RemoveServerApiClient(const FString &Key)
 {
+	if (Key.IsEmpty())
+	{
+		return false;
+	}
+
+	FServerApiClientPtr Removed;
 	bool bResult = false;
-	
-	if (!Key.IsEmpty())
 	{
-        const int32 RemovedNum = ServerApiClientInstances.Remove(Key);
-        bResult = RemovedNum > 0;
+		FScopeLock Lock(&InstancesLock);
+		bResult = ServerApiClientInstances.RemoveAndCopyValue(Key, Removed);
 	}
 
 	return bResult;
@@ -95,26 +130,37 @@ bool FMultiRegistry::RemoveServerApiClient(const FString &Key)
 
 void FMultiRegistry::Shutdown()
 {
-	TArray<FString> ApiClientKeys{};
-	ApiClientInstances.GenerateKeyArray(ApiClientKeys);
-	ApiClientKeys.Remove(TEXT("default"));
-	for (const auto& Key : ApiClientKeys)
+	TArray<FApiClientPtr> RemovedApiClients{};
+	TArray<FServerApiClientPtr> RemovedServerApiClients{};
 	{
-		const auto& TempApiClient = GetApiClient(Key);
-		RemoveApiClient(Key);
-	}
+		FScopeLock Lock(&InstancesLock);
 
-	TArray<FString> ServerApiClientKeys{};
-	ServerApiClientInstances.GenerateKeyArray(ServerApiClientKeys);
-	ServerApiClientKeys.Remove(TEXT("default"));
-	for (const auto& Key : ServerApiClientKeys)
-	{
-		const auto& TempApiClient = GetServerApiClient(Key);
-		RemoveServerApiClient(Key);
+		for (auto It = ApiClientInstances.CreateIterator(); It; ++It)
+		{
+			if (It.Key() != TEXT("default"))
+			{
+				RemovedApiClients.Add(It.Value());
+				It.RemoveCurrent();
+			}
+		}
+
+		for (auto It = ServerApiClientInstances.CreateIterator(); It; ++It)
+		{
+			if (It.Key() != TEXT("default"))
+			{
+				RemovedServerApiClients.Add(It.Value());
+				It.RemoveCurrent();
+			}
+		}
 	}
+
+	// Released here, outside of the lock
+	RemovedApiClients.Empty();
+	RemovedServerApiClients.Empty();
 }
 
 TMap<FString, FApiClientPtr> FMultiRegistry::ApiClientInstances;
 TMap<FString, FServerApiClientPtr> FMultiRegistry::ServerApiClientInstances;
+FCriticalSection FMultiRegistry::InstancesLock;
 
 }
@@ -7,6 +7,22 @@
 
 DEFINE_LOG_CATEGORY(LogAccelByteNotificationBuffer);
 
+namespace
+{
+	struct FSequenceLess
+	{
+		bool operator()(const FAccelByteModelsUserNotification& A, const FAccelByteModelsUserNotification& B) const
+		{
+			if (A.SequenceID == B.SequenceID)
+			{
+				return A.SequenceNumber < B.SequenceNumber;
+			}
+
+			return A.SequenceID < B.SequenceID;
+		}
+	};
+}
+
 bool AccelByte::FAccelByteNotificationBuffer::TryAddBuffer(const FAccelByteModelsUserNotification& InNotification)
 {
 	if (!HasValidSequence(InNotification))
@@ -25,10 +41,11 @@ bool AccelByte::FAccelByteNotificationBuffer::TryAddBuffer(const FAccelByteModel
 		if (!bBuffering)
 		{
 			bBuffering = true;
+			BufferingEpisode++;
+			BufferingStartTime = FPlatformTime::Seconds();
 		}
 
 		AddToBuffer(InNotification);
-		SortBuffer();
 
 		return true;
 	}
@@ -57,8 +74,6 @@ bool AccelByte::FAccelByteNotificationBuffer::AddMissingNotifications(const TArr
 		AddToBuffer(Notification);
 	}
 
-	SortBuffer();
-
 	return true;
 }
 
@@ -84,15 +99,65 @@ void AccelByte::FAccelByteNotificationBuffer::Clear()
 		return;
 	}
 
-	UpdateLastSequence(Buffer.Last());
+	// The heap only keeps its first element in place, look for the latest one
+	const FAccelByteModelsUserNotification* Latest = &Buffer[0];
+	for (const FAccelByteModelsUserNotification& Notification : Buffer)
+	{
+		if (FSequenceLess()(*Latest, Notification))
+		{
+			Latest = &Notification;
+		}
+	}
+	UpdateLastSequence(*Latest);
 
 	Buffer.Empty();
+	BufferedSequences.Empty();
 	bBuffering = false;
 }
 
 TArray<FAccelByteModelsUserNotification> AccelByte::FAccelByteNotificationBuffer::GetSortedBuffer()
 {
-	return Buffer;
+	TArray<FAccelByteModelsUserNotification> SortedBuffer = Buffer;
+	SortedBuffer.HeapSort(FSequenceLess());
+	return SortedBuffer;
+}
+
+TArray<FAccelByteModelsUserNotification> AccelByte::FAccelByteNotificationBuffer::TakeSortedBuffer()
+{
+	FScopeLock Lock(&BufferLock);
+	TArray<FAccelByteModelsUserNotification> SortedBuffer = MoveTemp(Buffer);
+	Buffer.Reset();
+	BufferedSequences.Reset();
+
+	if (SortedBuffer.Num() > 0)
+	{
+		SortedBuffer.HeapSort(FSequenceLess());
+		UpdateLastSequence(SortedBuffer.Last());
+		bBuffering = false;
+	}
+
+	return SortedBuffer;
+}
+
+void AccelByte::FAccelByteNotificationBuffer::SetLimits(int32 InMaxBufferedNotifications, double InGapTimeoutSeconds)
+{
+	MaxBufferedNotifications = InMaxBufferedNotifications;
+	GapTimeoutSeconds = InGapTimeoutSeconds;
+}
+
+bool AccelByte::FAccelByteNotificationBuffer::ShouldRelease() const
+{
+	if (!bBuffering)
+	{
+		return false;
+	}
+
+	if (MaxBufferedNotifications > 0 && Buffer.Num() >= MaxBufferedNotifications)
+	{
+		return true;
+	}
+
+	return GapTimeoutSeconds > 0.0 && FPlatformTime::Seconds() - BufferingStartTime >= GapTimeoutSeconds;
 }
 
 bool AccelByte::FAccelByteNotificationBuffer::IsBuffering() const
@@ -100,6 +165,11 @@ bool AccelByte::FAccelByteNotificationBuffer::IsBuffering() const
 	return bBuffering;
 }
 
+uint32 AccelByte::FAccelByteNotificationBuffer::GetBufferingEpisode() const
+{
+	return BufferingEpisode;
+}
+
 void AccelByte::FAccelByteNotificationBuffer::UpdateLastSequence(const FAccelByteModelsUserNotification& InNotification)
 {
 	LastSequenceID = FLobbySequenceID(InNotification.SequenceID);
@@ -150,30 +220,25 @@ bool AccelByte::FAccelByteNotificationBuffer::IsDuplicateNotification(const FAcc
 	return false;
 }
 
-bool AccelByte::FAccelByteNotificationBuffer::IsExistInBuffer(const FLobbySequenceID& InSequenceID, const FLobbySequenceNumber& InSequenceNumber) const
+uint64 AccelByte::FAccelByteNotificationBuffer::GetSequenceKey(int32 SequenceID, int32 SequenceNumber)
 {
-	return Buffer.ContainsByPredicate(
-		[InSequenceID, InSequenceNumber](const FAccelByteModelsUserNotification& Notif)
-		{
-			return Notif.SequenceID == InSequenceID.GetValue() && Notif.SequenceNumber == InSequenceNumber.GetValue();
-		});
+	return (static_cast<uint64>(static_cast<uint32>(SequenceID)) << 32) | static_cast<uint32>(SequenceNumber);
 }
 
-void AccelByte::FAccelByteNotificationBuffer::AddToBuffer(const FAccelByteModelsUserNotification& InNotification)
+bool AccelByte::FAccelByteNotificationBuffer::IsExistInBuffer(const FLobbySequenceID& InSequenceID, const FLobbySequenceNumber& InSequenceNumber) const
 {
-	FScopeLock Lock(&BufferLock);
-	Buffer.Add(InNotification);
+	return BufferedSequences.Contains(GetSequenceKey(InSequenceID.GetValue(), InSequenceNumber.GetValue()));
 }
 
-void AccelByte::FAccelByteNotificationBuffer::SortBuffer()
+void AccelByte::FAccelByteNotificationBuffer::AddToBuffer(const FAccelByteModelsUserNotification& InNotification)
 {
-	Buffer.Sort([](const FAccelByteModelsUserNotification& A, const FAccelByteModelsUserNotification& B)
+	FScopeLock Lock(&BufferLock);
+	bool bAlreadyBuffered = false;
+	BufferedSequences.Add(GetSequenceKey(InNotification.SequenceID, InNotification.SequenceNumber), &bAlreadyBuffered);
+	if (bAlreadyBuffered)
 	{
-		if (A.SequenceID == B.SequenceID)
-		{
-			return A.SequenceNumber < B.SequenceNumber;
-		}
+		return;
+	}
 
-		return A.SequenceID < B.SequenceID;
-	});
+	Buffer.HeapPush(InNotification, FSequenceLess());
 }
@@ -0,0 +1,427 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteTelemetrySpool.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteTelemetrySpool, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteTelemetrySpool);
+
+namespace AccelByte
+{
+
+namespace
+{
+	constexpr uint32 SpoolFileMagic = 0x53544241; // ABTS
+	constexpr uint32 SpoolFileVersion = 1;
+	constexpr int64 SpoolHeaderSize = sizeof(uint32) * 2;
+
+	const FString SegmentPrefix = TEXT("Segment_");
+	const FString SegmentExtension = TEXT(".spool");
+
+	template<typename TValue>
+	void AppendValue(TArray<uint8>& Out, const TValue& Value)
+	{
+		Out.Append(reinterpret_cast<const uint8*>(&Value), sizeof(TValue));
+	}
+
+	template<typename TValue>
+	bool ReadValue(const TArray<uint8>& In, int64& Offset, TValue& Out)
+	{
+		if (Offset + static_cast<int64>(sizeof(TValue)) > In.Num())
+		{
+			return false;
+		}
+		FMemory::Memcpy(&Out, In.GetData() + Offset, sizeof(TValue));
+		Offset += sizeof(TValue);
+		return true;
+	}
+}
+
+FAccelByteTelemetrySpool::FAccelByteTelemetrySpool(const FString& InDirectory
+	, int64 InMaxSegmentBytes
+	, int64 InMaxTotalBytes)
+	: Directory(InDirectory)
+	, MaxSegmentBytes(FMath::Max<int64>(InMaxSegmentBytes, 1024))
+	// Declared after MaxSegmentBytes, so the clamped segment size is already set.
+	, MaxTotalBytes(FMath::Max<int64>(InMaxTotalBytes, MaxSegmentBytes))
+{
+}
+
+FAccelByteTelemetrySpool::~FAccelByteTelemetrySpool()
+{
+	FScopeLock ScopeLock(&Lock);
+	CloseActiveSegment();
+}
+
+TArray<FAccelByteSpooledEvent> FAccelByteTelemetrySpool::Open()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	CloseActiveSegment();
+	Segments.Empty();
+	NextSequence = 0;
+	TotalBytes = 0;
+	PendingCount = 0;
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(Directory / (SegmentPrefix + TEXT("*") + SegmentExtension)), true, false);
+	for (const FString& FileName : FileNames)
+	{
+		const FString SequenceString = FPaths::GetBaseFilename(FileName).RightChop(SegmentPrefix.Len());
+		if (!SequenceString.IsNumeric())
+		{
+			continue;
+		}
+
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.FirstSequence = FCString::Atoi64(*SequenceString);
+		Segment.Path = Directory / FileName;
+	}
+	Segments.Sort([](const FSegment& A, const FSegment& B) { return A.FirstSequence < B.FirstSequence; });
+
+	TMap<int64, FString> Events;
+	TMap<int64, int32> EventSegments;
+	TArray<int32> UnreadableSegments;
+	for (int32 Index = 0; Index < Segments.Num(); Index++)
+	{
+		NextSequence = FMath::Max(NextSequence, Segments[Index].FirstSequence);
+		if (!ReplaySegment(Index, Events, EventSegments))
+		{
+			UnreadableSegments.Add(Index);
+			continue;
+		}
+		TotalBytes += Segments[Index].Size;
+	}
+
+	for (int32 Index = UnreadableSegments.Num() - 1; Index >= 0; Index--)
+	{
+		IFileManager::Get().Delete(*Segments[UnreadableSegments[Index]].Path, false, true, true);
+		Segments.RemoveAt(UnreadableSegments[Index]);
+	}
+
+	TArray<FAccelByteSpooledEvent> Result;
+	Result.Reserve(Events.Num());
+	for (TPair<int64, FString>& Event : Events)
+	{
+		Result.Add(FAccelByteSpooledEvent{ Event.Key, MoveTemp(Event.Value) });
+		NextSequence = FMath::Max(NextSequence, Event.Key + 1);
+	}
+	Result.Sort([](const FAccelByteSpooledEvent& A, const FAccelByteSpooledEvent& B) { return A.Sequence < B.Sequence; });
+	PendingCount = Result.Num();
+
+	TruncateAcknowledged();
+	EnforceSizeLimit();
+
+	if (Result.Num() > 0)
+	{
+		UE_LOG(LogAccelByteTelemetrySpool, Log, TEXT("Recovered %d pending events from %d segments in %s"), Result.Num(), Segments.Num(), *Directory);
+	}
+	return Result;
+}
+
+int64 FAccelByteTelemetrySpool::Append(const FString& Payload)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FTCHARToUTF8 PayloadUtf8(*Payload);
+
+	const int64 Sequence = NextSequence;
+	if (!WriteRecord(ERecordType::Event, Sequence, reinterpret_cast<const uint8*>(PayloadUtf8.Get()), PayloadUtf8.Length()))
+	{
+		return INDEX_NONE;
+	}
+
+	NextSequence++;
+	Segments.Last().Pending.Add(Sequence);
+	PendingCount++;
+
+	EnforceSizeLimit();
+	return Sequence;
+}
+
+void FAccelByteTelemetrySpool::Acknowledge(const TArray<int64>& Sequences)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	TArray<int64> Acknowledged;
+	Acknowledged.Reserve(Sequences.Num());
+	for (const int64 Sequence : Sequences)
+	{
+		for (int32 Index = Segments.Num() - 1; Index >= 0; Index--)
+		{
+			if (Segments[Index].FirstSequence <= Sequence)
+			{
+				if (Segments[Index].Pending.Remove(Sequence) > 0)
+				{
+					Acknowledged.Add(Sequence);
+				}
+				break;
+			}
+		}
+	}
+
+	if (Acknowledged.Num() == 0)
+	{
+		return;
+	}
+	PendingCount -= Acknowledged.Num();
+
+	TruncateAcknowledged();
+	if (Segments.Num() == 0)
+	{
+		return;
+	}
+
+	// Events in deleted segments are gone already, only the remaining ones need the acknowledgement persisted
+	const int64 OldestSequence = Segments[0].FirstSequence;
+	TArray<uint8> Payload;
+	Payload.Reserve(Acknowledged.Num() * sizeof(int64));
+	for (const int64 Sequence : Acknowledged)
+	{
+		if (Sequence >= OldestSequence)
+		{
+			AppendValue(Payload, Sequence);
+		}
+	}
+
+	if (Payload.Num() > 0)
+	{
+		WriteRecord(ERecordType::Acknowledge, 0, Payload.GetData(), Payload.Num());
+		EnforceSizeLimit();
+	}
+}
+
+int32 FAccelByteTelemetrySpool::GetPendingCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PendingCount;
+}
+
+int64 FAccelByteTelemetrySpool::GetTotalBytes() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return TotalBytes;
+}
+
+int64 FAccelByteTelemetrySpool::GetDroppedCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return DroppedCount;
+}
+
+FString FAccelByteTelemetrySpool::GetSegmentPath(int64 FirstSequence) const
+{
+	return Directory / FString::Printf(TEXT("%s%lld%s"), *SegmentPrefix, FirstSequence, *SegmentExtension);
+}
+
+bool FAccelByteTelemetrySpool::ReplaySegment(int32 SegmentIndex, TMap<int64, FString>& OutEvents, TMap<int64, int32>& OutEventSegments)
+{
+	FSegment& Segment = Segments[SegmentIndex];
+
+	TArray<uint8> Content;
+	if (!FFileHelper::LoadFileToArray(Content, *Segment.Path))
+	{
+		return false;
+	}
+
+	int64 Offset = 0;
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	if (!ReadValue(Content, Offset, Magic) || !ReadValue(Content, Offset, Version)
+		|| Magic != SpoolFileMagic || Version != SpoolFileVersion)
+	{
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Discarding unreadable segment %s"), *Segment.Path);
+		return false;
+	}
+
+	int64 ValidSize = Offset;
+	while (Offset < Content.Num())
+	{
+		const int64 RecordStart = Offset;
+		uint8 Type = 0;
+		int64 Sequence = 0;
+		int32 Length = 0;
+		uint32 Crc = 0;
+
+		if (!ReadValue(Content, Offset, Type) || !ReadValue(Content, Offset, Sequence) || !ReadValue(Content, Offset, Length)
+			|| Length < 0 || Offset + Length > Content.Num())
+		{
+			break;
+		}
+		const int64 PayloadOffset = Offset;
+		Offset += Length;
+
+		if (!ReadValue(Content, Offset, Crc)
+			|| Crc != FCrc::MemCrc32(Content.GetData() + RecordStart, PayloadOffset + Length - RecordStart))
+		{
+			break;
+		}
+
+		if (Type == static_cast<uint8>(ERecordType::Event))
+		{
+			OutEvents.Add(Sequence, FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Content.GetData() + PayloadOffset), Length)));
+			OutEventSegments.Add(Sequence, SegmentIndex);
+			Segment.Pending.Add(Sequence);
+		}
+		else if (Type == static_cast<uint8>(ERecordType::Acknowledge))
+		{
+			int64 AckOffset = PayloadOffset;
+			int64 AckSequence = 0;
+			while (AckOffset < PayloadOffset + Length && ReadValue(Content, AckOffset, AckSequence))
+			{
+				int32 OwnerIndex = INDEX_NONE;
+				if (OutEventSegments.RemoveAndCopyValue(AckSequence, OwnerIndex))
+				{
+					OutEvents.Remove(AckSequence);
+					Segments[OwnerIndex].Pending.Remove(AckSequence);
+				}
+			}
+		}
+		ValidSize = Offset;
+	}
+
+	if (ValidSize < Content.Num())
+	{
+		// A crash mid-append leaves a torn record, drop it so later appends start on a record boundary
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Truncating %lld torn bytes from %s"), Content.Num() - ValidSize, *Segment.Path);
+		Content.SetNum(ValidSize);
+		FFileHelper::SaveArrayToFile(Content, *Segment.Path);
+	}
+
+	Segment.Size = ValidSize;
+	return true;
+}
+
+bool FAccelByteTelemetrySpool::WriteRecord(ERecordType Type, int64 Sequence, const uint8* Payload, int32 PayloadSize)
+{
+	if (Segments.Num() > 0 && Segments.Last().Size >= MaxSegmentBytes)
+	{
+		CloseActiveSegment();
+	}
+
+	if (!OpenActiveSegment())
+	{
+		return false;
+	}
+
+	// Reset keeps the allocation, records are built in the same buffer once it has grown to the largest event
+	TArray<uint8>& Record = RecordBuffer;
+	Record.Reset(sizeof(uint8) + sizeof(int64) + sizeof(int32) + PayloadSize + sizeof(uint32));
+	AppendValue(Record, static_cast<uint8>(Type));
+	AppendValue(Record, Sequence);
+	AppendValue(Record, PayloadSize);
+	Record.Append(Payload, PayloadSize);
+	const uint32 Crc = FCrc::MemCrc32(Record.GetData(), Record.Num());
+	AppendValue(Record, Crc);
+
+	if (!ActiveHandle->Write(Record.GetData(), Record.Num()) || !ActiveHandle->Flush())
+	{
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Unable to append to %s"), *Segments.Last().Path);
+		CloseActiveSegment();
+		return false;
+	}
+
+	Segments.Last().Size += Record.Num();
+	TotalBytes += Record.Num();
+	return true;
+}
+
+bool FAccelByteTelemetrySpool::OpenActiveSegment()
+{
+	if (ActiveHandle.IsValid())
+	{
+		return true;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.CreateDirectoryTree(*Directory))
+	{
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Unable to create spool directory %s"), *Directory);
+		return false;
+	}
+
+	// Keep appending to the newest segment left by a previous session while it has room
+	const bool bReuseSegment = Segments.Num() > 0 && Segments.Last().Size > 0 && Segments.Last().Size < MaxSegmentBytes;
+	if (!bReuseSegment)
+	{
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.FirstSequence = NextSequence;
+		Segment.Path = GetSegmentPath(NextSequence);
+	}
+
+	FSegment& Segment = Segments.Last();
+	ActiveHandle.Reset(PlatformFile.OpenWrite(*Segment.Path, bReuseSegment));
+	if (!ActiveHandle.IsValid())
+	{
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Unable to open spool segment %s"), *Segment.Path);
+		if (!bReuseSegment)
+		{
+			Segments.Pop();
+		}
+		return false;
+	}
+
+	if (!bReuseSegment)
+	{
+		TArray<uint8> Header;
+		AppendValue(Header, SpoolFileMagic);
+		AppendValue(Header, SpoolFileVersion);
+		ActiveHandle->Write(Header.GetData(), Header.Num());
+		Segment.Size = SpoolHeaderSize;
+		TotalBytes += SpoolHeaderSize;
+	}
+	return true;
+}
+
+void FAccelByteTelemetrySpool::CloseActiveSegment()
+{
+	ActiveHandle.Reset();
+}
+
+void FAccelByteTelemetrySpool::DeleteOldestSegment()
+{
+	if (Segments.Num() == 1)
+	{
+		CloseActiveSegment();
+	}
+
+	const FSegment& Segment = Segments[0];
+	IFileManager::Get().Delete(*Segment.Path, false, true, true);
+	TotalBytes -= Segment.Size;
+	Segments.RemoveAt(0);
+}
+
+void FAccelByteTelemetrySpool::TruncateAcknowledged()
+{
+	while (Segments.Num() > 0 && Segments[0].Pending.Num() == 0)
+	{
+		DeleteOldestSegment();
+	}
+}
+
+void FAccelByteTelemetrySpool::EnforceSizeLimit()
+{
+	int32 Dropped = 0;
+	while (TotalBytes > MaxTotalBytes && Segments.Num() > 1)
+	{
+		Dropped += Segments[0].Pending.Num();
+		DeleteOldestSegment();
+	}
+
+	if (Dropped > 0)
+	{
+		DroppedCount += Dropped;
+		PendingCount -= Dropped;
+		UE_LOG(LogAccelByteTelemetrySpool, Warning, TEXT("Telemetry spool exceeded %lld bytes, dropped %d pending events"), MaxTotalBytes, Dropped);
+	}
+	TruncateAcknowledged();
+}
+
+} // Namespace AccelByte
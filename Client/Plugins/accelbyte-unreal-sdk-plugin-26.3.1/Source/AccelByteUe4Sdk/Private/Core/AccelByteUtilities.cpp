@@ -10,6 +10,7 @@
 #include "Core/AccelByteHttpClient.h"
 #include "Core/AccelByteIdValidator.h"
 #include "Models/AccelByteUserModels.h"
+#include "HAL/FileManager.h"
 #include "Misc/CommandLine.h"
 #include "Misc/CString.h"
 #include <memory>
@@ -1273,6 +1274,70 @@ void FAccelByteNetUtilities::UploadTo(FString const& Url
 }
 #endif
 
+FAccelByteFileDownloadPtr FAccelByteNetUtilities::DownloadToFile(FString const& Url
+	, FString const& FilePath
+	, FAccelByteTransferProgressDelegate const& OnProgress
+	, FVoidHandler const& OnDownloaded
+	, FErrorHandler const& OnError
+	, int64 ChunkBytes)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	if (!IsValidUrl(Url))
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), FString::Printf(TEXT("Invalid URL format %s"), *Url));
+		return nullptr;
+	}
+
+	FAccelByteFileDownloadPtr Download = MakeShared<FAccelByteFileDownload, ESPMode::ThreadSafe>(FRegistry::HttpRetryScheduler
+		, Url
+		, FilePath
+		, OnProgress
+		, OnDownloaded
+		, OnError
+		, ChunkBytes);
+	Download->Start();
+	return Download;
+}
+
+void FAccelByteNetUtilities::UploadFromFile(FString const& Url
+	, FString const& FilePath
+	, FAccelByteTransferProgressDelegate const& OnProgress
+	, FVoidHandler const& OnSuccess
+	, FErrorHandler const& OnError
+	, FString const& ContentType)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	if (!IsValidUrl(Url))
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), FString::Printf(TEXT("Invalid URL format %s"), *Url));
+		return;
+	}
+
+	const int64 TotalBytes = IFileManager::Get().FileSize(*FilePath);
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	if (TotalBytes < 0 || !Request->SetContentAsStreamedFile(FilePath))
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), FString::Printf(TEXT("Unable to read %s"), *FilePath));
+		return;
+	}
+
+	Request->SetURL(Url);
+	Request->SetVerb(TEXT("PUT"));
+	Request->SetHeader(TEXT("Content-Type"), ContentType);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+	Request->OnRequestProgress64().BindLambda([OnProgress, TotalBytes](FHttpRequestPtr, uint64 BytesSent, uint64)
+#else
+	Request->OnRequestProgress().BindLambda([OnProgress, TotalBytes](FHttpRequestPtr, int32 BytesSent, int32)
+#endif
+		{
+			OnProgress.ExecuteIfBound(static_cast<int64>(BytesSent), TotalBytes);
+		});
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+}
+
 #define REGEX_BASE_URL_WITH_DOMAIN "https?:\\/\\/(?:www\\.)?[-a-zA-Z0-9@:%._\\+~#=]{1,128}\\.[a-zA-Z0-9()]{1,6}"
 #define REGEX_BASE_URL_WITHOUT_DOMAIN "(?:(https?:\\/\\/)?((?:[0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+)|localhost))"
 #define REGEX_OPTIONAL_PORT "(:(?:[1-9]{1}[0-9]{1,4}|[0-9]{1}))?"
@@ -29,6 +29,7 @@ AccelByteWebSocket::AccelByteWebSocket(
 {
 	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
 	TickerDelegateHandle.Reset();
+	LoadSendQueueConfig();
 }
 
 AccelByteWebSocket::AccelByteWebSocket(
@@ -42,6 +43,7 @@ AccelByteWebSocket::AccelByteWebSocket(
 {
 	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
 	TickerDelegateHandle.Reset();
+	LoadSendQueueConfig();
 }
 
 AccelByteWebSocket::~AccelByteWebSocket()
@@ -57,6 +59,7 @@ AccelByteWebSocket::~AccelByteWebSocket()
 	}
 
 	TeardownTicker();
+	TeardownSendQueueTicker();
 	TeardownWebsocket();
 
 	ClientCreds = nullptr;
@@ -75,6 +78,7 @@ void AccelByteWebSocket::SetupWebSocket()
 	OnConnectionErrorQueue.Empty();
 	OnReconnectingAttemptQueue.Empty();
 	OnMassiveOutageQueue.Empty();
+	DropQueuedMessages();
 
 	TeardownWebsocket();
 
@@ -113,6 +117,11 @@ AccelByteWebSocket::FMessageReceiveDelegate& AccelByteWebSocket::OnMessageReceiv
 	return MessageReceiveDelegate;
 }
 
+AccelByteWebSocket::FMessageBatchReceiveDelegate& AccelByteWebSocket::OnMessageBatchReceived()
+{
+	return MessageBatchReceiveDelegate;
+}
+
 AccelByteWebSocket::FConnectionErrorDelegate& AccelByteWebSocket::OnConnectionError()
 {
 	return ConnectionErrorDelegate;
@@ -133,6 +142,16 @@ AccelByteWebSocket::FMassiveOutageMulticastDelegate& AccelByteWebSocket::OnMassi
 	return MassiveOutageDelegate;
 }
 
+AccelByteWebSocket::FSendBackpressureDelegate& AccelByteWebSocket::OnSendBackpressureChanged()
+{
+	return SendBackpressureDelegate;
+}
+
+AccelByteWebSocket::FSendDroppedDelegate& AccelByteWebSocket::OnSendDropped()
+{
+	return SendDroppedDelegate;
+}
+
 TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> AccelByteWebSocket::Create(
 	const FString& Url,
 	const FString& Protocol,
@@ -250,10 +269,251 @@ void AccelByteWebSocket::SendPing() const
 	}
 }
 
-void AccelByteWebSocket::Send(const FString& Message) const
+EWebSocketSendResult AccelByteWebSocket::Send(const FString& Message
+	, EWebSocketSendPriority Priority
+	, FName CoalesceKey)
+{
+	EWebSocketSendResult Result = EWebSocketSendResult::Queued;
+	bool bBackpressureChanged = false;
+	bool bBackpressured = false;
+	{
+		FScopeLock Lock(&SendQueueLock);
+		const double CurrentTime = FPlatformTime::Seconds();
+		const int32 SizeBytes = GetUtf8Size(Message);
+		if (SendStats.QueuedMessages == 0 && HasSendBudget(CurrentTime))
+		{
+			SendNow(Message, SizeBytes, CurrentTime, CurrentTime);
+			return EWebSocketSendResult::Sent;
+		}
+
+		if (!CoalesceKey.IsNone())
+		{
+			if (FOutboundMessagePtr* QueuedMessage = QueuedMessagesByCoalesceKey.Find(CoalesceKey))
+			{
+				// Keeps the place of the superseded message in the queue
+				SendStats.QueuedBytes += SizeBytes - (*QueuedMessage)->SizeBytes;
+				(*QueuedMessage)->Message = Message;
+				(*QueuedMessage)->SizeBytes = SizeBytes;
+				SendStats.CoalescedMessages++;
+				Result = EWebSocketSendResult::Coalesced;
+			}
+		}
+
+		if (Result == EWebSocketSendResult::Queued)
+		{
+			const uint8 QueueIndex = FMath::Min(static_cast<uint8>(Priority), static_cast<uint8>(EWebSocketSendPriority::Low));
+			FOutboundMessagePtr OutboundMessage = MakeShared<FOutboundMessage>(FOutboundMessage{Message, CoalesceKey, CurrentTime, SizeBytes});
+			SendQueues[QueueIndex].Enqueue(OutboundMessage);
+			if (!CoalesceKey.IsNone())
+			{
+				QueuedMessagesByCoalesceKey.Add(CoalesceKey, OutboundMessage);
+			}
+			SendStats.QueuedMessages++;
+			SendStats.QueuedBytes += SizeBytes;
+		}
+
+		bBackpressureChanged = UpdateSendBackpressure();
+		bBackpressured = SendStats.bBackpressured;
+
+		if (!SendQueueTickerHandle.IsValid())
+		{
+			SendQueueTickerHandle = FTickerAlias::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::SendQueueTick));
+		}
+	}
+
+	if (bBackpressureChanged)
+	{
+		SendBackpressureDelegate.Broadcast(bBackpressured);
+	}
+	return Result;
+}
+
+void AccelByteWebSocket::SetSendRateLimit(int32 BytesPerSecond, int32 BackpressureThresholdBytes)
+{
+	bool bBackpressureChanged = false;
+	bool bBackpressured = false;
+	{
+		FScopeLock Lock(&SendQueueLock);
+		SendRateLimitBytesPerSecond = FMath::Max(BytesPerSecond, 0);
+		SendBackpressureThresholdBytes = FMath::Max(BackpressureThresholdBytes, 1);
+		SendBudgetBytes = SendRateLimitBytesPerSecond;
+		SendBudgetUpdateTime = FPlatformTime::Seconds();
+
+		bBackpressureChanged = UpdateSendBackpressure();
+		bBackpressured = SendStats.bBackpressured;
+	}
+
+	if (bBackpressureChanged)
+	{
+		SendBackpressureDelegate.Broadcast(bBackpressured);
+	}
+}
+
+bool AccelByteWebSocket::IsSendBackpressured() const
+{
+	FScopeLock Lock(&SendQueueLock);
+	return SendStats.bBackpressured;
+}
+
+FWebSocketSendStats AccelByteWebSocket::GetSendStats() const
+{
+	FScopeLock Lock(&SendQueueLock);
+	return SendStats;
+}
+
+void AccelByteWebSocket::LoadSendQueueConfig()
+{
+	int32 BytesPerSecond = 0;
+	int32 BackpressureThresholdBytes = DefaultSendBackpressureThresholdBytes;
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("WebSocket"), TEXT("SendRateLimitBytesPerSecond"), BytesPerSecond);
+	FAccelByteUtilities::LoadABConfigFallback(TEXT("WebSocket"), TEXT("SendBackpressureThresholdBytes"), BackpressureThresholdBytes);
+	SetSendRateLimit(BytesPerSecond, BackpressureThresholdBytes);
+}
+
+bool AccelByteWebSocket::HasSendBudget(double CurrentTime)
+{
+	if (SendRateLimitBytesPerSecond <= 0)
+	{
+		return true;
+	}
+
+	SendBudgetBytes = FMath::Min<double>(SendBudgetBytes + (CurrentTime - SendBudgetUpdateTime) * SendRateLimitBytesPerSecond
+		, SendRateLimitBytesPerSecond);
+	SendBudgetUpdateTime = CurrentTime;
+
+	// A message bigger than the remaining budget is still sent, the budget goes negative and holds the next ones back
+	return SendBudgetBytes > 0.0;
+}
+
+void AccelByteWebSocket::SendNow(const FString& Message, int32 SizeBytes, double EnqueueTime, double CurrentTime)
 {
 	ACCELBYTE_SERVICE_LOGGING_WEBSOCKET_REQUEST(Message);
-	WebSocket->Send(Message);
+	if (WebSocket.IsValid())
+	{
+		WebSocket->Send(Message);
+	}
+
+	SendBudgetBytes -= SizeBytes;
+
+	const double Latency = CurrentTime - EnqueueTime;
+	SendStats.SentMessages++;
+	SendStats.SentBytes += SizeBytes;
+	TotalSendLatencySeconds += Latency;
+	SendStats.AverageSendLatencySeconds = TotalSendLatencySeconds / SendStats.SentMessages;
+	SendStats.MaxSendLatencySeconds = FMath::Max(SendStats.MaxSendLatencySeconds, Latency);
+}
+
+bool AccelByteWebSocket::UpdateSendBackpressure()
+{
+	const bool bBackpressured = SendStats.QueuedBytes >= SendBackpressureThresholdBytes;
+	if (bBackpressured == SendStats.bBackpressured)
+	{
+		return false;
+	}
+
+	UE_LOG(LogAccelByteWebsocket, Log, TEXT("Outbound queue of %s %s backpressure threshold, %lld bytes queued")
+		, *Url, bBackpressured ? TEXT("reached") : TEXT("back under"), SendStats.QueuedBytes);
+	SendStats.bBackpressured = bBackpressured;
+	return true;
+}
+
+bool AccelByteWebSocket::SendQueueTick(float DeltaTime)
+{
+	bool bHasQueuedMessages = false;
+	bool bBackpressureChanged = false;
+	bool bBackpressured = false;
+	{
+		FScopeLock Lock(&SendQueueLock);
+
+		// Queued messages wait for the connection, only high priority ones outlive the websocket being set up again
+		if (WebSocket.IsValid() && WebSocket->IsConnected())
+		{
+			const double CurrentTime = FPlatformTime::Seconds();
+			for (TQueue<FOutboundMessagePtr>& SendQueue : SendQueues)
+			{
+				FOutboundMessagePtr OutboundMessage;
+				while (HasSendBudget(CurrentTime) && SendQueue.Dequeue(OutboundMessage))
+				{
+					if (!OutboundMessage->CoalesceKey.IsNone())
+					{
+						QueuedMessagesByCoalesceKey.Remove(OutboundMessage->CoalesceKey);
+					}
+					SendStats.QueuedMessages--;
+					SendStats.QueuedBytes -= OutboundMessage->SizeBytes;
+
+					SendNow(OutboundMessage->Message, OutboundMessage->SizeBytes, OutboundMessage->EnqueueTime, CurrentTime);
+				}
+			}
+		}
+
+		bBackpressureChanged = UpdateSendBackpressure();
+		bBackpressured = SendStats.bBackpressured;
+
+		bHasQueuedMessages = SendStats.QueuedMessages > 0;
+		if (!bHasQueuedMessages)
+		{
+			// Returning false removes this ticker
+			SendQueueTickerHandle.Reset();
+		}
+	}
+
+	if (bBackpressureChanged)
+	{
+		SendBackpressureDelegate.Broadcast(bBackpressured);
+	}
+	return bHasQueuedMessages;
+}
+
+void AccelByteWebSocket::DropQueuedMessages()
+{
+	TArray<FString> DroppedMessages;
+	bool bBackpressureChanged = false;
+	bool bBackpressured = false;
+	{
+		FScopeLock Lock(&SendQueueLock);
+		for (uint8 QueueIndex = static_cast<uint8>(EWebSocketSendPriority::Normal); QueueIndex < static_cast<uint8>(EWebSocketSendPriority::Count); QueueIndex++)
+		{
+			FOutboundMessagePtr OutboundMessage;
+			while (SendQueues[QueueIndex].Dequeue(OutboundMessage))
+			{
+				if (!OutboundMessage->CoalesceKey.IsNone())
+				{
+					QueuedMessagesByCoalesceKey.Remove(OutboundMessage->CoalesceKey);
+				}
+				SendStats.QueuedMessages--;
+				SendStats.QueuedBytes -= OutboundMessage->SizeBytes;
+				DroppedMessages.Add(MoveTemp(OutboundMessage->Message));
+			}
+		}
+
+		bBackpressureChanged = UpdateSendBackpressure();
+		bBackpressured = SendStats.bBackpressured;
+	}
+
+	if (DroppedMessages.Num() > 0)
+	{
+		UE_LOG(LogAccelByteWebsocket, Log, TEXT("Dropped %d queued messages of %s, the websocket is set up again"), DroppedMessages.Num(), *Url);
+		SendDroppedDelegate.Broadcast(DroppedMessages);
+	}
+	if (bBackpressureChanged)
+	{
+		SendBackpressureDelegate.Broadcast(bBackpressured);
+	}
+}
+
+int32 AccelByteWebSocket::GetUtf8Size(const FString& Message)
+{
+	return FTCHARToUTF8_Convert::ConvertedLength(*Message, Message.Len());
+}
+
+void AccelByteWebSocket::TeardownSendQueueTicker()
+{
+	FScopeLock Lock(&SendQueueLock);
+	if (SendQueueTickerHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(SendQueueTickerHandle);
+		SendQueueTickerHandle.Reset();
+	}
 }
 
 void AccelByteWebSocket::OnConnectionConnected()
@@ -489,12 +749,29 @@ bool AccelByteWebSocket::MessageTick(float DeltaTime)
 		ConnectionErrorDelegate.Broadcast(Msg);
 	}
 
-	while(!OnMessageQueue.IsEmpty())
+	if (MessageBatchReceiveDelegate.IsBound())
 	{
+		// Dequeue moves the messages, the batch only holds them until it has been broadcast
 		FString Msg;
-		OnMessageQueue.Dequeue(Msg);
+		while (OnMessageQueue.Dequeue(Msg))
+		{
+			MessageReceiveDelegate.Broadcast(Msg);
+			MessageBatch.Emplace(MoveTemp(Msg));
+		}
 
-		MessageReceiveDelegate.Broadcast(Msg);
+		if (MessageBatch.Num() > 0)
+		{
+			MessageBatchReceiveDelegate.Broadcast(MessageBatch);
+			MessageBatch.Reset();
+		}
+	}
+	else
+	{
+		FString Msg;
+		while (OnMessageQueue.Dequeue(Msg))
+		{
+			MessageReceiveDelegate.Broadcast(Msg);
+		}
 	}
 
 	while(!OnConnectionClosedQueue.IsEmpty())
@@ -0,0 +1,109 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/Ping/AccelByteLatencyEstimator.h"
+
+namespace
+{
+	constexpr int32 MinStableRounds = 3;
+
+	// A round further than this many jitters away from the smoothed latency is a change, not noise
+	constexpr float StableDeviationJitters = 3.0f;
+	constexpr float StableDeviationFloorMs = 5.0f;
+
+	// Gain of the RFC 3550 interarrival jitter estimator
+	constexpr float JitterGain = 1.0f / 16.0f;
+}
+
+FAccelByteLatencyEstimator::FAccelByteLatencyEstimator(int32 InWindowSize, float InSmoothingFactor)
+	: WindowSize(FMath::Max(InWindowSize, 1))
+	, SmoothingFactor(FMath::Clamp(InSmoothingFactor, 0.01f, 1.0f))
+{
+	Rounds.Reserve(WindowSize);
+}
+
+void FAccelByteLatencyEstimator::AddRound(float LatencyMs, int32 Sent, int32 Received)
+{
+	if (Sent <= 0)
+	{
+		return;
+	}
+
+	const FRound Round{LatencyMs, Sent, FMath::Clamp(Received, 0, Sent)};
+	if (Rounds.Num() < WindowSize)
+	{
+		Rounds.Add(Round);
+	}
+	else
+	{
+		Rounds[NextRoundIndex] = Round;
+	}
+	NextRoundIndex = (NextRoundIndex + 1) % WindowSize;
+
+	bLastRoundLost = Round.Received < Round.Sent;
+	if (Round.Received == 0)
+	{
+		++ConsecutiveLostRounds;
+		return;
+	}
+	ConsecutiveLostRounds = 0;
+
+	if (!bHasLatency)
+	{
+		SmoothedLatency = LatencyMs;
+		Jitter = 0.0f;
+		bLastRoundDeviated = false;
+	}
+	else
+	{
+		const float AllowedDeviation = FMath::Max(StableDeviationJitters * Jitter, StableDeviationFloorMs);
+		bLastRoundDeviated = FMath::Abs(LatencyMs - SmoothedLatency) > AllowedDeviation;
+
+		Jitter += (FMath::Abs(LatencyMs - LastLatency) - Jitter) * JitterGain;
+		SmoothedLatency += (LatencyMs - SmoothedLatency) * SmoothingFactor;
+	}
+
+	LastLatency = LatencyMs;
+	bHasLatency = true;
+}
+
+float FAccelByteLatencyEstimator::GetLatencyP95() const
+{
+	TArray<float> Latencies;
+	Latencies.Reserve(Rounds.Num());
+	for (FRound const& Round : Rounds)
+	{
+		if (Round.Received > 0)
+		{
+			Latencies.Add(Round.LatencyMs);
+		}
+	}
+
+	if (Latencies.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	Latencies.Sort();
+	const int32 Index = FMath::CeilToInt(0.95f * Latencies.Num()) - 1;
+	return Latencies[FMath::Clamp(Index, 0, Latencies.Num() - 1)];
+}
+
+float FAccelByteLatencyEstimator::GetPacketLoss() const
+{
+	int32 Sent = 0;
+	int32 Received = 0;
+	for (FRound const& Round : Rounds)
+	{
+		Sent += Round.Sent;
+		Received += Round.Received;
+	}
+
+	return Sent > 0 ? static_cast<float>(Sent - Received) / Sent : 0.0f;
+}
+
+bool FAccelByteLatencyEstimator::IsStable() const
+{
+	return bHasLatency && Rounds.Num() >= MinStableRounds && !bLastRoundDeviated && !bLastRoundLost;
+}
@@ -71,14 +71,7 @@ void FAccelBytePing::SendIcmpPing(FString const& Address, int32 Port, float Time
 
 void FAccelBytePing::SendUdpPing(FPingConfig const& Config, FPingCompleteDelegate const& OnPingCompleteDelegate)
 {
-	ISocketSubsystem* const SocketSub = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
-
-	FAccelByteUdpPingAsync* const Ping = new FAccelByteUdpPingAsync(SocketSub, OnPingCompleteDelegate);
-	check(Ping);
-	if (Ping)
-	{
-		Ping->Start(Config);
-	}
+	FAccelByteUdpPinger::Get().Ping(Config, OnPingCompleteDelegate);
 }
 
 void FAccelBytePing::SendUdpPing(FString const& Address, int32 Port, float Timeout, FPingCompleteDelegate const& OnPingCompleteDelegate)
@@ -89,4 +82,9 @@ void FAccelBytePing::SendUdpPing(FString const& Address, int32 Port, float Timeo
 	Config.Timeout = Timeout;
 	Config.PingNum = DefaultPingNum;
 	SendUdpPing(Config, OnPingCompleteDelegate);
+}
+
+void FAccelBytePing::ShutdownUdpPinger()
+{
+	FAccelByteUdpPinger::Get().Shutdown();
 }
\ No newline at end of file
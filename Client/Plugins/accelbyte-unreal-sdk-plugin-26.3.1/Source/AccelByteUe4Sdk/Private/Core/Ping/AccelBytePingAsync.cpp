@@ -3,305 +3,402 @@
 // and restrictions contact your company contract manager.
 
 #include "AccelBytePingAsync.h"
+#include "Async/Async.h"
+#include "HAL/RunnableThread.h"
+#include "Core/AccelByteReport.h"
 #include "Core/Ping/AccelBytePing.h"
 
-FAccelByteUdpPingThread::FAccelByteUdpPingThread(ISocketSubsystem* const InSocketSub
-	, const FPingConfig& InConfig
-	, FGotResponseDelegate OnGotResponseDelegate
-	, FPingResultStatusDelegate OnPingCompleteDelegate)
-	: OnComplete(OnPingCompleteDelegate)
-	, OnGotResponse(OnGotResponseDelegate)
-	, Config(InConfig)
-	, SocketSubsystem(InSocketSub)
-	, bIsComplete(false)
-	, bIsCanceled(false)
+namespace
 {
+	const ANSICHAR PingPayload[] = "PING";
+	const ANSICHAR PongPayload[] = "PONG";
+	constexpr int32 PayloadSize = 4;
+	constexpr int32 ReplyBufferSize = 64;
+
+	// Upper bound of a single wait, so targets queued while waiting for replies are not delayed
+	constexpr double MaxWaitSliceSeconds = 0.01;
+
+	// A socket can only wait on itself, with both an IPv4 and an IPv6 socket each one is waited on in turn for this
+	// long, so a reply is picked up and stamped at most this late
+	constexpr double MultiSocketWaitSeconds = 0.001;
+
+	// Quiet period after a probe timed out before the next one is sent. A late reply of the lost probe arriving in
+	// the meantime finds nothing outstanding and is dropped, instead of being credited to the next probe.
+	constexpr double MaxLateReplyGuardSeconds = 0.5;
 }
 
-FAccelByteUdpPingThread::~FAccelByteUdpPingThread()
+FAccelByteUdpPinger& FAccelByteUdpPinger::Get()
 {
+	static FAccelByteUdpPinger Instance;
+	return Instance;
 }
 
-uint32 FAccelByteUdpPingThread::Run()
+FAccelByteUdpPinger::~FAccelByteUdpPinger()
 {
-	FPingResultStatus PingResultStatus = FPingResultStatus::Invalid;
-	if (!CreateAddress() || !CreateSocket())
+	if (Thread != nullptr)
 	{
-		OnComplete.ExecuteIfBound(PingResultStatus);
-		return 0;
+		Shutdown();
 	}
-
-	PingResultStatus = SendPing(TEXT("PING"));
-	OnComplete.ExecuteIfBound(PingResultStatus);
-
-	DestroySocket();
-	return 0;
 }
 
-void FAccelByteUdpPingThread::Stop()
+void FAccelByteUdpPinger::Ping(FPingConfig const& Config, FPingCompleteDelegate const& OnComplete)
 {
-	bIsCanceled = true;
-}
+	FTargetPtr Target = MakeShared<FTarget>();
+	Target->Config = Config;
+	Target->OnComplete = OnComplete;
 
-void FAccelByteUdpPingThread::Exit()
-{
+	FScopeLock Lock(&ThreadLock);
+	if (Thread == nullptr)
+	{
+		SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+		if (!SocketSubsystem)
+		{
+			Complete(Target, FPingResultStatus::Invalid);
+			return;
+		}
+
+		bStopping = false;
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+		Thread = FRunnableThread::Create(this, TEXT("AccelByteUdpPinger"));
+		if (Thread == nullptr)
+		{
+			FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+			WakeEvent = nullptr;
+			Complete(Target, FPingResultStatus::Invalid);
+			return;
+		}
+	}
 
+	NewTargets.Enqueue(Target);
+	WakeEvent->Trigger();
 }
 
-bool FAccelByteUdpPingThread::CreateSocket()
+void FAccelByteUdpPinger::Shutdown()
 {
-	if (!SocketSubsystem)
+	FScopeLock Lock(&ThreadLock);
+	if (Thread == nullptr)
 	{
-		return false;
+		return;
 	}
 
-	if (!IpAddress.IsValid())
-	{
-		return false;
-	}
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
 
-	Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("ABPing"), IpAddress->GetProtocolType());
-	if (!SocketIsValid())
+uint32 FAccelByteUdpPinger::Run()
+{
+	while (!bStopping)
 	{
-		return false;
+		AcceptNewTargets();
+		if (ActiveTargets.Num() == 0)
+		{
+			WakeEvent->Wait();
+			continue;
+		}
+
+		WaitForReplies();
+		ReceiveReplies();
+		ExpireProbes(FPlatformTime::Seconds());
+
+		ActiveTargets.RemoveAllSwap([](FTargetPtr const& Target)
+			{
+				return Target->bCompleted;
+			});
 	}
 
-	if (!Socket->SetNonBlocking(true))
+	AcceptNewTargets();
+	for (FTargetPtr const& Target : ActiveTargets)
 	{
-		SocketSubsystem->DestroySocket(Socket);
-		return false;
+		if (!Target->bCompleted)
+		{
+			Complete(Target, FPingResultStatus::Canceled);
+		}
 	}
+	ActiveTargets.Empty();
+	OutstandingProbes.Empty();
+	OutstandingSequencesByEndpoint.Empty();
+	DestroySockets();
 
-	return true;
+	return 0;
 }
 
-void FAccelByteUdpPingThread::DestroySocket()
+void FAccelByteUdpPinger::Stop()
 {
-	if (SocketSubsystem && Socket)
+	bStopping = true;
+	if (WakeEvent != nullptr)
 	{
-		SocketSubsystem->DestroySocket(Socket);
-		Socket = nullptr;
+		WakeEvent->Trigger();
 	}
 }
 
-uint64 FAccelByteUdpPingThread::GetCurrentTime()
+void FAccelByteUdpPinger::AcceptNewTargets()
 {
-	return FPlatformTime::Cycles64();
+	FTargetPtr Target;
+	while (NewTargets.Dequeue(Target))
+	{
+		bool bIpStringValid = false;
+		Target->Address = SocketSubsystem->CreateInternetAddr();
+		if (Target->Address.IsValid() && !Target->Config.Address.IsEmpty())
+		{
+			Target->Address->SetIp(*Target->Config.Address, bIpStringValid);
+		}
+
+		if (!bIpStringValid)
+		{
+			Complete(Target, FPingResultStatus::Invalid);
+			continue;
+		}
+
+		Target->Address->SetPort(Target->Config.Port);
+		Target->Endpoint = Target->Address->ToString(true);
+		ActiveTargets.Add(Target);
+		SendNextProbe(Target);
+	}
 }
 
-bool FAccelByteUdpPingThread::CreateAddress()
+void FAccelByteUdpPinger::SendNextProbe(FTargetPtr const& Target)
 {
-	if (!SocketSubsystem)
+	FSocket* Socket = GetSocket(Target->Address->GetProtocolType());
+	if (Socket == nullptr)
 	{
-		return false;
+		Complete(Target, FPingResultStatus::Invalid);
+		return;
 	}
 
-	IpAddress = SocketSubsystem->CreateInternetAddr();
-	if (!IpAddress.IsValid() || Config.Address.IsEmpty())
+	while (Target->Responses.Num() < Target->Config.PingNum)
 	{
-		return false;
-	}
+		int32 BytesSent = 0;
+		if (!Socket->SendTo(reinterpret_cast<uint8 const*>(PingPayload), PayloadSize, BytesSent, *Target->Address))
+		{
+			FPingResponse Response{};
+			Response.Status = FPingResponseStatus::Unreachable;
+			Target->Responses.Add(Response);
+			continue;
+		}
 
-	bool bIpStringValid{};
-	IpAddress->SetIp(*Config.Address, bIpStringValid);
+		// Zero is never used so a target without an outstanding probe is easy to tell apart
+		LastSequence = LastSequence == MAX_uint32 ? 1 : LastSequence + 1;
 
-	if (!bIpStringValid)
-	{
-		return false;
+		Target->Sequence = LastSequence;
+		Target->SentTime = FPlatformTime::Seconds();
+		Target->Deadline = Target->SentTime + Target->Config.Timeout;
+		Target->bWaitingReply = true;
+		OutstandingProbes.Add(Target->Sequence, Target);
+		OutstandingSequencesByEndpoint.FindOrAdd(Target->Endpoint).Add(Target->Sequence);
+		return;
 	}
 
-	IpAddress->SetPort(Config.Port);
-	return true;
+	Complete(Target, FPingResultStatus::Success);
 }
 
-bool FAccelByteUdpPingThread::SocketReceiveData(uint8* Data, int32 BufferSize, int32& BytesRead)
+void FAccelByteUdpPinger::WaitForReplies()
 {
-	if (!SocketIsValid())
+	const double Now = FPlatformTime::Seconds();
+	double NextDeadline = Now + MaxWaitSliceSeconds;
+	for (FTargetPtr const& Target : ActiveTargets)
 	{
-		return false;
+		if (Target->bWaitingReply)
+		{
+			NextDeadline = FMath::Min(NextDeadline, Target->Deadline);
+		}
+		else if (Target->HoldUntil > 0.0)
+		{
+			NextDeadline = FMath::Min(NextDeadline, Target->HoldUntil);
+		}
 	}
 
-	TSharedRef<FInternetAddr> RecvAddr = SocketSubsystem->CreateInternetAddr();
-	return Socket->RecvFrom(Data, BufferSize, BytesRead, *RecvAddr);
+	const FTimespan WaitTime = FTimespan::FromSeconds(FMath::Max(NextDeadline - Now, 0.0));
+	if (Sockets.Num() == 1)
+	{
+		for (auto const& Socket : Sockets)
+		{
+			Socket.Value->Wait(ESocketWaitConditions::WaitForRead, WaitTime);
+		}
+	}
+	else if (Sockets.Num() > 1)
+	{
+		// Sleeping through the slice would stamp every reply that arrived during it up to a slice late
+		const FTimespan SocketWaitTime = FTimespan::FromSeconds(MultiSocketWaitSeconds);
+		do
+		{
+			for (auto const& Socket : Sockets)
+			{
+				if (Socket.Value->Wait(ESocketWaitConditions::WaitForRead, SocketWaitTime))
+				{
+					return;
+				}
+			}
+		}
+		while (FPlatformTime::Seconds() < NextDeadline);
+	}
+	else
+	{
+		FPlatformProcess::Sleep(WaitTime.GetTotalSeconds());
+	}
 }
 
-bool FAccelByteUdpPingThread::SocketSendData(const FString& StringToSend, int32& BytesSent)
+void FAccelByteUdpPinger::ReceiveReplies()
 {
-	if (!SocketIsValid())
+	for (auto const& Socket : Sockets)
 	{
-		return false;
+		TSharedRef<FInternetAddr> FromAddress = SocketSubsystem->CreateInternetAddr(Socket.Key);
+		uint32 PendingDataSize = 0;
+		while (Socket.Value->HasPendingData(PendingDataSize))
+		{
+			uint8 Buffer[ReplyBufferSize];
+			int32 BytesRead = 0;
+			if (!Socket.Value->RecvFrom(Buffer, ReplyBufferSize, BytesRead, *FromAddress))
+			{
+				break;
+			}
+
+			HandleReply(*FromAddress, Buffer, BytesRead, FPlatformTime::Seconds());
+		}
 	}
-	
-	return Socket->SendTo((uint8*)TCHAR_TO_UTF8(*StringToSend), StringToSend.Len(), BytesSent, *IpAddress);
 }
 
-bool FAccelByteUdpPingThread::SocketWaitData()
+void FAccelByteUdpPinger::HandleReply(FInternetAddr const& FromAddress, uint8 const* Data, int32 BytesRead, double ReceivedTime)
 {
-	if (!SocketIsValid())
+	const FString Endpoint = FromAddress.ToString(true);
+	TArray<uint32>* Sequences = OutstandingSequencesByEndpoint.Find(Endpoint);
+	if (Sequences == nullptr || Sequences->Num() == 0)
 	{
-		return false;
+		UE_LOG(LogAccelByte, Verbose, TEXT("Ignoring UDP ping reply from %s, no probe is waiting for it"), *Endpoint);
+		return;
 	}
 
-	return Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(Config.Timeout));
-}
+	const uint32 Sequence = (*Sequences)[0];
+	FTargetPtr Target = OutstandingProbes.FindRef(Sequence);
+	if (!Target.IsValid())
+	{
+		Sequences->RemoveAt(0);
+		return;
+	}
+	ForgetOutstandingProbe(*Target);
 
-bool FAccelByteUdpPingThread::SocketIsValid()
-{
-	return Socket != nullptr;
+	FPingResponse Response{};
+	Response.DataSent = UTF8_TO_TCHAR(PingPayload);
+	if (BytesRead >= PayloadSize && FMemory::Memcmp(Data, PongPayload, PayloadSize) == 0)
+	{
+		Response.Status = FPingResponseStatus::Success;
+		Response.RoundTripTime = ReceivedTime - Target->SentTime;
+	}
+	Target->Responses.Add(Response);
+
+	SendNextProbe(Target);
 }
 
-FPingResultStatus FAccelByteUdpPingThread::SendPing(const FString& PingString)
+void FAccelByteUdpPinger::ExpireProbes(double Now)
 {
-	for (int PingIndex = 0; PingIndex < Config.PingNum; ++PingIndex)
+	// Sending the next probe can complete a target, which is only swept out of ActiveTargets by the caller
+	for (int32 Index = 0; Index < ActiveTargets.Num(); ++Index)
 	{
-		if (!SocketIsValid())
+		FTargetPtr Target = ActiveTargets[Index];
+		if (Target->bCompleted)
 		{
-			return FPingResultStatus::Invalid;
+			continue;
 		}
 
-		if (bIsCanceled)
+		if (!Target->bWaitingReply)
 		{
-			return FPingResultStatus::Canceled;
+			if (Target->HoldUntil > 0.0 && Target->HoldUntil <= Now)
+			{
+				Target->HoldUntil = 0.0;
+				SendNextProbe(Target);
+			}
+			continue;
 		}
 
-		int32 BytesSent;
-		FPingResponse Response{};
-		if (!SocketSendData(PingString, BytesSent))
+		if (Target->Deadline > Now)
 		{
-			Response.Status = FPingResponseStatus::Unreachable;
-			OnGotResponse.ExecuteIfBound(Response);
 			continue;
 		}
 
-		uint64 SentTime = GetCurrentTime();
-		Response.DataSent = PingString.Left(BytesSent);
-		if (SocketWaitData())
+		ForgetOutstandingProbe(*Target);
+
+		FPingResponse Response{};
+		Response.DataSent = UTF8_TO_TCHAR(PingPayload);
+		Response.Status = FPingResponseStatus::Timeout;
+		Target->Responses.Add(Response);
+
+		if (Target->Responses.Num() < Target->Config.PingNum)
 		{
-			uint64 CurrentTime = GetCurrentTime();
-			const uint8 ResultPacketSize = 4;
-			uint8 ResultBuffer[ResultPacketSize + 1]; // expected "PONG" and taking accounts of null terminators 
-			int32 BytesRead = 0;
-			if (SocketReceiveData(ResultBuffer, ResultPacketSize, BytesRead))
-			{
-				// make sure buffer is null terminated
-				ResultBuffer[ResultPacketSize] = 0;
-				
-				Response = CreateResponse(ResultBuffer, BytesRead, SentTime, CurrentTime);
-			}
-			else
-			{
-				Response.Status = FPingResponseStatus::Unreachable;
-			}
+			Target->HoldUntil = Now + FMath::Min<double>(Target->Config.Timeout, MaxLateReplyGuardSeconds);
 		}
 		else
 		{
-			Response.Status = FPingResponseStatus::Timeout;
+			SendNextProbe(Target);
 		}
-
-		OnGotResponse.ExecuteIfBound(Response);
 	}
-
-	return FPingResultStatus::Success;
 }
 
-FPingResponse FAccelByteUdpPingThread::CreateResponse(uint8* Data, int32 BytesRead, uint64 SentTime, uint64 CurrentTime)
+void FAccelByteUdpPinger::ForgetOutstandingProbe(FTarget& Target)
 {
-	FPingResponse Response{};
-	if (BytesRead > 3)
+	OutstandingProbes.Remove(Target.Sequence);
+	if (TArray<uint32>* Sequences = OutstandingSequencesByEndpoint.Find(Target.Endpoint))
 	{
-		FString Received = UTF8_TO_TCHAR(Data);
-		if (Received.StartsWith(TEXT("PONG")))
+		Sequences->Remove(Target.Sequence);
+		if (Sequences->Num() == 0)
 		{
-			double DeltaTime = (CurrentTime - SentTime) * FPlatformTime::GetSecondsPerCycle64();
-			Response.Status = FPingResponseStatus::Success;
-			Response.RoundTripTime = DeltaTime;
+			OutstandingSequencesByEndpoint.Remove(Target.Endpoint);
 		}
 	}
-	return Response;
-
+	Target.Sequence = 0;
+	Target.bWaitingReply = false;
 }
 
-FAccelByteUdpPingAsync::FAccelByteUdpPingAsync(ISocketSubsystem* const InSocketSub, const FPingCompleteDelegate& InCompletionDelegate)
-	: SocketSubsystem(InSocketSub)
-	, OnPingCompleteDelegate(InCompletionDelegate)
-	, bThreadCompleted(false)
-{}
-
-FAccelByteUdpPingAsync::~FAccelByteUdpPingAsync()
+void FAccelByteUdpPinger::Complete(FTargetPtr const& Target, FPingResultStatus Status)
 {
-	check(IsInGameThread());
-
-	if (FutureResult.IsValid())
+	if (Target->bWaitingReply)
 	{
-		FutureResult.Wait();
+		ForgetOutstandingProbe(*Target);
 	}
+	Target->bCompleted = true;
+
+	const FPingResult Result = PingResponsesToResult(Target->Responses, Status);
+	AsyncTask(ENamedThreads::GameThread, [OnComplete = Target->OnComplete, Result]()
+		{
+			OnComplete.ExecuteIfBound(Result);
+		});
 }
 
-void FAccelByteUdpPingAsync::Start(const FPingConfig& Config)
+FSocket* FAccelByteUdpPinger::GetSocket(FName ProtocolType)
 {
-	if (!SocketSubsystem)
+	if (FSocket** Found = Sockets.Find(ProtocolType))
 	{
-		bThreadCompleted = true;
-		return;
+		return *Found;
 	}
 
-	bThreadCompleted = false;
-	TFunction<FPingResult()> WorkerTask = [this, Config]()
+	FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("ABPing"), ProtocolType);
+	if (Socket == nullptr)
 	{
-		auto Result = FAccelByteUdpPingAsync::RunWorker(SocketSubsystem, Config);
-		bThreadCompleted = true;
-		return Result;
-	};
-
-	FutureResult = AsyncThread(WorkerTask);
-}
-
-bool FAccelByteUdpPingAsync::Tick(float DeltaTime)
-{
-	QUICK_SCOPE_CYCLE_COUNTER(STAT_ABPing_Tick);
+		return nullptr;
+	}
 
-	if (bThreadCompleted)
+	if (!Socket->SetNonBlocking(true))
 	{
-		FPingResult Result{};
-		if (FutureResult.IsValid())
-		{
-			Result = FutureResult.Get();
-		}
-
-		OnPingCompleteDelegate.ExecuteIfBound(Result);
-
-		delete this;
-		return false;
+		SocketSubsystem->DestroySocket(Socket);
+		return nullptr;
 	}
 
-	return true;
+	Sockets.Add(ProtocolType, Socket);
+	return Socket;
 }
 
-FPingResult FAccelByteUdpPingAsync::RunWorker(ISocketSubsystem* const SocketSub, const FPingConfig& Config)
+void FAccelByteUdpPinger::DestroySockets()
 {
-	FPingResult Result{};
-
-	TArray<FPingResponse> Responses;
-	FGotResponseDelegate OnGotResponse;
-	OnGotResponse.BindLambda([&Responses](FPingResponse Result)
-		{
-			Responses.Add(Result);
-		});
-
-	FPingResultStatusDelegate OnCompleted;
-	OnCompleted.BindLambda([&Result, &Responses](FPingResultStatus EndStatus)
-		{
-			Result = PingResponsesToResult(Responses, EndStatus);
-		});
-
-	FAccelByteUdpPingThread PingWorker(SocketSub, Config, OnGotResponse, OnCompleted);
-	PingWorker.Init();
-	PingWorker.Run();
-
-	return Result;
+	for (auto const& Socket : Sockets)
+	{
+		SocketSubsystem->DestroySocket(Socket.Value);
+	}
+	Sockets.Empty();
 }
 
-FPingResult FAccelByteUdpPingAsync::PingResponsesToResult(const TArray<FPingResponse>& PingResponses, FPingResultStatus EndStatus)
+FPingResult FAccelByteUdpPinger::PingResponsesToResult(TArray<FPingResponse> const& PingResponses, FPingResultStatus EndStatus)
 {
 	FPingResult PingResult{};
 	PingResult.Status = EndStatus;
@@ -310,7 +407,7 @@ FPingResult FAccelByteUdpPingAsync::PingResponsesToResult(const TArray<FPingResp
 		PingResult.AverageRoundTrip = 0.0f;
 		PingResult.MaximumRoundTrip = PingResponses[0].RoundTripTime;
 		PingResult.MinimumRoundTrip = PingResponses[0].RoundTripTime;
-		
+
 		for (auto const& Response : PingResponses)
 		{
 			if (Response.Status == FPingResponseStatus::Success)
@@ -6,15 +6,12 @@
 
 #include "CoreMinimal.h"
 
-#include "Async/Async.h"
-#include "Async/Future.h"
-#include "Containers/Ticker.h"
+#include "Containers/Queue.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
 #include "Icmp.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
-#include "Core/AccelByteDefines.h"
 #include "Core/Ping/AccelBytePing.h"
 
 using FPingResultStatus = EIcmpEchoManyStatus;
@@ -34,69 +31,85 @@ struct FPingResponse
 	}
 };
 
-DECLARE_DELEGATE_OneParam(FGotResponseDelegate, FPingResponse);
-DECLARE_DELEGATE_OneParam(FPingResultStatusDelegate, FPingResultStatus);
-
-class ACCELBYTEUE4SDK_API FAccelByteUdpPingThread : public FRunnable
+/**
+ * @brief Pings any number of UDP targets from one shared non-blocking socket and one worker thread.
+ *
+ * Every target gets its first probe as soon as it is queued, then its next probe once the previous one is answered or
+ * has reached the target's own timeout. Each probe is given a sequence id. QoS servers answer a bare "PONG", so a
+ * reply is matched to the oldest sequence still outstanding for the endpoint it came from. After a timeout the next
+ * probe is held back for a short guard period, so a late reply of the lost probe is not taken for the next one.
+ * The worker and its socket are created on the first ping and kept until Shutdown, the worker sleeps while there is
+ * nothing to ping. Completion delegates are executed on the game thread.
+ */
+class FAccelByteUdpPinger : public FRunnable
 {
 public:
-	FAccelByteUdpPingThread(ISocketSubsystem* const InSocketSub
-		, FPingConfig const& InConfig
-		, FGotResponseDelegate OnGotResponseDelegate
-		, FPingResultStatusDelegate OnPingCompleteDelegate);
+	static FAccelByteUdpPinger& Get();
 
-	virtual ~FAccelByteUdpPingThread() override;
+	virtual ~FAccelByteUdpPinger() override;
 
-	virtual uint32 Run() override;
+	/**
+	 * @brief Queue a target, can be called from any thread.
+	 */
+	void Ping(FPingConfig const& Config, FPingCompleteDelegate const& OnComplete);
 
-	virtual void Stop() override;
+	/**
+	 * @brief Stop the worker and close the socket, pending targets complete as canceled.
+	 * The next ping starts a new worker.
+	 */
+	void Shutdown();
 
-	virtual void Exit() override;
-
-protected:
-	virtual bool CreateSocket();
-	virtual void DestroySocket();
-	virtual uint64 GetCurrentTime();
-	virtual bool CreateAddress();
-	virtual bool SocketReceiveData(uint8* Data, int32 BufferSize, int32& BytesRead);
-	virtual bool SocketSendData(const FString& StringToSend, int32& BytesSent);
-	virtual bool SocketWaitData();
-	virtual bool SocketIsValid();
+	virtual uint32 Run() override;
 
-	FPingResultStatus SendPing(const FString& PingString);
+	virtual void Stop() override;
 
-	FPingResultStatusDelegate OnComplete;
-	FGotResponseDelegate OnGotResponse;
-	FPingConfig Config;
+	static FPingResult PingResponsesToResult(TArray<FPingResponse> const& PingResponses, FPingResultStatus EndStatus);
 
 private:
-	FPingResponse CreateResponse(uint8* Data, int32 BytesRead, uint64 SentTime, uint64 CurrentTime);
-	ISocketSubsystem* SocketSubsystem;
-	FSocket* Socket;
-	TSharedPtr<FInternetAddr> IpAddress;
-
-	bool bIsComplete;
-	bool bIsCanceled;
+	struct FTarget
+	{
+		FPingConfig Config;
+		FPingCompleteDelegate OnComplete;
+		TSharedPtr<FInternetAddr> Address;
+		FString Endpoint;
+		TArray<FPingResponse> Responses;
+		uint32 Sequence = 0;
+		double SentTime = 0.0;
+		double Deadline = 0.0;
+		/** Time the next probe is sent after a timeout, zero when no probe is held back. */
+		double HoldUntil = 0.0;
+		bool bWaitingReply = false;
+		bool bCompleted = false;
+	};
+	typedef TSharedPtr<FTarget> FTargetPtr;
+
+	FAccelByteUdpPinger() = default;
+
+	void AcceptNewTargets();
+	void SendNextProbe(FTargetPtr const& Target);
+	void WaitForReplies();
+	void ReceiveReplies();
+	void HandleReply(FInternetAddr const& FromAddress, uint8 const* Data, int32 BytesRead, double ReceivedTime);
+	void ExpireProbes(double Now);
+	void ForgetOutstandingProbe(FTarget& Target);
+	void Complete(FTargetPtr const& Target, FPingResultStatus Status);
+	FSocket* GetSocket(FName ProtocolType);
+	void DestroySockets();
+
+	FCriticalSection ThreadLock;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	FThreadSafeBool bStopping;
+	TQueue<FTargetPtr, EQueueMode::Mpsc> NewTargets;
+
+	// Only touched by the worker thread
+	ISocketSubsystem* SocketSubsystem = nullptr;
+	TMap<FName, FSocket*> Sockets;
+	TArray<FTargetPtr> ActiveTargets;
+	TMap<uint32, FTargetPtr> OutstandingProbes;
+	TMap<FString, TArray<uint32>> OutstandingSequencesByEndpoint;
+	uint32 LastSequence = 0;
+
+	FAccelByteUdpPinger(FAccelByteUdpPinger const&) = delete;
+	FAccelByteUdpPinger& operator=(FAccelByteUdpPinger const&) = delete;
 };
-
-class ACCELBYTEUE4SDK_API FAccelByteUdpPingAsync: public FTickerObjectBaseAlias
-{
-public:
-	FAccelByteUdpPingAsync(ISocketSubsystem* const InSocketSub, const FPingCompleteDelegate& InCompletionDelegate);
-
-	virtual ~FAccelByteUdpPingAsync() override;
-
-	virtual void Start(const FPingConfig& Config);
-
-protected:
-	virtual bool Tick(float DeltaTime) override;
-	static FPingResult PingResponsesToResult(const TArray<FPingResponse>& PingResponses, FPingResultStatus EndStatus);
-
-	ISocketSubsystem* SocketSubsystem;
-	FPingCompleteDelegate OnPingCompleteDelegate;
-	TFuture<FPingResult> FutureResult;
-	FThreadSafeBool bThreadCompleted;
-
-private:
-	static FPingResult RunWorker(ISocketSubsystem* const SocketSub, FPingConfig const& Config);
-};
\ No newline at end of file
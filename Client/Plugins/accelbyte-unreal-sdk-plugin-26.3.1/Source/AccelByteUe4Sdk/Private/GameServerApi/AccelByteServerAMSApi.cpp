@@ -19,6 +19,15 @@ namespace AccelByte
 namespace GameServerApi
 {
 
+namespace
+{
+	// A queued heartbeat or session timeout is superseded by the next one of the same kind.
+	// A plain reset must not replace a queued new timeout, so setting a timeout has its own key.
+	const FName HeartbeatCoalesceKey = TEXT("heartbeat");
+	const FName SessionTimeoutCoalesceKey = TEXT("resetSessionTimeout");
+	const FName SetSessionTimeoutCoalesceKey = TEXT("setSessionTimeout");
+}
+
 ServerAMS::ServerAMS(
 	ServerCredentials const& InCredentialsRef,
 	ServerSettings const& InSettingsRef,
@@ -228,7 +237,7 @@ void ServerAMS::SendReadyMessage()
 	FString ReadyMessage = FString::Format(TEXT("{\"ready\":{\"dsid\":\"{0}\"}}"), { ServerSettingsRef.DSId });
 
 	UE_LOG(LogAccelByteAMS, Log, TEXT("Send ready message to AMS\n%s"), *ReadyMessage);
-	WebSocket->Send(ReadyMessage);
+	WebSocket->Send(ReadyMessage, EWebSocketSendPriority::High);
 
 	if (bHeartbeatJobStarted == false)
 	{
@@ -249,7 +258,7 @@ void ServerAMS::SendHeartbeat()
 	FString HeartbeatMessage = TEXT("{\"heartbeat\":{}}");
 
 	UE_LOG(LogAccelByteAMS, VeryVerbose, TEXT("Send heartbeat message to AMS\n%s"), *HeartbeatMessage);
-	WebSocket->Send(HeartbeatMessage);
+	WebSocket->Send(HeartbeatMessage, EWebSocketSendPriority::High, HeartbeatCoalesceKey);
 }
 
 bool ServerAMS::PeriodicHeartbeat(float DeltaTime)
@@ -272,7 +281,7 @@ void ServerAMS::SetDSTimeout(int32 NewTimeout)
 	FString SessionTimeoutMessage = FString::Format(TEXT("{\"resetSessionTimeout\":{\"newTimeout\":\"{0}\"}}"), { NewTimeout });
 
 	UE_LOG(LogAccelByteAMS, Log, TEXT("Send set session timeout message to AMS\n%s"), *SessionTimeoutMessage);
-	WebSocket->Send(SessionTimeoutMessage);
+	WebSocket->Send(SessionTimeoutMessage, EWebSocketSendPriority::Normal, SetSessionTimeoutCoalesceKey);
 }
 
 void ServerAMS::ResetDSTimeout()
@@ -286,7 +295,7 @@ void ServerAMS::ResetDSTimeout()
 	FString SessionTimeoutMessage = TEXT("{\"resetSessionTimeout\":{}}");
 
 	UE_LOG(LogAccelByteAMS, Log, TEXT("Send reset session timeout message to AMS\n%s"), *SessionTimeoutMessage);
-	WebSocket->Send(SessionTimeoutMessage);
+	WebSocket->Send(SessionTimeoutMessage, EWebSocketSendPriority::Normal, SessionTimeoutCoalesceKey);
 }
 
 }
@@ -0,0 +1,218 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "Core/AccelByteHttpRateLimiter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace AccelByte;
+
+namespace
+{
+	constexpr auto HttpRateLimiterTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+
+	/** The limiter only uses the times it is given, any base works. */
+	constexpr double StartTime = 1000.0;
+
+	const FString RateLimiterTestUrl = TEXT("https://test.accelbyte.io/ratelimit");
+
+	FAccelByteTaskPtr MakeTask()
+	{
+		return MakeShared<FAccelByteTask, ESPMode::ThreadSafe>();
+	}
+
+	/** Polls the limiter, collecting the tasks it releases. */
+	struct FRateLimiterPoller
+	{
+		FHttpRateLimiter& Limiter;
+		TArray<FAccelByteTaskPtr> Dispatched;
+		TArray<FAccelByteTaskPtr> TimedOut;
+
+		double Poll(double Time)
+		{
+			return Limiter.Poll(Time
+				, FHttpRateLimiter::FOnTaskReleased::CreateLambda([this](const FAccelByteTaskPtr& Task)
+					{
+						Dispatched.Add(Task);
+					})
+				, FHttpRateLimiter::FOnTaskReleased::CreateLambda([this](const FAccelByteTaskPtr& Task)
+					{
+						TimedOut.Add(Task);
+					}));
+		}
+	};
+
+	const FAccelByteRateLimitEndpointStats* FindStats(const TArray<FAccelByteRateLimitEndpointStats>& Stats, const FString& Route)
+	{
+		return Stats.FindByPredicate([&Route](const FAccelByteRateLimitEndpointStats& EndpointStats)
+			{
+				return EndpointStats.Endpoint == Route;
+			});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRateLimiterQueueTest, "AccelByte.Core.HttpRateLimiter.Queue", HttpRateLimiterTestFlags)
+bool FAccelByteHttpRateLimiterQueueTest::RunTest(const FString& Parameters)
+{
+	const FString Pattern = TEXT("/ratelimit/queue");
+	FHttpRateLimiter::SetPolicy(Pattern, FAccelByteRateLimitPolicy{EAccelByteRateLimitPriority::Normal, 1.5f});
+
+	FHttpRateLimiter Limiter;
+	Limiter.SetRate(1);
+	FRateLimiterPoller Poller{Limiter};
+
+	const FString Url = RateLimiterTestUrl + TEXT("/queue");
+	FAccelByteTaskPtr First = MakeTask();
+	FAccelByteTaskPtr Second = MakeTask();
+	FAccelByteTaskPtr Third = MakeTask();
+	TestTrue(TEXT("Within the rate"), Limiter.AcquireOrQueue(First, Url, StartTime));
+	TestFalse(TEXT("Over the rate"), Limiter.AcquireOrQueue(Second, Url + TEXT("?page=2"), StartTime));
+	TestFalse(TEXT("Over the rate"), Limiter.AcquireOrQueue(Third, Url, StartTime));
+	TestTrue(TEXT("Incoming"), Limiter.HasIncoming());
+
+	TestEqual(TEXT("Next poll when a token is back"), Poller.Poll(StartTime), StartTime + 1.0, 0.001);
+	TestEqual(TEXT("Nothing released yet"), Poller.Dispatched.Num() + Poller.TimedOut.Num(), 0);
+
+	Poller.Poll(StartTime + 1.0);
+	TestTrue(TEXT("Oldest released first"), Poller.Dispatched.Num() == 1 && Poller.Dispatched[0] == Second);
+
+	Poller.Poll(StartTime + 1.6);
+	TestTrue(TEXT("Waited longer than its policy allows"), Poller.TimedOut.Num() == 1 && Poller.TimedOut[0] == Third);
+
+	const TArray<FAccelByteRateLimitEndpointStats> Stats = Limiter.GetStats();
+	const FAccelByteRateLimitEndpointStats* EndpointStats = FindStats(Stats, Url);
+	TestNotNull(TEXT("Stats of the endpoint, without the query"), EndpointStats);
+	if (EndpointStats != nullptr)
+	{
+		TestEqual(TEXT("Queue depth"), EndpointStats->QueueDepth, 0);
+		TestEqual(TEXT("Peak queue depth"), EndpointStats->PeakQueueDepth, 2);
+		TestEqual(TEXT("Total queued"), EndpointStats->TotalQueued, 2);
+		TestEqual(TEXT("Total timed out"), EndpointStats->TotalTimedOut, 1);
+	}
+
+	FHttpRateLimiter::RemovePolicy(Pattern);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRateLimiterPriorityTest, "AccelByte.Core.HttpRateLimiter.Priority", HttpRateLimiterTestFlags)
+bool FAccelByteHttpRateLimiterPriorityTest::RunTest(const FString& Parameters)
+{
+	const TArray<TPair<FString, EAccelByteRateLimitPriority>> Policies = {
+		{TEXT("?priority=low"), EAccelByteRateLimitPriority::Low},
+		{TEXT("?priority=normal"), EAccelByteRateLimitPriority::Normal},
+		{TEXT("?priority=high"), EAccelByteRateLimitPriority::High},
+		{TEXT("?priority=critical"), EAccelByteRateLimitPriority::Critical},
+	};
+	for (const TPair<FString, EAccelByteRateLimitPriority>& Policy : Policies)
+	{
+		FHttpRateLimiter::SetPolicy(Policy.Key, FAccelByteRateLimitPolicy{Policy.Value, 10.0f});
+	}
+
+	FHttpRateLimiter Limiter;
+	Limiter.SetRate(1);
+	FRateLimiterPoller Poller{Limiter};
+
+	// Same endpoint, the query only picks the policy
+	const FString Url = RateLimiterTestUrl + TEXT("/priority");
+	FAccelByteTaskPtr Low = MakeTask();
+	FAccelByteTaskPtr Normal = MakeTask();
+	FAccelByteTaskPtr High = MakeTask();
+	TestTrue(TEXT("Within the rate"), Limiter.AcquireOrQueue(MakeTask(), Url, StartTime));
+	TestFalse(TEXT("Low queued"), Limiter.AcquireOrQueue(Low, Url + TEXT("?priority=low"), StartTime));
+	TestFalse(TEXT("Normal queued"), Limiter.AcquireOrQueue(Normal, Url + TEXT("?priority=normal"), StartTime));
+	TestFalse(TEXT("High queued"), Limiter.AcquireOrQueue(High, Url + TEXT("?priority=high"), StartTime));
+	TestTrue(TEXT("Critical never held back"), Limiter.AcquireOrQueue(MakeTask(), Url + TEXT("?priority=critical"), StartTime));
+
+	for (int32 Second = 0; Second <= 3; Second++)
+	{
+		Poller.Poll(StartTime + Second);
+	}
+	TestEqual(TEXT("One released per token"), Poller.Dispatched.Num(), 3);
+	if (Poller.Dispatched.Num() == 3)
+	{
+		TestTrue(TEXT("High first"), Poller.Dispatched[0] == High);
+		TestTrue(TEXT("Normal next"), Poller.Dispatched[1] == Normal);
+		TestTrue(TEXT("Low last"), Poller.Dispatched[2] == Low);
+	}
+
+	for (const TPair<FString, EAccelByteRateLimitPriority>& Policy : Policies)
+	{
+		FHttpRateLimiter::RemovePolicy(Policy.Key);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRateLimiterRouteStatsTest, "AccelByte.Core.HttpRateLimiter.RouteStats", HttpRateLimiterTestFlags)
+bool FAccelByteHttpRateLimiterRouteStatsTest::RunTest(const FString& Parameters)
+{
+	FHttpRateLimiter Limiter;
+	Limiter.SetRate(1);
+	FRateLimiterPoller Poller{Limiter};
+
+	const TArray<FString> Users = {
+		TEXT("123"),
+		TEXT("456"),
+		TEXT("0123456789abcdef0123456789abcdef"),
+		TEXT("01234567-89ab-cdef-0123-456789abcdef"),
+		TEXT("alice"),
+	};
+	for (const FString& User : Users)
+	{
+		const FString Url = FString::Printf(TEXT("%s/users/%s/items"), *RateLimiterTestUrl, *User);
+		Limiter.AcquireOrQueue(MakeTask(), Url, StartTime);
+		TestFalse(TEXT("Over the rate of the endpoint"), Limiter.AcquireOrQueue(MakeTask(), Url, StartTime));
+	}
+	Poller.Poll(StartTime);
+
+	const TArray<FAccelByteRateLimitEndpointStats> Stats = Limiter.GetStats();
+	TestEqual(TEXT("One entry per route"), Stats.Num(), 2);
+
+	const FAccelByteRateLimitEndpointStats* IdRoute = FindStats(Stats, RateLimiterTestUrl + TEXT("/users/{id}/items"));
+	TestNotNull(TEXT("Numeric and hex ids share a route"), IdRoute);
+	if (IdRoute != nullptr)
+	{
+		TestEqual(TEXT("Queued on the route"), IdRoute->TotalQueued, 4);
+		TestEqual(TEXT("Queue depth of the route"), IdRoute->QueueDepth, 4);
+	}
+	TestNotNull(TEXT("Names are not ids"), FindStats(Stats, RateLimiterTestUrl + TEXT("/users/alice/items")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRateLimiterStatsBoundTest, "AccelByte.Core.HttpRateLimiter.StatsBound", HttpRateLimiterTestFlags)
+bool FAccelByteHttpRateLimiterStatsBoundTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 RouteCount = FHttpRateLimiter::MaxStatsEndpoints + 50;
+
+	FHttpRateLimiter Limiter;
+	Limiter.SetRate(1);
+	FRateLimiterPoller Poller{Limiter};
+
+	for (int32 Index = 0; Index < RouteCount; Index++)
+	{
+		const FString Url = FString::Printf(TEXT("%s/route-%d"), *RateLimiterTestUrl, Index);
+		Limiter.AcquireOrQueue(MakeTask(), Url, StartTime);
+		Limiter.AcquireOrQueue(MakeTask(), Url, StartTime);
+	}
+	Poller.Poll(StartTime);
+	TestTrue(TEXT("Stats bounded while queued"), Limiter.GetStats().Num() <= FHttpRateLimiter::MaxStatsEndpoints);
+
+	Poller.Poll(StartTime + 1.0);
+	TestEqual(TEXT("Every route released"), Poller.Dispatched.Num(), RouteCount);
+	TestTrue(TEXT("Stats bounded once released"), Limiter.GetStats().Num() <= FHttpRateLimiter::MaxStatsEndpoints);
+
+	// Every route is idle, a new one takes the place of the least recently queued
+	const FString FreshUrl = RateLimiterTestUrl + TEXT("/fresh");
+	Limiter.AcquireOrQueue(MakeTask(), FreshUrl, StartTime + 10.0);
+	Limiter.AcquireOrQueue(MakeTask(), FreshUrl, StartTime + 10.0);
+	Poller.Poll(StartTime + 10.0);
+
+	const TArray<FAccelByteRateLimitEndpointStats> Stats = Limiter.GetStats();
+	TestEqual(TEXT("Stats stay at the bound"), Stats.Num(), FHttpRateLimiter::MaxStatsEndpoints);
+	const FAccelByteRateLimitEndpointStats* Fresh = FindStats(Stats, FreshUrl);
+	TestTrue(TEXT("New route tracked"), Fresh != nullptr && Fresh->QueueDepth == 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
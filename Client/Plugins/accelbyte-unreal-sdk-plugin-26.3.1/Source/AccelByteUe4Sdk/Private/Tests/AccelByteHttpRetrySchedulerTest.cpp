@@ -0,0 +1,309 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "HttpModule.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteHttpRetryTask.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace AccelByte;
+
+namespace
+{
+	constexpr auto HttpRetrySchedulerTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+	constexpr auto HttpRetrySchedulerBenchmarkFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter;
+
+	const FString TestUrl = TEXT("http://127.0.0.1:1/accelbyte-test/retry-scheduler");
+	const FString BearerAuthorization = TEXT("Bearer test");
+
+	/**
+	 * Scheduler driven directly through its internal steps, the tasks it creates are never sent: they are either
+	 * cancelled before being started, or started while the scheduler is paused so they are paused instead of going on
+	 * the wire.
+	 */
+	class FHttpRetryTestScheduler : public FHttpRetryScheduler
+	{
+	public:
+		using FHttpRetryScheduler::TryCoalesceRequest;
+		using FHttpRetryScheduler::CompleteCoalescedRequests;
+		using FHttpRetryScheduler::StartTask;
+		using FHttpRetryScheduler::PollSharedSchedulers;
+
+		void StartSharedPolling()
+		{
+			bSharedPolling = true;
+			StartPolling();
+		}
+
+		FAccelByteHttpRetryTaskPtr CreateTask(const FString& Verb, const FString& Authorization, int32& OutCompletions)
+		{
+			FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+			Request->SetURL(TestUrl);
+			Request->SetVerb(Verb);
+			Request->SetHeader(TEXT("Authorization"), Authorization);
+
+			return MakeShared<FHttpRetryTask, ESPMode::ThreadSafe>
+				( Request
+				, FHttpRequestCompleteDelegate::CreateLambda([&OutCompletions](FHttpRequestPtr, FHttpResponsePtr, bool)
+					{
+						OutCompletions++;
+					})
+				, FPlatformTime::Seconds()
+				, InitialDelay
+				, FVoidHandler()
+				, BearerAuthRejectedRefresh );
+		}
+
+		bool TryCoalesce(const FAccelByteHttpRetryTaskPtr& Task)
+		{
+			return TryCoalesceRequest(Task, Task->GetHttpRequest());
+		}
+
+		FHttpRateLimiter& GetRateLimiter()
+		{
+			return RateLimiter;
+		}
+
+		bool IsInFlight(const FAccelByteHttpRetryTaskPtr& Task) const
+		{
+			FScopeLock Lock(&InFlightRequestsLock);
+			const FInFlightRequest* InFlight = InFlightRequests.Find(Task->GetCoalescingKey());
+			return InFlight != nullptr && InFlight->Leader == Task;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerCoalesceTest, "AccelByte.Core.HttpRetryScheduler.Coalesce", HttpRetrySchedulerTestFlags)
+bool FAccelByteHttpRetrySchedulerCoalesceTest::RunTest(const FString& Parameters)
+{
+	int32 LeaderCompletions = 0;
+	int32 FollowerCompletions = 0;
+	int32 CancelledCompletions = 0;
+	int32 OtherCompletions = 0;
+	FHttpRetryTestScheduler Scheduler;
+
+	FAccelByteHttpRetryTaskPtr Leader = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, LeaderCompletions);
+	FAccelByteHttpRetryTaskPtr Follower = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, FollowerCompletions);
+	FAccelByteHttpRetryTaskPtr Cancelled = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, CancelledCompletions);
+	FAccelByteHttpRetryTaskPtr OtherCaller = Scheduler.CreateTask(TEXT("GET"), TEXT("Bearer other"), OtherCompletions);
+	FAccelByteHttpRetryTaskPtr Post = Scheduler.CreateTask(TEXT("POST"), BearerAuthorization, OtherCompletions);
+
+	TestFalse(TEXT("First request is sent"), Scheduler.TryCoalesce(Leader));
+	TestTrue(TEXT("Identical request is coalesced"), Scheduler.TryCoalesce(Follower));
+	TestTrue(TEXT("Identical request is coalesced"), Scheduler.TryCoalesce(Cancelled));
+	TestFalse(TEXT("Request of another caller is sent"), Scheduler.TryCoalesce(OtherCaller));
+	TestFalse(TEXT("Request that is not a GET is sent"), Scheduler.TryCoalesce(Post));
+	TestTrue(TEXT("Leader keeps the entry"), Scheduler.IsInFlight(Leader));
+
+	FAccelByteHttpCoalescingStats Stats = Scheduler.GetCoalescingStats();
+	TestEqual(TEXT("In flight"), Stats.InFlightRequests, 1);
+	TestEqual(TEXT("Coalesced"), Stats.CoalescedRequests, 2);
+	TestEqual(TEXT("Shared responses"), Stats.SharedResponses, 1);
+
+	Cancelled->GetCancellationToken().Cancel();
+	Scheduler.CompleteCoalescedRequests(Leader);
+
+	TestEqual(TEXT("Follower gets the outcome of the leader"), FollowerCompletions, 1);
+	TestEqual(TEXT("Cancelled follower hears about its own cancellation"), CancelledCompletions, 1);
+	TestTrue(TEXT("Cancelled follower is cancelled"), Cancelled->State() == EAccelByteTaskState::Cancelled);
+	TestEqual(TEXT("Leader completion is left to its own finish"), LeaderCompletions, 0);
+	TestEqual(TEXT("Requests sent on their own are not completed"), OtherCompletions, 0);
+	TestEqual(TEXT("Entry removed"), Scheduler.GetCoalescingStats().InFlightRequests, 0);
+
+	Scheduler.CompleteCoalescedRequests(Leader);
+	TestEqual(TEXT("Followers are completed once"), FollowerCompletions, 1);
+
+	FAccelByteHttpRetryTaskPtr Next = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, OtherCompletions);
+	TestFalse(TEXT("Next identical request is sent again"), Scheduler.TryCoalesce(Next));
+	TestTrue(TEXT("Next request leads the entry"), Scheduler.IsInFlight(Next));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerCancelledLeaderTest, "AccelByte.Core.HttpRetryScheduler.CancelledLeader", HttpRetrySchedulerTestFlags)
+bool FAccelByteHttpRetrySchedulerCancelledLeaderTest::RunTest(const FString& Parameters)
+{
+	int32 LeaderCompletions = 0;
+	int32 CancelledCompletions = 0;
+	int32 SecondCompletions = 0;
+	int32 ThirdCompletions = 0;
+	FHttpRetryTestScheduler Scheduler;
+	Scheduler.PauseBearerAuthRequest();
+
+	FAccelByteHttpRetryTaskPtr Leader = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, LeaderCompletions);
+	FAccelByteHttpRetryTaskPtr Cancelled = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, CancelledCompletions);
+	FAccelByteHttpRetryTaskPtr Second = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, SecondCompletions);
+	FAccelByteHttpRetryTaskPtr Third = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, ThirdCompletions);
+	Scheduler.TryCoalesce(Leader);
+	Scheduler.TryCoalesce(Cancelled);
+	Scheduler.TryCoalesce(Second);
+	Scheduler.TryCoalesce(Third);
+
+	// The first follower was cancelled by its caller, the next live one sends the request for the rest
+	Cancelled->GetCancellationToken().Cancel();
+	Leader->Cancel();
+	Scheduler.CompleteCoalescedRequests(Leader);
+
+	TestEqual(TEXT("Cancelled follower hears about its own cancellation"), CancelledCompletions, 1);
+	TestTrue(TEXT("Cancelled follower is cancelled"), Cancelled->State() == EAccelByteTaskState::Cancelled);
+	TestTrue(TEXT("Live follower promoted"), Scheduler.IsInFlight(Second));
+	TestTrue(TEXT("Promoted leader started, paused with the scheduler"), Second->State() == EAccelByteTaskState::Paused);
+	TestEqual(TEXT("Promoted leader not completed"), SecondCompletions, 0);
+	TestEqual(TEXT("Remaining follower still waits"), ThirdCompletions, 0);
+	TestEqual(TEXT("Entry kept"), Scheduler.GetCoalescingStats().InFlightRequests, 1);
+
+	Second->Cancel();
+	Scheduler.CompleteCoalescedRequests(Second);
+	TestTrue(TEXT("Last follower promoted"), Scheduler.IsInFlight(Third));
+	TestEqual(TEXT("Last follower still waits"), ThirdCompletions, 0);
+
+	Third->Cancel();
+	Scheduler.CompleteCoalescedRequests(Third);
+	TestEqual(TEXT("Entry dropped once nobody is left"), Scheduler.GetCoalescingStats().InFlightRequests, 0);
+	TestEqual(TEXT("Cancelled follower completed once"), CancelledCompletions, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerCancelledFollowersTest, "AccelByte.Core.HttpRetryScheduler.CancelledFollowers", HttpRetrySchedulerTestFlags)
+bool FAccelByteHttpRetrySchedulerCancelledFollowersTest::RunTest(const FString& Parameters)
+{
+	int32 LeaderCompletions = 0;
+	int32 FirstCompletions = 0;
+	int32 SecondCompletions = 0;
+	FHttpRetryTestScheduler Scheduler;
+	Scheduler.PauseBearerAuthRequest();
+
+	FAccelByteHttpRetryTaskPtr Leader = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, LeaderCompletions);
+	FAccelByteHttpRetryTaskPtr First = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, FirstCompletions);
+	FAccelByteHttpRetryTaskPtr Second = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, SecondCompletions);
+	Scheduler.TryCoalesce(Leader);
+	Scheduler.TryCoalesce(First);
+	Scheduler.TryCoalesce(Second);
+
+	// Cancelled through the token only, and already marked cancelled
+	First->GetCancellationToken().Cancel();
+	Second->Cancel();
+	Leader->Cancel();
+	Scheduler.CompleteCoalescedRequests(Leader);
+
+	TestEqual(TEXT("Nobody promoted, entry dropped"), Scheduler.GetCoalescingStats().InFlightRequests, 0);
+	TestFalse(TEXT("Follower not promoted"), Scheduler.IsInFlight(First));
+	TestFalse(TEXT("Follower not promoted"), Scheduler.IsInFlight(Second));
+	TestTrue(TEXT("Follower cancelled through its token is cancelled"), First->State() == EAccelByteTaskState::Cancelled);
+	TestEqual(TEXT("Each follower hears about its cancellation"), FirstCompletions, 1);
+	TestEqual(TEXT("Each follower hears about its cancellation"), SecondCompletions, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerStartCancelledTest, "AccelByte.Core.HttpRetryScheduler.StartCancelled", HttpRetrySchedulerTestFlags)
+bool FAccelByteHttpRetrySchedulerStartCancelledTest::RunTest(const FString& Parameters)
+{
+	int32 Completions = 0;
+	FHttpRetryTestScheduler Scheduler;
+
+	FAccelByteHttpRetryTaskPtr Task = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, Completions);
+	Task->GetCancellationToken().Cancel();
+	Scheduler.StartTask(Task);
+
+	TestTrue(TEXT("Cancelled instead of started"), Task->State() == EAccelByteTaskState::Cancelled);
+	TestTrue(TEXT("Request not sent"), Task->GetHttpRequest()->GetStatus() != EHttpRequestStatus::Processing);
+	TestEqual(TEXT("Caller not told before the next tick"), Completions, 0);
+
+	TestTrue(TEXT("Ticked on the next poll"), Scheduler.PollRetry(FPlatformTime::Seconds()));
+	TestEqual(TEXT("Caller hears about the cancellation"), Completions, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerRateLimitedCancelledTest, "AccelByte.Core.HttpRetryScheduler.RateLimitedCancelled", HttpRetrySchedulerTestFlags)
+bool FAccelByteHttpRetrySchedulerRateLimitedCancelledTest::RunTest(const FString& Parameters)
+{
+	int32 FirstCompletions = 0;
+	int32 QueuedCompletions = 0;
+	FHttpRetryTestScheduler Scheduler;
+	Scheduler.GetRateLimiter().SetRate(1);
+
+	const double Time = FPlatformTime::Seconds();
+	FAccelByteHttpRetryTaskPtr First = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, FirstCompletions);
+	FAccelByteHttpRetryTaskPtr Queued = Scheduler.CreateTask(TEXT("GET"), BearerAuthorization, QueuedCompletions);
+	TestTrue(TEXT("Within the rate"), Scheduler.GetRateLimiter().AcquireOrQueue(First, TestUrl, Time));
+	TestFalse(TEXT("Over the rate"), Scheduler.GetRateLimiter().AcquireOrQueue(Queued, TestUrl, Time));
+
+	// Cancelled by its caller while it waited for a token, released once one is back
+	Queued->GetCancellationToken().Cancel();
+	Scheduler.PollRetry(Time + 1.0);
+
+	TestTrue(TEXT("Cancelled instead of started"), Queued->State() == EAccelByteTaskState::Cancelled);
+	TestTrue(TEXT("Request not sent"), Queued->GetHttpRequest()->GetStatus() != EHttpRequestStatus::Processing);
+	TestEqual(TEXT("Caller hears about the cancellation"), QueuedCompletions, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteHttpRetrySchedulerPollingBenchmarkTest, "AccelByte.Core.HttpRetryScheduler.PollingBenchmark", HttpRetrySchedulerBenchmarkFlags)
+bool FAccelByteHttpRetrySchedulerPollingBenchmarkTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 SchedulerCount = 64;
+	constexpr int32 FrameCount = 5000;
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	// Idle schedulers, the cost measured is what polling adds to every frame. Both modes are ticked by a local ticker
+	// the same way the core ticker would, so other engine tickers don't weigh in.
+	auto MeasureFrameSeconds = [](FTickerAlias& Ticker)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < FrameCount; Frame++)
+		{
+			Ticker.Tick(DeltaTime);
+		}
+		return (FPlatformTime::Seconds() - Start) / FrameCount;
+	};
+
+	int32 OwnWakeups = 0;
+	double OwnFrameSeconds = 0.0;
+	{
+		TArray<TUniquePtr<FHttpRetryTestScheduler>> Schedulers;
+		FTickerAlias Ticker;
+		for (int32 Index = 0; Index < SchedulerCount; Index++)
+		{
+			FHttpRetryTestScheduler* Scheduler = Schedulers.Add_GetRef(MakeUnique<FHttpRetryTestScheduler>()).Get();
+			// Same as the ticker each scheduler registers without shared polling
+			Ticker.AddTicker(FTickerDelegate::CreateLambda([Scheduler, &OwnWakeups](float)
+				{
+					OwnWakeups++;
+					Scheduler->PollRetry(FPlatformTime::Seconds());
+					return true;
+				}));
+		}
+		OwnFrameSeconds = MeasureFrameSeconds(Ticker);
+	}
+
+	int32 SharedWakeups = 0;
+	double SharedFrameSeconds = 0.0;
+	{
+		TArray<TUniquePtr<FHttpRetryTestScheduler>> Schedulers;
+		for (int32 Index = 0; Index < SchedulerCount; Index++)
+		{
+			Schedulers.Add_GetRef(MakeUnique<FHttpRetryTestScheduler>())->StartSharedPolling();
+		}
+		TestTrue(TEXT("Every scheduler polled by the shared ticker"), FHttpRetryScheduler::GetSharedPollingSchedulerCount() >= SchedulerCount);
+
+		FTickerAlias Ticker;
+		Ticker.AddTicker(FTickerDelegate::CreateLambda([&SharedWakeups](float InDeltaTime)
+			{
+				SharedWakeups++;
+				return FHttpRetryTestScheduler::PollSharedSchedulers(InDeltaTime);
+			}));
+		SharedFrameSeconds = MeasureFrameSeconds(Ticker);
+	}
+
+	TestEqual(TEXT("One wakeup per scheduler and frame with own tickers"), OwnWakeups, SchedulerCount * FrameCount);
+	TestEqual(TEXT("One wakeup per frame with the shared ticker"), SharedWakeups, FrameCount);
+	AddInfo(FString::Printf(TEXT("%d idle schedulers, own tickers: %d wakeups and %.2f us per frame, shared ticker: %d wakeup and %.2f us per frame")
+		, SchedulerCount
+		, OwnWakeups / FrameCount, OwnFrameSeconds * 1000000.0
+		, SharedWakeups / FrameCount, SharedFrameSeconds * 1000000.0));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,241 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "JsonObjectConverter.h"
+#include "Core/AccelByteJsonStructReader.h"
+#include "Core/AccelByteTypeConverter.h"
+#include "Models/AccelByteAchievementModels.h"
+#include "Models/AccelByteCloudSaveModels.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace AccelByte;
+
+namespace
+{
+	using EResult = FAccelByteJsonStructReader::EResult;
+
+	constexpr auto JsonStructReaderTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+
+	const TCHAR* GameRecordJson = TEXT(R"({
+		"key": "progress",
+		"namespace": "game\u00e9 \"ns\"\n",
+		"createdAt": "2024-03-01T10:20:30.123Z",
+		"updatedAt": "2024-03-02T00:00:00Z",
+		"setBy": "SERVER",
+		"unknownField": {"nested": [1, 2.5e3, -0.5, true, null, "x"]},
+		"value": {"level": 12, "items": [true, null, "sword"], "stats": {"hp": 2.5}}
+	})");
+
+	const TCHAR* AchievementsJson = TEXT(R"({
+		"data": [
+			{
+				"achievementCode": "first",
+				"name": "First",
+				"lockedIcons": [{"url": "https://a/1.png", "slug": "one"}, {"url": "https://a/2.png", "slug": "two"}],
+				"hidden": true,
+				"listOrder": -3,
+				"tags": ["a", "b"],
+				"goalValue": 1e2,
+				"customAttributes": {"rare": true}
+			},
+			{
+				"achievementCode": "second",
+				"incremental": false,
+				"goalValue": 0.125,
+				"tags": []
+			}
+		],
+		"paging": {"first": "f", "next": "n", "previous": null}
+	})");
+
+	template<typename StructType>
+	FString ToJson(const StructType& Value)
+	{
+		FString Json;
+		FJsonObjectConverter::UStructToJsonObjectString(Value, Json);
+		return Json;
+	}
+
+	/**
+	 * @brief Read the JSON with the reader from both its TCHAR and UTF-8 forms and with the DOM converter, over copies of
+	 * the same initial value, and check the three results are the same.
+	 */
+	template<typename StructType>
+	bool TestMatchesDom(FAutomationTestBase& Test, const TCHAR* What, const FString& Json, const StructType& Initial, StructType& OutRead)
+	{
+		OutRead = Initial;
+		const EResult Result = FAccelByteJsonStructReader::ReadObject(*Json, Json.Len(), StructType::StaticStruct(), &OutRead);
+		Test.TestTrue(*FString::Printf(TEXT("%s: read"), What), Result == EResult::Success);
+
+		StructType Utf8Read = Initial;
+		const FTCHARToUTF8 Utf8Json(*Json);
+		const EResult Utf8Result = FAccelByteJsonStructReader::ReadObject(Utf8Json.Get(), Utf8Json.Length(), StructType::StaticStruct(), &Utf8Read);
+		Test.TestTrue(*FString::Printf(TEXT("%s: read UTF-8"), What), Utf8Result == EResult::Success);
+
+		StructType DomRead = Initial;
+		Test.TestTrue(*FString::Printf(TEXT("%s: DOM read"), What), FJsonObjectConverter::JsonObjectStringToUStruct(Json, &DomRead, 0, 0));
+
+		const FString DomJson = ToJson(DomRead);
+		Test.TestEqual(*FString::Printf(TEXT("%s: same as DOM"), What), ToJson(OutRead), DomJson);
+		Test.TestEqual(*FString::Printf(TEXT("%s: UTF-8 same as DOM"), What), ToJson(Utf8Read), DomJson);
+		return Result == EResult::Success && Utf8Result == EResult::Success;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderScalarsTest, "AccelByte.Core.JsonStructReader.Scalars", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderScalarsTest::RunTest(const FString& Parameters)
+{
+	FAccelByteModelsGameRecord Record;
+	TestMatchesDom(*this, TEXT("Game record"), GameRecordJson, FAccelByteModelsGameRecord{}, Record);
+
+	TestEqual(TEXT("Escaped string"), Record.Namespace, FString(TEXT("game\u00e9 \"ns\"\n")));
+	TestEqual(TEXT("Date with milliseconds"), Record.CreatedAt, FDateTime(2024, 3, 1, 10, 20, 30, 123));
+	TestEqual(TEXT("Enum by name"), Record.SetBy, ESetByMetadataRecord::SERVER);
+
+	// The DOM converter fills the string of the wrapper condensed, not with the spacing of the response
+	FAccelByteModelsGameRecord DomRecord;
+	FJsonObjectConverter::JsonObjectStringToUStruct(GameRecordJson, &DomRecord, 0, 0);
+	TestEqual(TEXT("Wrapper string same as DOM"), Record.Value.JsonString, DomRecord.Value.JsonString);
+	TestTrue(TEXT("Wrapper object"), Record.Value.JsonObject.IsValid() && Record.Value.JsonObject->GetIntegerField(TEXT("level")) == 12);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderNestedTest, "AccelByte.Core.JsonStructReader.Nested", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderNestedTest::RunTest(const FString& Parameters)
+{
+	FAccelByteModelsPaginatedPublicAchievement Achievements;
+	TestMatchesDom(*this, TEXT("Achievements"), AchievementsJson, FAccelByteModelsPaginatedPublicAchievement{}, Achievements);
+
+	TestEqual(TEXT("Elements"), Achievements.Data.Num(), 2);
+	if (Achievements.Data.Num() == 2)
+	{
+		TestEqual(TEXT("Nested array"), Achievements.Data[0].LockedIcons.Num(), 2);
+		TestEqual(TEXT("Negative integer"), Achievements.Data[0].ListOrder, -3);
+		TestEqual(TEXT("Exponent"), Achievements.Data[0].GoalValue, 100.0f);
+		TestEqual(TEXT("Fraction"), Achievements.Data[1].GoalValue, 0.125f);
+	}
+	TestEqual(TEXT("Nested object"), Achievements.Paging.Next, FString(TEXT("n")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderNullTest, "AccelByte.Core.JsonStructReader.Null", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderNullTest::RunTest(const FString& Parameters)
+{
+	FAccelByteModelsGameRecord Initial;
+	Initial.Key = TEXT("kept");
+	Initial.CreatedAt = FDateTime(2020, 1, 1);
+	Initial.SetBy = ESetByMetadataRecord::CLIENT;
+	Initial.Value.JsonObjectFromString(TEXT("{\"kept\":true}"));
+
+	FAccelByteModelsGameRecord Record;
+	TestMatchesDom(*this, TEXT("Null fields"), TEXT(R"({"key": null, "createdAt": null, "setBy": null, "value": null, "namespace": "ns"})"), Initial, Record);
+	TestEqual(TEXT("Null string keeps its value"), Record.Key, FString(TEXT("kept")));
+	TestEqual(TEXT("Null date keeps its value"), Record.CreatedAt, FDateTime(2020, 1, 1));
+	TestEqual(TEXT("Null enum keeps its value"), Record.SetBy, ESetByMetadataRecord::CLIENT);
+	TestEqual(TEXT("Other fields are read"), Record.Namespace, FString(TEXT("ns")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderArrayResizeTest, "AccelByte.Core.JsonStructReader.ArrayResize", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderArrayResizeTest::RunTest(const FString& Parameters)
+{
+	FAccelByteModelsPaginatedPublicAchievement Initial;
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		FAccelByteModelsPublicAchievement& Achievement = Initial.Data.AddDefaulted_GetRef();
+		Achievement.AchievementCode = FString::Printf(TEXT("old%d"), Index);
+		Achievement.Name = FString::Printf(TEXT("Old %d"), Index);
+		Achievement.Tags = {TEXT("x"), TEXT("y"), TEXT("z")};
+	}
+
+	// Fewer elements than before: the extra ones go, the ones left keep their fields missing from the JSON
+	FAccelByteModelsPaginatedPublicAchievement Shrunk;
+	TestMatchesDom(*this, TEXT("Shrunk"), TEXT(R"({"data": [{"achievementCode": "new0", "tags": ["a"]}, null]})"), Initial, Shrunk);
+	TestEqual(TEXT("Shrunk count"), Shrunk.Data.Num(), 2);
+	if (Shrunk.Data.Num() == 2)
+	{
+		TestEqual(TEXT("Read field"), Shrunk.Data[0].AchievementCode, FString(TEXT("new0")));
+		TestEqual(TEXT("Missing field kept"), Shrunk.Data[0].Name, FString(TEXT("Old 0")));
+		TestEqual(TEXT("Nested array shrunk"), Shrunk.Data[0].Tags, TArray<FString>{TEXT("a")});
+		TestEqual(TEXT("Null element kept"), Shrunk.Data[1].AchievementCode, FString(TEXT("old1")));
+	}
+
+	// More elements than before: the new ones start from their defaults
+	FAccelByteModelsPaginatedPublicAchievement Grown;
+	TestMatchesDom(*this, TEXT("Grown"), TEXT(R"({"data": [{}, {}, {}, {"name": "New 3"}]})"), Initial, Grown);
+	TestEqual(TEXT("Grown count"), Grown.Data.Num(), 4);
+
+	FAccelByteModelsPaginatedPublicAchievement Emptied;
+	TestMatchesDom(*this, TEXT("Emptied"), TEXT(R"({"data": []})"), Initial, Emptied);
+	TestEqual(TEXT("Emptied count"), Emptied.Data.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderRootArrayTest, "AccelByte.Core.JsonStructReader.RootArray", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderRootArrayTest::RunTest(const FString& Parameters)
+{
+	const FString Json = FString::Printf(TEXT("[%s, {\"key\": \"second\"}]"), GameRecordJson);
+
+	TArray<FAccelByteModelsGameRecord> Records;
+	TestTrue(TEXT("Read"), FAccelByteJsonConverter::JsonArrayStringToUStruct(Json, &Records));
+
+	TArray<FAccelByteModelsGameRecord> DomRecords;
+	TestTrue(TEXT("DOM read"), FJsonObjectConverter::JsonArrayStringToUStruct(Json, &DomRecords, 0, 0));
+
+	TestEqual(TEXT("Count"), Records.Num(), DomRecords.Num());
+	for (int32 Index = 0; Index < FMath::Min(Records.Num(), DomRecords.Num()); Index++)
+	{
+		TestEqual(TEXT("Element same as DOM"), ToJson(Records[Index]), ToJson(DomRecords[Index]));
+	}
+
+	int32 Count = 0;
+	TArray<FAccelByteModelsGameRecord> Scratch;
+	Scratch.Reserve(2);
+	const EResult Result = FAccelByteJsonStructReader::ReadArray(*Json, Json.Len(), FAccelByteModelsGameRecord::StaticStruct(), [&Scratch, &Count]() -> void*
+	{
+		Count++;
+		return &Scratch.AddDefaulted_GetRef();
+	});
+	TestTrue(TEXT("Read by the reader, not the DOM fallback"), Result == EResult::Success);
+	TestEqual(TEXT("Elements added"), Count, 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteJsonStructReaderUnsupportedTest, "AccelByte.Core.JsonStructReader.Unsupported", JsonStructReaderTestFlags)
+bool FAccelByteJsonStructReaderUnsupportedTest::RunTest(const FString& Parameters)
+{
+	auto Read = [](const FString& Json)
+	{
+		FAccelByteModelsGameRecord Record;
+		return FAccelByteJsonStructReader::ReadObject(*Json, Json.Len(), FAccelByteModelsGameRecord::StaticStruct(), &Record);
+	};
+
+	TestTrue(TEXT("Unknown enum name"), Read(TEXT(R"({"setBy": "NOBODY"})")) == EResult::Unsupported);
+	TestTrue(TEXT("Date not in ISO 8601"), Read(TEXT(R"({"createdAt": "now"})")) == EResult::Unsupported);
+	TestTrue(TEXT("Number into a string"), Read(TEXT(R"({"key": 12})")) == EResult::Unsupported);
+	TestTrue(TEXT("Wrapper from an array"), Read(TEXT(R"({"value": [1]})")) == EResult::Unsupported);
+	TestTrue(TEXT("Root array"), Read(TEXT(R"([{"key": "k"}])")) == EResult::Unsupported);
+
+	TestTrue(TEXT("Truncated"), Read(TEXT(R"({"key": "k")")) == EResult::Malformed);
+	TestTrue(TEXT("Trailing comma"), Read(TEXT(R"({"key": "k",})")) == EResult::Malformed);
+	TestTrue(TEXT("Leading zero"), Read(TEXT(R"({"unknown": 01})")) == EResult::Malformed);
+	TestTrue(TEXT("Trailing text"), Read(TEXT(R"({"key": "k"} x)")) == EResult::Malformed);
+
+	// Maps are left to the DOM converter, the converter still ends up with its result
+	const FString MapJson = TEXT(R"({"achievementCode": "code", "name": {"en": "Name"}, "tags": ["t"]})");
+	FAccelByteModelsMultiLanguageAchievement Achievement;
+	TestTrue(TEXT("Map"), FAccelByteJsonStructReader::ReadObject(*MapJson, MapJson.Len(), FAccelByteModelsMultiLanguageAchievement::StaticStruct(), &Achievement) == EResult::Unsupported);
+
+	FAccelByteModelsMultiLanguageAchievement Converted;
+	TestTrue(TEXT("Converted through the DOM fallback"), FAccelByteJsonConverter::JsonObjectStringToUStruct(MapJson, &Converted));
+	FAccelByteModelsMultiLanguageAchievement DomConverted;
+	FJsonObjectConverter::JsonObjectStringToUStruct(MapJson, &DomConverted, 0, 0);
+	TestEqual(TEXT("Fallback same as DOM"), ToJson(Converted), ToJson(DomConverted));
+	TestEqual(TEXT("Map read"), Converted.Name.FindRef(TEXT("en")), FString(TEXT("Name")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,164 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "Core/Ping/AccelByteLatencyEstimator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr auto LatencyEstimatorTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorSmoothingTest, "AccelByte.Core.LatencyEstimator.Smoothing", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorSmoothingTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator(20, 0.2f);
+	TestFalse(TEXT("No latency before the first round"), Estimator.HasLatency());
+
+	Estimator.AddRound(100.0f, 3, 3);
+	TestTrue(TEXT("Latency after the first round"), Estimator.HasLatency());
+	TestEqual(TEXT("First round is taken as is"), Estimator.GetLatency(), 100.0f);
+
+	Estimator.AddRound(200.0f, 3, 3);
+	TestEqual(TEXT("Next round only moves the latency by the smoothing factor"), Estimator.GetLatency(), 120.0f, 0.001f);
+
+	Estimator.AddRound(500.0f, 0, 0);
+	TestEqual(TEXT("Round without probes is ignored"), Estimator.GetRoundCount(), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorP95Test, "AccelByte.Core.LatencyEstimator.P95", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorP95Test::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator(40);
+	TestEqual(TEXT("No percentile without rounds"), Estimator.GetLatencyP95(), 0.0f);
+
+	// Added out of order, the percentile is taken over the sorted round trips
+	for (int32 Index = 0; Index < 20; Index++)
+	{
+		Estimator.AddRound(static_cast<float>((Index * 7) % 20 + 1), 1, 1);
+	}
+	TestEqual(TEXT("95th percentile of 1..20"), Estimator.GetLatencyP95(), 19.0f);
+
+	// A fully lost round carries no round trip
+	Estimator.AddRound(1000.0f, 1, 0);
+	TestEqual(TEXT("Lost round is not part of the percentile"), Estimator.GetLatencyP95(), 19.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorWindowTest, "AccelByte.Core.LatencyEstimator.Window", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorWindowTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator(4);
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Estimator.AddRound(200.0f, 2, 0);
+	}
+	TestEqual(TEXT("Every probe lost"), Estimator.GetPacketLoss(), 1.0f);
+
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Estimator.AddRound(10.0f, 2, 2);
+	}
+	TestEqual(TEXT("Round count stays at the window size"), Estimator.GetRoundCount(), 4);
+	TestEqual(TEXT("Rounds out of the window no longer count as lost"), Estimator.GetPacketLoss(), 0.0f);
+	TestEqual(TEXT("Percentile over the window"), Estimator.GetLatencyP95(), 10.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorJitterTest, "AccelByte.Core.LatencyEstimator.Jitter", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorJitterTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Steady;
+	for (int32 Index = 0; Index < 10; Index++)
+	{
+		Steady.AddRound(50.0f, 1, 1);
+	}
+	TestEqual(TEXT("No jitter on a steady latency"), Steady.GetJitter(), 0.0f);
+
+	// Every round differs by 10 ms from the previous one, the jitter converges towards it with a gain of 1/16
+	FAccelByteLatencyEstimator Alternating;
+	float ExpectedJitter = 0.0f;
+	for (int32 Index = 0; Index < 10; Index++)
+	{
+		Alternating.AddRound(Index % 2 == 0 ? 50.0f : 60.0f, 1, 1);
+		if (Index > 0)
+		{
+			ExpectedJitter += (10.0f - ExpectedJitter) / 16.0f;
+		}
+	}
+	TestEqual(TEXT("Jitter follows RFC 3550"), Alternating.GetJitter(), ExpectedJitter, 0.001f);
+
+	// Lost rounds have no round trip to compare with
+	Alternating.AddRound(500.0f, 1, 0);
+	TestEqual(TEXT("Lost round leaves the jitter"), Alternating.GetJitter(), ExpectedJitter, 0.001f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorPacketLossTest, "AccelByte.Core.LatencyEstimator.PacketLoss", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorPacketLossTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator;
+	TestEqual(TEXT("No loss without rounds"), Estimator.GetPacketLoss(), 0.0f);
+
+	Estimator.AddRound(30.0f, 4, 4);
+	Estimator.AddRound(30.0f, 4, 2);
+	Estimator.AddRound(0.0f, 4, 0);
+	TestEqual(TEXT("Lost probes over sent probes"), Estimator.GetPacketLoss(), 0.5f, 0.001f);
+
+	Estimator.AddRound(30.0f, 4, 9);
+	TestEqual(TEXT("More replies than probes are clamped"), Estimator.GetPacketLoss(), 6.0f / 16.0f, 0.001f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorRecentLatencyTest, "AccelByte.Core.LatencyEstimator.RecentLatency", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorRecentLatencyTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator;
+	TestFalse(TEXT("No recent latency before the first round"), Estimator.HasRecentLatency());
+
+	Estimator.AddRound(40.0f, 3, 3);
+	for (int32 Index = 1; Index < FAccelByteLatencyEstimator::MaxConsecutiveLostRounds; Index++)
+	{
+		Estimator.AddRound(0.0f, 3, 0);
+		TestTrue(TEXT("Latency kept over a few lost rounds"), Estimator.HasRecentLatency());
+	}
+
+	Estimator.AddRound(0.0f, 3, 0);
+	TestEqual(TEXT("Lost rounds in a row"), Estimator.GetConsecutiveLostRounds(), FAccelByteLatencyEstimator::MaxConsecutiveLostRounds);
+	TestFalse(TEXT("Latency no longer recent"), Estimator.HasRecentLatency());
+	TestTrue(TEXT("Previous latency still known"), Estimator.HasLatency());
+	TestEqual(TEXT("Previous latency unchanged"), Estimator.GetLatency(), 40.0f);
+
+	Estimator.AddRound(45.0f, 3, 1);
+	TestEqual(TEXT("Partially answered round resets the count"), Estimator.GetConsecutiveLostRounds(), 0);
+	TestTrue(TEXT("Latency recent again"), Estimator.HasRecentLatency());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLatencyEstimatorStableTest, "AccelByte.Core.LatencyEstimator.Stable", LatencyEstimatorTestFlags)
+bool FAccelByteLatencyEstimatorStableTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLatencyEstimator Estimator;
+	Estimator.AddRound(50.0f, 2, 2);
+	Estimator.AddRound(52.0f, 2, 2);
+	TestFalse(TEXT("Not stable before enough rounds"), Estimator.IsStable());
+
+	Estimator.AddRound(51.0f, 2, 2);
+	TestTrue(TEXT("Stable after steady rounds"), Estimator.IsStable());
+
+	Estimator.AddRound(51.0f, 2, 1);
+	TestFalse(TEXT("Not stable when the last round lost a probe"), Estimator.IsStable());
+
+	Estimator.AddRound(51.0f, 2, 2);
+	TestTrue(TEXT("Stable again"), Estimator.IsStable());
+
+	Estimator.AddRound(150.0f, 2, 2);
+	TestFalse(TEXT("Not stable when the last round deviates from the latency"), Estimator.IsStable());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,190 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "Core/AccelByteLockableQueue.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr auto LockableQueueTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+
+	class FQueueProducer : public FRunnable
+	{
+	public:
+		FQueueProducer(FAccelByteLockableQueue<int32>& InQueue, int32 InFirstItem, int32 InItemCount)
+			: Queue(InQueue)
+			, FirstItem(InFirstItem)
+			, ItemCount(InItemCount)
+		{
+		}
+
+		virtual uint32 Run() override
+		{
+			for (int32 Item = FirstItem; Item < FirstItem + ItemCount; Item++)
+			{
+				Queue.Enqueue(Item);
+			}
+			return 0;
+		}
+
+	private:
+		FAccelByteLockableQueue<int32>& Queue;
+		const int32 FirstItem;
+		const int32 ItemCount;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLockableQueueGrowTest, "AccelByte.Core.LockableQueue.Grow", LockableQueueTestFlags)
+bool FAccelByteLockableQueueGrowTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLockableQueue<int32> Queue;
+	Queue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::Grow, 2);
+
+	for (int32 Item = 0; Item < 5; Item++)
+	{
+		TestTrue(TEXT("Enqueue past the capacity is accepted"), Queue.Enqueue(Item));
+	}
+	TestEqual(TEXT("Num"), Queue.Num(), 5);
+	TestEqual(TEXT("High water mark"), Queue.GetHighWaterMark(), 5);
+	TestEqual(TEXT("Dropped"), Queue.GetDroppedCount(), static_cast<int64>(0));
+
+	TArray<int32> Items;
+	TestEqual(TEXT("Dequeued"), Queue.DequeueBatch(Items, 10), 5);
+	TestEqual(TEXT("Items in order"), Items, TArray<int32>{0, 1, 2, 3, 4});
+	TestEqual(TEXT("Num after dequeue"), Queue.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLockableQueueDropNewestTest, "AccelByte.Core.LockableQueue.DropNewest", LockableQueueTestFlags)
+bool FAccelByteLockableQueueDropNewestTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLockableQueue<int32> Queue;
+	Queue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::DropNewest, 3);
+
+	for (int32 Item = 0; Item < 3; Item++)
+	{
+		TestTrue(TEXT("Enqueue within the capacity"), Queue.Enqueue(Item));
+	}
+	TestFalse(TEXT("Enqueue past the capacity is rejected"), Queue.Enqueue(3));
+	TestFalse(TEXT("Enqueue past the capacity is rejected"), Queue.Enqueue(4));
+	TestEqual(TEXT("Num"), Queue.Num(), 3);
+	TestEqual(TEXT("Dropped"), Queue.GetDroppedCount(), static_cast<int64>(2));
+	TestEqual(TEXT("High water mark stays at the capacity"), Queue.GetHighWaterMark(), 3);
+
+	int32 Item = INDEX_NONE;
+	TestTrue(TEXT("Dequeue"), Queue.Dequeue(Item));
+	TestEqual(TEXT("Oldest item is kept"), Item, 0);
+	TestTrue(TEXT("Room is freed by the dequeue"), Queue.Enqueue(5));
+
+	TArray<int32> Items;
+	Queue.DequeueBatch(Items, 10);
+	TestEqual(TEXT("Remaining items"), Items, TArray<int32>{1, 2, 5});
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLockableQueueDropOldestTest, "AccelByte.Core.LockableQueue.DropOldest", LockableQueueTestFlags)
+bool FAccelByteLockableQueueDropOldestTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLockableQueue<int32> Queue;
+	Queue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::DropOldest, 3);
+
+	for (int32 Item = 0; Item < 5; Item++)
+	{
+		TestTrue(TEXT("Enqueue past the capacity is accepted"), Queue.Enqueue(Item));
+	}
+
+	TArray<int32> Items;
+	TestEqual(TEXT("Only the capacity is dequeued"), Queue.DequeueBatch(Items, 10), 3);
+	TestEqual(TEXT("Newest items are kept"), Items, TArray<int32>{2, 3, 4});
+	TestEqual(TEXT("Dropped"), Queue.GetDroppedCount(), static_cast<int64>(2));
+	TestEqual(TEXT("Num"), Queue.Num(), 0);
+	TestTrue(TEXT("Empty"), Queue.IsEmpty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLockableQueueLockTest, "AccelByte.Core.LockableQueue.Lock", LockableQueueTestFlags)
+bool FAccelByteLockableQueueLockTest::RunTest(const FString& Parameters)
+{
+	FAccelByteLockableQueue<int32> Queue;
+	Queue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::DropOldest, 2);
+	Queue.Enqueue(0);
+
+	{
+		TSharedPtr<FAccelByteKey> Key = Queue.LockQueue();
+		Queue.Enqueue(1);
+		Queue.Enqueue(2);
+
+		int32 Item = INDEX_NONE;
+		TestTrue(TEXT("Locked"), Queue.IsLocked());
+		TestFalse(TEXT("Dequeue while locked"), Queue.Dequeue(Item));
+		TestEqual(TEXT("Nothing is dropped while locked"), Queue.GetDroppedCount(), static_cast<int64>(0));
+	}
+
+	TestFalse(TEXT("Unlocked once the key is released"), Queue.IsLocked());
+	TArray<int32> Items;
+	Queue.DequeueBatch(Items, 10);
+	TestEqual(TEXT("Oldest item dropped on the first dequeue after unlocking"), Items, TArray<int32>{1, 2});
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteLockableQueueConcurrentDropOldestTest, "AccelByte.Core.LockableQueue.ConcurrentDropOldest", LockableQueueTestFlags)
+bool FAccelByteLockableQueueConcurrentDropOldestTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumProducers = 4;
+	constexpr int32 ItemsPerProducer = 20000;
+	constexpr int32 Capacity = 64;
+
+	FAccelByteLockableQueue<int32> Queue;
+	Queue.SetOverflowPolicy(EAccelByteQueueOverflowPolicy::DropOldest, Capacity);
+
+	TArray<TUniquePtr<FQueueProducer>> Producers;
+	TArray<FRunnableThread*> Threads;
+	for (int32 Index = 0; Index < NumProducers; Index++)
+	{
+		Producers.Add(MakeUnique<FQueueProducer>(Queue, Index * ItemsPerProducer, ItemsPerProducer));
+		Threads.Add(FRunnableThread::Create(Producers.Last().Get(), *FString::Printf(TEXT("LockableQueueProducer%d"), Index)));
+	}
+
+	// Consumes while the producers run, every item is either dequeued or dropped exactly once
+	int64 Dequeued = 0;
+	bool bOutOfOrder = false;
+	TArray<int32> LastItems;
+	LastItems.Init(INDEX_NONE, NumProducers);
+	TArray<int32> Items;
+	auto Drain = [&]()
+	{
+		Items.Reset();
+		Dequeued += Queue.DequeueBatch(Items, Capacity);
+		for (const int32 Item : Items)
+		{
+			// Dropping only skips items, those of one producer still come out in the order they went in
+			int32& LastItem = LastItems[Item / ItemsPerProducer];
+			bOutOfOrder |= Item <= LastItem;
+			LastItem = Item;
+		}
+	};
+	while (Dequeued + Queue.GetDroppedCount() < NumProducers * ItemsPerProducer)
+	{
+		Drain();
+		FPlatformProcess::Yield();
+	}
+
+	for (FRunnableThread* Thread : Threads)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+	}
+	Drain();
+
+	TestFalse(TEXT("Items of a producer stay in order"), bOutOfOrder);
+	TestEqual(TEXT("Every item is dequeued or dropped"), Dequeued + Queue.GetDroppedCount(), static_cast<int64>(NumProducers * ItemsPerProducer));
+	TestEqual(TEXT("Num"), Queue.Num(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,187 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "Core/AccelByteNotificationBuffer.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace AccelByte;
+
+namespace
+{
+	constexpr auto NotificationBufferTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+
+	FAccelByteModelsUserNotification MakeNotification(int32 SequenceID, int32 SequenceNumber)
+	{
+		FAccelByteModelsUserNotification Notification;
+		Notification.SequenceID = SequenceID;
+		Notification.SequenceNumber = SequenceNumber;
+		Notification.SentAt = FDateTime(2024, 1, 1) + FTimespan::FromSeconds(SequenceID * 1000 + SequenceNumber);
+		return Notification;
+	}
+
+	TArray<int32> GetSequenceNumbers(const TArray<FAccelByteModelsUserNotification>& Notifications)
+	{
+		TArray<int32> SequenceNumbers;
+		for (const FAccelByteModelsUserNotification& Notification : Notifications)
+		{
+			SequenceNumbers.Add(Notification.SequenceNumber);
+		}
+		return SequenceNumbers;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteNotificationBufferInOrderTest, "AccelByte.Core.NotificationBuffer.InOrder", NotificationBufferTestFlags)
+bool FAccelByteNotificationBufferInOrderTest::RunTest(const FString& Parameters)
+{
+	FAccelByteNotificationBuffer Buffer;
+	for (int32 SequenceNumber = 1; SequenceNumber <= 3; SequenceNumber++)
+	{
+		TestFalse(TEXT("Notification in order is not buffered"), Buffer.TryAddBuffer(MakeNotification(1, SequenceNumber)));
+	}
+
+	TestFalse(TEXT("Not buffering"), Buffer.IsBuffering());
+	TestEqual(TEXT("Last sequence number"), Buffer.GetLastNotificationSequenceNumber().GetValue(), 3);
+	TestEqual(TEXT("Last sent at"), Buffer.GetLastNotificationReceivedTime(), MakeNotification(1, 3).SentAt);
+
+	TestFalse(TEXT("Invalid sequence is not buffered"), Buffer.TryAddBuffer(MakeNotification(1, 0)));
+	TestFalse(TEXT("Duplicate is not buffered"), Buffer.TryAddBuffer(MakeNotification(1, 2)));
+	TestFalse(TEXT("Still not buffering"), Buffer.IsBuffering());
+	TestFalse(TEXT("Missing notifications only accepted while buffering"), Buffer.AddMissingNotifications({MakeNotification(1, 4)}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteNotificationBufferGapTest, "AccelByte.Core.NotificationBuffer.Gap", NotificationBufferTestFlags)
+bool FAccelByteNotificationBufferGapTest::RunTest(const FString& Parameters)
+{
+	FAccelByteNotificationBuffer Buffer;
+	Buffer.TryAddBuffer(MakeNotification(1, 1));
+	Buffer.TryAddBuffer(MakeNotification(1, 2));
+
+	const uint32 Episode = Buffer.GetBufferingEpisode();
+	TestTrue(TEXT("Notification after a gap is buffered"), Buffer.TryAddBuffer(MakeNotification(1, 5)));
+	TestTrue(TEXT("Buffering"), Buffer.IsBuffering());
+	TestEqual(TEXT("New buffering episode"), Buffer.GetBufferingEpisode(), Episode + 1);
+
+	TestTrue(TEXT("Later notification is buffered while buffering"), Buffer.TryAddBuffer(MakeNotification(1, 4)));
+	TestTrue(TEXT("Same notification again"), Buffer.TryAddBuffer(MakeNotification(1, 4)));
+	TestTrue(TEXT("Missing notifications accepted"), Buffer.AddMissingNotifications({MakeNotification(1, 2), MakeNotification(1, 3), MakeNotification(1, 5)}));
+
+	TestEqual(TEXT("Sorted buffer without duplicates nor delivered notifications"), GetSequenceNumbers(Buffer.GetSortedBuffer()), TArray<int32>{3, 4, 5});
+	TestTrue(TEXT("Getting the sorted buffer keeps buffering"), Buffer.IsBuffering());
+
+	TestEqual(TEXT("Taken buffer"), GetSequenceNumbers(Buffer.TakeSortedBuffer()), TArray<int32>{3, 4, 5});
+	TestFalse(TEXT("Not buffering once taken"), Buffer.IsBuffering());
+	TestEqual(TEXT("Last sequence number is the latest taken"), Buffer.GetLastNotificationSequenceNumber().GetValue(), 5);
+	TestEqual(TEXT("Buffer is empty once taken"), Buffer.GetSortedBuffer().Num(), 0);
+
+	TestFalse(TEXT("Next notification in order is not buffered"), Buffer.TryAddBuffer(MakeNotification(1, 6)));
+	TestEqual(TEXT("Episode kept until the next gap"), Buffer.GetBufferingEpisode(), Episode + 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteNotificationBufferReconnectTest, "AccelByte.Core.NotificationBuffer.Reconnect", NotificationBufferTestFlags)
+bool FAccelByteNotificationBufferReconnectTest::RunTest(const FString& Parameters)
+{
+	FAccelByteNotificationBuffer Buffer;
+	Buffer.TryAddBuffer(MakeNotification(1, 1));
+	Buffer.TryAddBuffer(MakeNotification(1, 2));
+
+	// A new sequence ID after reconnecting, the notifications of the previous one come back as missing
+	TestTrue(TEXT("New sequence ID is buffered"), Buffer.TryAddBuffer(MakeNotification(2, 2)));
+	Buffer.TryAddBuffer(MakeNotification(2, 1));
+	Buffer.AddMissingNotifications({MakeNotification(1, 3), MakeNotification(1, 4)});
+
+	const TArray<FAccelByteModelsUserNotification> Sorted = Buffer.TakeSortedBuffer();
+	TestEqual(TEXT("Sorted count"), Sorted.Num(), 4);
+	if (Sorted.Num() == 4)
+	{
+		TestEqual(TEXT("Previous sequence ID first"), Sorted[0].SequenceID, 1);
+		TestEqual(TEXT("Previous sequence ID first"), Sorted[1].SequenceID, 1);
+		TestEqual(TEXT("New sequence ID last"), Sorted[2].SequenceID, 2);
+		TestEqual(TEXT("New sequence ID last"), Sorted[3].SequenceID, 2);
+		TestEqual(TEXT("Sequence numbers in order within each ID"), GetSequenceNumbers(Sorted), TArray<int32>{3, 4, 1, 2});
+	}
+	TestEqual(TEXT("Last sequence ID"), Buffer.GetLastNotificationSequenceID().GetValue(), 2);
+	TestEqual(TEXT("Last sequence number"), Buffer.GetLastNotificationSequenceNumber().GetValue(), 2);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteNotificationBufferShuffledTest, "AccelByte.Core.NotificationBuffer.Shuffled", NotificationBufferTestFlags)
+bool FAccelByteNotificationBufferShuffledTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NotificationCount = 500;
+
+	TArray<FAccelByteModelsUserNotification> Notifications;
+	for (int32 SequenceNumber = 2; SequenceNumber <= NotificationCount; SequenceNumber++)
+	{
+		Notifications.Add(MakeNotification(1, SequenceNumber));
+	}
+	FRandomStream Random(47);
+	for (int32 Index = Notifications.Num() - 1; Index > 0; Index--)
+	{
+		Notifications.Swap(Index, Random.RandRange(0, Index));
+	}
+
+	FAccelByteNotificationBuffer Buffer;
+	Buffer.SetLimits(0, 0.0);
+	Buffer.TryAddBuffer(MakeNotification(1, 1));
+
+	// Half arrives live, the first one out of order opens the gap, the other half comes back as missing, twice
+	const int32 Half = Notifications.Num() / 2;
+	TSet<int32> Delivered;
+	for (int32 Index = 0; Index < Half; Index++)
+	{
+		if (!Buffer.TryAddBuffer(Notifications[Index]))
+		{
+			Delivered.Add(Notifications[Index].SequenceNumber);
+		}
+	}
+	TestTrue(TEXT("Buffering"), Buffer.IsBuffering());
+	Buffer.AddMissingNotifications(TArray<FAccelByteModelsUserNotification>(Notifications.GetData() + Half, Notifications.Num() - Half));
+	Buffer.AddMissingNotifications(Notifications);
+
+	TArray<int32> Expected;
+	for (int32 SequenceNumber = 2; SequenceNumber <= NotificationCount; SequenceNumber++)
+	{
+		if (!Delivered.Contains(SequenceNumber))
+		{
+			Expected.Add(SequenceNumber);
+		}
+	}
+	TestEqual(TEXT("Every notification not delivered yet, once, in sequence order"), GetSequenceNumbers(Buffer.TakeSortedBuffer()), Expected);
+	TestEqual(TEXT("Last sequence number"), Buffer.GetLastNotificationSequenceNumber().GetValue(), NotificationCount);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteNotificationBufferReleaseTest, "AccelByte.Core.NotificationBuffer.Release", NotificationBufferTestFlags)
+bool FAccelByteNotificationBufferReleaseTest::RunTest(const FString& Parameters)
+{
+	FAccelByteNotificationBuffer Buffer;
+	Buffer.SetLimits(3, 0.0);
+	TestFalse(TEXT("Nothing to release while not buffering"), Buffer.ShouldRelease());
+
+	Buffer.TryAddBuffer(MakeNotification(1, 1));
+	Buffer.TryAddBuffer(MakeNotification(1, 3));
+	Buffer.TryAddBuffer(MakeNotification(1, 4));
+	TestFalse(TEXT("Not released below the limit"), Buffer.ShouldRelease());
+
+	Buffer.TryAddBuffer(MakeNotification(1, 5));
+	TestTrue(TEXT("Released at the limit"), Buffer.ShouldRelease());
+
+	Buffer.Clear();
+	TestFalse(TEXT("Not buffering once cleared"), Buffer.IsBuffering());
+	TestEqual(TEXT("Cleared up to the latest buffered"), Buffer.GetLastNotificationSequenceNumber().GetValue(), 5);
+	TestFalse(TEXT("Nothing to release once cleared"), Buffer.ShouldRelease());
+
+	Buffer.SetLimits(0, 0.01);
+	Buffer.TryAddBuffer(MakeNotification(1, 7));
+	FPlatformProcess::Sleep(0.02f);
+	TestTrue(TEXT("Released once the gap timed out"), Buffer.ShouldRelease());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,239 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Misc/AutomationTest.h"
+#include "Core/Ping/AccelBytePing.h"
+#include "IPAddress.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr auto UdpPingerTestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter;
+
+	const ANSICHAR EchoPing[] = "PING";
+	const ANSICHAR EchoPong[] = "PONG";
+	constexpr int32 EchoPayloadSize = 4;
+
+	/** Upper bound of a whole test, far above what the pings need even on a slow frame rate. */
+	constexpr double UdpPingerTestTimeout = 30.0;
+
+	/**
+	 * Loopback UDP targets answering like a QoS server. Echo targets are served from the game thread while the test
+	 * waits, silent targets are bound but never read, so every probe sent to them is lost.
+	 */
+	struct FUdpEchoTargets
+	{
+		struct FTarget
+		{
+			FSocket* Socket = nullptr;
+			int32 Port = 0;
+			bool bEcho = false;
+			bool bCompleted = false;
+			FPingResult Result{};
+		};
+
+		ISocketSubsystem* SocketSubsystem = nullptr;
+		TArray<FTarget> Targets;
+		int32 CompletedCount = 0;
+		double StartTime = 0.0;
+
+		FUdpEchoTargets()
+			: SocketSubsystem(ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+		{
+		}
+
+		~FUdpEchoTargets()
+		{
+			for (const FTarget& Target : Targets)
+			{
+				if (Target.Socket != nullptr)
+				{
+					SocketSubsystem->DestroySocket(Target.Socket);
+				}
+			}
+		}
+
+		bool AddTarget(bool bEcho)
+		{
+			if (SocketSubsystem == nullptr)
+			{
+				return false;
+			}
+
+			FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("ABPingEchoTest"), FNetworkProtocolTypes::IPv4);
+			if (Socket == nullptr)
+			{
+				return false;
+			}
+
+			bool bIpValid = false;
+			TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+			Address->SetIp(TEXT("127.0.0.1"), bIpValid);
+			Address->SetPort(0);
+			if (!bIpValid || !Socket->SetNonBlocking(true) || !Socket->Bind(*Address))
+			{
+				SocketSubsystem->DestroySocket(Socket);
+				return false;
+			}
+
+			FTarget& Target = Targets.AddDefaulted_GetRef();
+			Target.Socket = Socket;
+			Target.Port = Socket->GetPortNo();
+			Target.bEcho = bEcho;
+			return true;
+		}
+
+		void Echo()
+		{
+			TSharedRef<FInternetAddr> FromAddress = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+			for (const FTarget& Target : Targets)
+			{
+				if (!Target.bEcho)
+				{
+					continue;
+				}
+
+				uint32 PendingDataSize = 0;
+				while (Target.Socket->HasPendingData(PendingDataSize))
+				{
+					uint8 Buffer[64];
+					int32 BytesRead = 0;
+					if (!Target.Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *FromAddress))
+					{
+						break;
+					}
+
+					if (BytesRead >= EchoPayloadSize && FMemory::Memcmp(Buffer, EchoPing, EchoPayloadSize) == 0)
+					{
+						int32 BytesSent = 0;
+						Target.Socket->SendTo(reinterpret_cast<const uint8*>(EchoPong), EchoPayloadSize, BytesSent, *FromAddress);
+					}
+				}
+			}
+		}
+	};
+
+	typedef TSharedRef<FUdpEchoTargets, ESPMode::ThreadSafe> FUdpEchoTargetsRef;
+
+	/** Pings every target at once, completions are collected on the game thread. */
+	void PingTargets(const FUdpEchoTargetsRef& EchoTargets, float Timeout, int32 PingNum)
+	{
+		EchoTargets->StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < EchoTargets->Targets.Num(); Index++)
+		{
+			FPingConfig Config;
+			Config.Address = TEXT("127.0.0.1");
+			Config.Port = EchoTargets->Targets[Index].Port;
+			Config.Timeout = Timeout;
+			Config.PingNum = PingNum;
+
+			FAccelBytePing::SendUdpPing(Config, FPingCompleteDelegate::CreateLambda([EchoTargets, Index](FPingResult Result)
+				{
+					FUdpEchoTargets::FTarget& Target = EchoTargets->Targets[Index];
+					if (!Target.bCompleted)
+					{
+						Target.bCompleted = true;
+						Target.Result = Result;
+						EchoTargets->CompletedCount++;
+					}
+				}));
+		}
+	}
+
+	/** Serves the echo targets every frame until every ping completed. */
+	bool WaitForPings(const FUdpEchoTargetsRef& EchoTargets)
+	{
+		EchoTargets->Echo();
+		return EchoTargets->CompletedCount == EchoTargets->Targets.Num()
+			|| FPlatformTime::Seconds() - EchoTargets->StartTime > UdpPingerTestTimeout;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteUdpPingerEchoTest, "AccelByte.Core.UdpPinger.Echo", UdpPingerTestFlags)
+bool FAccelByteUdpPingerEchoTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 TargetCount = 50;
+	constexpr int32 PingNum = 3;
+	constexpr float Timeout = 2.0f;
+
+	FUdpEchoTargetsRef EchoTargets = MakeShared<FUdpEchoTargets, ESPMode::ThreadSafe>();
+	for (int32 Index = 0; Index < TargetCount; Index++)
+	{
+		if (!EchoTargets->AddTarget(true))
+		{
+			AddError(TEXT("Unable to bind a loopback UDP socket"));
+			return false;
+		}
+	}
+
+	PingTargets(EchoTargets, Timeout, PingNum);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([EchoTargets]()
+		{
+			return WaitForPings(EchoTargets);
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, EchoTargets]()
+		{
+			TestEqual(TEXT("Every ping completed"), EchoTargets->CompletedCount, TargetCount);
+			for (const FUdpEchoTargets::FTarget& Target : EchoTargets->Targets)
+			{
+				const FString What = FString::Printf(TEXT("Target on port %d"), Target.Port);
+				TestTrue(*What, Target.Result.Status == FPingResultStatus::Success);
+				TestEqual(*What, Target.Result.Sent, PingNum);
+				TestEqual(*What, Target.Result.Received, PingNum);
+				TestEqual(*What, Target.Result.Lost, 0);
+				TestTrue(*What, Target.Result.MinimumRoundTrip > 0.0f && Target.Result.MaximumRoundTrip < Timeout);
+			}
+			return true;
+		}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteUdpPingerLossTest, "AccelByte.Core.UdpPinger.Loss", UdpPingerTestFlags)
+bool FAccelByteUdpPingerLossTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 TargetCount = 20;
+	constexpr int32 PingNum = 2;
+	// Echo replies wait for the next frame, the timeout leaves room for a slow one
+	constexpr float Timeout = 1.0f;
+
+	// Silent targets in between echo targets, their lost probes must not be credited with the replies of others
+	FUdpEchoTargetsRef EchoTargets = MakeShared<FUdpEchoTargets, ESPMode::ThreadSafe>();
+	for (int32 Index = 0; Index < TargetCount; Index++)
+	{
+		if (!EchoTargets->AddTarget(Index % 2 == 0))
+		{
+			AddError(TEXT("Unable to bind a loopback UDP socket"));
+			return false;
+		}
+	}
+
+	PingTargets(EchoTargets, Timeout, PingNum);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([EchoTargets]()
+		{
+			return WaitForPings(EchoTargets);
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, EchoTargets]()
+		{
+			TestEqual(TEXT("Every ping completed"), EchoTargets->CompletedCount, TargetCount);
+			for (const FUdpEchoTargets::FTarget& Target : EchoTargets->Targets)
+			{
+				const FString What = FString::Printf(TEXT("%s target on port %d"), Target.bEcho ? TEXT("Echo") : TEXT("Silent"), Target.Port);
+				TestTrue(*What, Target.Result.Status == FPingResultStatus::Success);
+				TestEqual(*What, Target.Result.Sent, PingNum);
+				TestEqual(*What, Target.Result.Received, Target.bEcho ? PingNum : 0);
+				TestEqual(*What, Target.Result.Lost, Target.bEcho ? 0 : PingNum);
+			}
+			return true;
+		}));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
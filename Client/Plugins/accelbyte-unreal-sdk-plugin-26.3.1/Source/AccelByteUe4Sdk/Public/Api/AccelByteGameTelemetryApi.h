@@ -11,8 +11,11 @@
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteDefines.h"
+#include "Core/AccelByteTelemetrySpool.h"
 #include "Models/AccelByteGameTelemetryModels.h"
 
+#include <atomic>
+
 namespace AccelByte
 {
 class Credentials;
@@ -21,6 +24,20 @@ namespace Api
 {
 typedef TSharedPtr< FAccelByteModelsTelemetryBody, ESPMode::ThreadSafe> TelemetryBodyPtr;
 
+/**
+ * @brief Counters of the telemetry batches sent to the backend.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteTelemetryBatchStats
+{
+	int64 BatchesSent = 0;
+	int64 EventsSent = 0;
+	int64 CompressedBatches = 0;
+	/** Size of the serialized batches before compression. */
+	int64 UncompressedBytes = 0;
+	/** Size of the request bodies actually sent. */
+	int64 SentBytes = 0;
+};
+
 /**
  * @brief Send telemetry data securely and the user should be logged in first.
  */
@@ -39,6 +56,28 @@ public:
 	 */
 	void SetBatchFrequency(FTimespan Interval);
 
+	/**
+	 * @brief Set the limits of a single telemetry request, larger queues are split into several requests.
+	 * Queues holding more than MaxEvents are flushed before the batch interval elapses.
+	 *
+	 * @param MaxEvents Maximum number of events in one request.
+	 * @param MaxBytes Approximate maximum size of one request body.
+	 */
+	void SetBatchLimits(int32 MaxEvents, int32 MaxBytes);
+
+	/**
+	 * @brief Enable gzip compression of the request bodies.
+	 * Compression is turned off again if the backend rejects the encoding.
+	 *
+	 * @param bEnable Whether to compress the request bodies.
+	 */
+	void SetBatchCompression(bool bEnable);
+
+	/**
+	 * @brief Get the counters of the batches sent so far.
+	 */
+	FAccelByteTelemetryBatchStats GetBatchStats() const;
+
 	/**
 	 * @brief Set list of event that need to be backed up on disc before sending in order to be able to recover in case of failure.
 	 *
@@ -89,10 +128,40 @@ private:
 	void SendProtectedEvents(TArray<TelemetryBodyPtr> const& Events
 		, FVoidHandler const& OnSuccess
 		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Send one serialized batch, compressed when enabled and worth it.
+	 *
+	 * @param Content JSON array body of the batch.
+	 * @param EventCount Number of events in the batch.
+	 * @param bIsUncompressedResend Resend of a batch the backend refused compressed, sent as is and not counted again.
+	 */
+	void SendBatch(FString const& Content
+		, int32 EventCount
+		, FVoidHandler const& OnSuccess
+		, FErrorHandler const& OnError
+		, bool bIsUncompressedResend = false);
+
+	/**
+	 * @brief Serialize events into request bodies that respect the batch limits.
+	 *
+	 * @param Events Events to serialize, in order.
+	 * @param OutContents One JSON array body per batch.
+	 * @param OutEventIndices Index in Events of every event held by each batch, invalid events are left out.
+	 */
+	void SerializeBatches(TArray<TelemetryBodyPtr> const& Events
+		, TArray<FString>& OutContents
+		, TArray<TArray<int32>>& OutEventIndices);
 	
 	bool PeriodicTelemetry(float DeltaTime);
+
+	void SendQueuedEvents(int32 MaxEvents);
+
+	void EnqueueJob(TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler> const& Job);
 	
 	void LoadCachedEvents();
+
+	void SendCachedEvents(TArray<TelemetryBodyPtr> const& Events);
 	
 	void AppendEventToCache(TelemetryBodyPtr Telemetry);
 	
@@ -101,8 +170,17 @@ private:
 	void OnLogoutSuccess();
 	
 	void RemoveEventsFromCache(TArray<TelemetryBodyPtr> const& Events);
-	
-	bool JobArrayQueueAsJsonString(FString& OutJsonString);
+
+	/**
+	 * @brief Open the spool of the logged in user, must be called with EventSpoolLock held.
+	 *
+	 * @return The spool, or nullptr when there is no user logged in.
+	 */
+	FAccelByteTelemetrySpool* GetEventSpool();
+
+	static bool EventToJsonString(FAccelByteModelsTelemetryBody const& Event, FString& OutJsonString);
+
+	static TelemetryBodyPtr EventFromJsonObject(TSharedPtr<FJsonObject> const& JsonObj);
 
 	const FString GetEventNamespace();
 	
@@ -125,9 +203,26 @@ private:
 	
 	bool bCacheUpdated = false;
 	TQueue<TTuple<TelemetryBodyPtr, FVoidHandler, FErrorHandler>> JobQueue{};
-	FString EventPtrArrayAccumulation{};//Contains EventPtrArray that will be written to cache, update by EventPtrArrayAccumulation
-	TArray<TelemetryBodyPtr> EventPtrArray;
-	mutable FCriticalSection EventPtrArrayLock;
+	TUniquePtr<FAccelByteTelemetrySpool> EventSpool;
+	FString EventSpoolKey;
+	TArray<FAccelByteSpooledEvent> RecoveredEvents;//Events left in the spool by a previous session, sent by LoadCachedEvents
+	TMap<TelemetryBodyPtr, int64> SpooledEvents;//Sequence of every event written to the spool and not sent yet
+	mutable FCriticalSection EventSpoolLock;
+
+	std::atomic<int32> QueuedEventCount{0};
+	double LastFlushTime = 0.0;
+	bool bFlushBacklog = false;//Set when a flush left events behind, the next tick sends them without waiting for the interval
+
+	int32 MaxBatchEvents = DefaultMaxBatchEvents;
+	int32 MaxBatchBytes = DefaultMaxBatchBytes;
+	std::atomic<bool> bCompressBatches{false};
+	FAccelByteTelemetryBatchStats BatchStats;
+	mutable FCriticalSection BatchStatsLock;
+
+	static constexpr int32 DefaultMaxBatchEvents = 500;
+	static constexpr int32 DefaultMaxBatchBytes = 256 * 1024;
+	static constexpr int32 MaxBatchesPerFlush = 4;
+	static constexpr int32 MinimumCompressionBytes = 1024;
 
 	bool bTelemetryJobStarted = false;
 	FTimespan const MINIMUM_INTERVAL_TELEMETRY = FTimespan(0, 0, 5);
@@ -55,16 +55,53 @@ struct FLobbyMessageMetaData
 	FString Id{};
 };
 
+enum class ELobbyMessageKind : uint8
+{
+	Unknown,
+	Response,
+	Notif,
+	SessionNotif,
+};
+
+/**
+ * @brief Identity of a lobby message type, resolved once when the message is received.
+ */
+struct FLobbyMessageTypeId
+{
+	ELobbyMessageKind Kind {ELobbyMessageKind::Unknown};
+	uint8 Value {0}; // Response or Notif enum value, 0 (Invalid) for types without a handler
+};
+
 struct FHandleLobbyMessageData
 {
 	EHandleLobbyMessageDataType Type {EHandleLobbyMessageDataType::None};
 	FString Topic; // for MM and Session
 	FString Payload; // for MM and Session
 	FString MessageType;
+	FLobbyMessageTypeId MessageTypeId;
 	FString ParsedJsonString;
 	TSharedPtr<FJsonObject> ParsedJsonObject;
 	bool bSkipConditioner;
 };
+
+/**
+ * @brief Counters of the notifications drained from the lobby notification queue.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteLobbyNotificationDrainStats
+{
+	/** Notifications still waiting in the queue after the last tick. */
+	int32 BacklogDepth = 0;
+	/** Most notifications that waited in the queue at once. */
+	int32 BacklogHighWaterMark = 0;
+	/** Notifications discarded because the queue was over [Lobby] NotificationQueueCapacity. */
+	int64 DroppedNotifications = 0;
+	/** Notifications dispatched by the last tick that had any. */
+	int32 LastTickDispatched = 0;
+	int64 TotalDispatched = 0;
+	/** Average and longest time spent dispatching a single notification. */
+	double AverageDispatchSeconds = 0.0;
+	double MaxDispatchSeconds = 0.0;
+};
 	
 enum Response : uint8;
 enum Notif : uint8;
@@ -2841,6 +2878,20 @@ public:
 	 */
 	TSharedPtr<FAccelByteKey> LockNotifications();
 
+	/**
+	 * @brief Set how many queued notifications are dispatched per tick. Each tick stops at whichever limit is reached first.
+	 * Defaults are read from [Lobby] NotificationDrainMaxMessages and NotificationDrainBudgetMicroseconds.
+	 *
+	 * @param MaxMessages Maximum number of notifications per tick, at least one is always dispatched.
+	 * @param MaxSeconds Time after which the tick stops dispatching, 0 or less for no time limit.
+	 */
+	void SetNotificationDrainBudget(int32 MaxMessages, double MaxSeconds);
+
+	/**
+	 * @brief Get the backlog and dispatch timings of the notification queue.
+	 */
+	FAccelByteLobbyNotificationDrainStats GetNotificationDrainStats() const;
+
 	/**
 	 * @brief Startup module
 	 */
@@ -2865,9 +2916,13 @@ private:
 
 	void OnMassiveOutage(FMassiveOutageInfo const& MassiveOutageInfo);
 
+	void OnSendDropped(TArray<FString> const& Messages);
+
     FString SendRawRequest(FString const& MessageType
     	, FString const& MessageIDPrefix
-    	, FString const& CustomPayload = TEXT(""));
+    	, FString const& CustomPayload = TEXT("")
+    	, FName CoalesceKey = NAME_None
+    	, EWebSocketSendResult* OutSendResult = nullptr);
 	
     FString GenerateMessageID(FString const& Prefix = TEXT("")) const;
 	
@@ -2881,14 +2936,16 @@ private:
 
 	bool TryBufferNotification(FString const& ParsedJsonString);
 
-	void OnGetMissingNotificationSuccess(FAccelByteModelsGetUserNotificationsResponse const& MissingNotifications);
+	void OnGetMissingNotificationSuccess(FAccelByteModelsGetUserNotificationsResponse const& MissingNotifications, uint32 BufferingEpisode);
 
-	void OnGetMissingNotificationError(int32 ErrorCode, FString const& ErrorMessage);
+	void OnGetMissingNotificationError(int32 ErrorCode, FString const& ErrorMessage, uint32 BufferingEpisode);
 
 	void OnTokenReceived(FString const& Token);
 
 	bool Tick(float DeltaTime);
 
+	void DispatchQueuedNotification(FHandleLobbyMessageData const& Message);
+
 	void HandleLobbyMessageByType(FHandleLobbyMessageData const& MessageData);
 	
 #pragma region Notification Buffer
@@ -2898,15 +2955,33 @@ private:
 #pragma endregion
 
 #pragma region Message Parsing
+	/**
+	 * @brief Identify a message type with a single lookup in a table of interned names built on first use.
+	 * Types without a handler are classified by their suffix.
+	 */
+	static FLobbyMessageTypeId IdentifyMessageType(FString const& MessageType);
+
 	void HandleMessageResponse(FString const& ReceivedMessageType
 		, FString const& ParsedJsonString
 		, TSharedPtr<FJsonObject> const& ParsedJsonObj
 		, TSharedPtr<FLobbyMessageMetaData> const& MessageMeta);
+
+	void HandleMessageResponse(Response ResponseEnum
+		, FString const& ReceivedMessageType
+		, FString const& ParsedJsonString
+		, TSharedPtr<FJsonObject> const& ParsedJsonObj
+		, TSharedPtr<FLobbyMessageMetaData> const& MessageMeta);
 	
 	void HandleMessageNotif(FString const& ReceivedMessageType
 		, FString const& ParsedJsonString
 		, TSharedPtr<FJsonObject> const& ParsedJsonObj
 		, bool bSkipConditioner);
+
+	void HandleMessageNotif(Notif NotifEnum
+		, FString const& ReceivedMessageType
+		, FString const& ParsedJsonString
+		, TSharedPtr<FJsonObject> const& ParsedJsonObj
+		, bool bSkipConditioner);
 	
 	void HandleV2SessionNotif(FString const& ParsedJsonString, bool bSkipConditioner);
 	void DispatchV2SessionMessageByTopic(FString const& Topic, FString const& Payload, FString const& ParsedJsonString);
@@ -2927,7 +3002,15 @@ private:
 #pragma endregion
 
 	static TMap<FString, FString> LobbyErrorMessages;
-	const float LobbyTickPeriod = 0.5;
+	static constexpr int32 DefaultNotificationDrainMaxMessages = 100;
+	static constexpr int32 DefaultNotificationDrainBudgetMicroseconds = 2000;
+	static constexpr int32 DefaultMaxBufferedNotifications = 1000;
+	static constexpr int32 DefaultNotificationBufferGapTimeoutSeconds = 60;
+	int32 NotificationDrainMaxMessages = DefaultNotificationDrainMaxMessages;
+	double NotificationDrainMaxSeconds = DefaultNotificationDrainBudgetMicroseconds / 1000000.0;
+	mutable FCriticalSection NotificationDrainStatsLock{};
+	FAccelByteLobbyNotificationDrainStats NotificationDrainStats{};
+	double TotalDispatchSeconds = 0.0;
 	const float PingDelay;
 	bool bWasWsConnectionError = false;
 	float TimeSinceLastPing;
@@ -2993,6 +3076,7 @@ private:
 
 	// Presence
 	TMap<FString, FSetUserPresenceResponse> MessageIdSetUserPresenceResponseMap;
+	FString QueuedSetUserPresenceMessageId;
 	TMap<FString, FGetAllFriendsStatusResponse> MessageIdGetAllFriendsStatusResponseMap;
 
 	// Matchmaking
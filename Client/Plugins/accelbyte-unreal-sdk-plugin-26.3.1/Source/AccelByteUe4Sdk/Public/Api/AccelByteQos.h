@@ -11,6 +11,7 @@
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteDefines.h"
 #include "Core/AccelByteMessagingSystem.h"
+#include "Core/Ping/AccelByteLatencyEstimator.h"
 #include "Models/AccelByteQosModels.h"
 #include "Templates/SharedPointer.h"
 
@@ -67,8 +68,20 @@ public:
 
 	/**
 	 * @brief Get cached latencies data
+	 * - Latencies are smoothed over the ping rounds, so a single noisy round does not flip the closest region.
 	 */
 	const TArray<TPair<FString, float>>& GetCachedLatencies();
+
+	/**
+	 * @brief Get the latency stats of every region pinged so far.
+	 */
+	TArray<FAccelByteModelsQosRegionLatencyStats> GetCachedLatencyStats() const;
+
+	/**
+	 * @brief Get the latency stats of a region.
+	 * @return false if the region has not been pinged yet.
+	 */
+	bool GetCachedLatencyStats(FString const& Region, FAccelByteModelsQosRegionLatencyStats& OutStats) const;
 	
 private:
 	// Constructor
@@ -79,6 +92,24 @@ private:
 	static FAccelByteModelsQosServerList QosServers;
 	static TArray<TPair<FString, float>> Latencies;
 	static TMap<FString, TSharedPtr<FInternetAddr>> ResolvedAddresses;
+	static TMap<FString, FAccelByteLatencyEstimator> LatencyEstimators;
+
+	/** @brief Number of ping rounds kept by each region estimator, set from the [Qos] LatencyWindowSize config. */
+	static int32 LatencyWindowSize;
+
+	/**
+	 * @brief Adaptive probing of the Latencies poller.
+	 * - Every round where all regions are stable doubles the number of poll intervals between rounds, up to
+	 *   MaxLatencyPollBackoff (the [Qos] LatencyPollMaxBackoff config).
+	 * - A round with a lost ping or a latency change resets it to every poll interval.
+	 */
+	static int32 MaxLatencyPollBackoff;
+	static int32 LatencyPollBackoff;
+	static int32 LatencyPollRoundsToSkip;
+	static void UpdateLatencyPollBackoff(bool bStable);
+
+	static FAccelByteLatencyEstimator& FindOrAddLatencyEstimator(FString const& Region);
+	static FAccelByteModelsQosRegionLatencyStats ToLatencyStats(FString const& Region, FAccelByteLatencyEstimator const& Estimator);
 	
 	/**
 	 * @brief Get Latencies from cached regions, every x seconds.
@@ -0,0 +1,119 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteBlockPool, Log, All);
+
+namespace AccelByte
+{
+namespace Core
+{
+
+struct FAccelByteBlockPoolStats
+{
+	/** Bytes reserved up front for the pool. */
+	size_t ReservedBytes = 0;
+	/** Bytes of the blocks currently handed out, rounded up to their size class. */
+	size_t UsedBytes = 0;
+	size_t HighWaterUsedBytes = 0;
+	int32 UsedBlocks = 0;
+	int32 HighWaterUsedBlocks = 0;
+	/** Slabs not assigned to any size class. */
+	int32 FreeSlabs = 0;
+	int32 TotalSlabs = 0;
+	/** Allocations refused because the pool was full or the size was above the largest size class. */
+	int32 FailedAllocations = 0;
+};
+
+/**
+ * Fixed-block allocator over a single reservation, for small objects of up to one slab.
+ * The reservation is cut into slabs, each slab serves one power of two size class and keeps freed blocks in an intrusive free list,
+ * so Allocate and Free are O(1) and the blocks themselves never come from the system heap after construction.
+ * Thread safe, blocks may be freed from any thread.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteBlockPool
+{
+public:
+	static constexpr size_t MinBlockSize = 16;
+	static constexpr size_t SlabSize = 16 * 1024;
+	static constexpr size_t BlockAlignment = 16;
+
+	/**
+	 * @param PoolSize Bytes to reserve, rounded up to a whole number of slabs
+	 */
+	explicit FAccelByteBlockPool(size_t PoolSize);
+	~FAccelByteBlockPool();
+
+	FAccelByteBlockPool(const FAccelByteBlockPool&) = delete;
+	FAccelByteBlockPool& operator=(const FAccelByteBlockPool&) = delete;
+
+	/**
+	 * @brief Take a block of at least Size bytes, aligned to BlockAlignment.
+	 *
+	 * @return The block, or nullptr if the pool is full or Size is bigger than a slab
+	 */
+	void* Allocate(size_t Size);
+
+	/**
+	 * @brief Return a block taken from this pool.
+	 */
+	void Free(void* Block);
+
+	/**
+	 * @brief Give slabs without any block in use back to the pool so other size classes can use them.
+	 * Blocks in use never move, only fully free slabs are reclaimed.
+	 *
+	 * @return Number of slabs reclaimed
+	 */
+	int32 Defragment();
+
+	bool Owns(const void* Block) const;
+
+	FAccelByteBlockPoolStats GetStats() const;
+
+private:
+	static constexpr int32 NumSizeClasses = 11; // 16 bytes to SlabSize
+	static_assert((MinBlockSize << (NumSizeClasses - 1)) == SlabSize, "Largest size class has to match the slab size");
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct FSizeClass
+	{
+		FFreeBlock* FreeList = nullptr;
+		/** Slab blocks are carved from before the free list is used, INDEX_NONE if none. */
+		int32 BumpSlab = INDEX_NONE;
+		size_t BumpOffset = 0;
+	};
+
+	struct FSlab
+	{
+		/** Size class served by the slab, INDEX_NONE if free. */
+		int32 SizeClass = INDEX_NONE;
+		int32 UsedBlocks = 0;
+		int32 NextFreeSlab = INDEX_NONE;
+	};
+
+	static int32 GetSizeClass(size_t Size);
+	static size_t GetBlockSize(int32 SizeClass) { return MinBlockSize << SizeClass; }
+	int32 GetSlabIndex(const void* Block) const;
+	int32 TakeFreeSlab();
+	void ReleaseSlab(int32 SlabIndex);
+
+	uint8* Memory = nullptr;
+	TArray<FSlab> Slabs;
+	int32 FirstFreeSlab = INDEX_NONE;
+	FSizeClass SizeClasses[NumSizeClasses];
+	FAccelByteBlockPoolStats Stats;
+	mutable FCriticalSection Lock;
+};
+
+}
+}
@@ -9,6 +9,7 @@
 #include "Models/AccelByteOauth2Models.h"
 #include "Core/IAccelByteDataStorage.h"
 #include "HAL/FileManager.h"
+#include "HAL/CriticalSection.h"
 #include "Misc/Optional.h"
 #include "AccelByteDataStorageBinaryFile.generated.h"
 
@@ -239,6 +240,84 @@ protected:
 	* @param NewGenerelPurposeCacheFilename 
 	*/
 	virtual void MoveOldCacheToNewCacheFiles(const FABBinaryFileStructure& CacheContent, const FString& NewTelemetryCacheFilename, const FString& NewGenerelPurposeCacheFilename);
+
+	/**
+	* Each file is a log of length-prefixed binary records protected by a CRC.
+	* Saving or deleting a key appends one record, the file is only rewritten when compacted.
+	* A record torn by a crash fails its CRC and is dropped, with every record before it kept.
+	*/
+	enum class ERecordType : uint8
+	{
+		Put = 1,
+		Delete = 2
+	};
+
+	struct FRecordLocation
+	{
+		/** Offset of the value in the file. */
+		int64 Offset = 0;
+		int32 Size = 0;
+		/** Size of the whole record, counted as dead once the key is overwritten or deleted. */
+		int32 RecordSize = 0;
+	};
+
+	struct FStorageFile
+	{
+		/** Latest value of each key in the file, replaces the linear search of the JSON lines format. */
+		TMap<FString, FRecordLocation> Index;
+		int64 FileSize = 0;
+		/** Bytes of records that were overwritten or deleted since the last compaction. */
+		int64 DeadBytes = 0;
+		/**
+		 * The file could not be migrated or repaired, it is kept untouched and writes are refused.
+		 * The next open tries again.
+		 */
+		bool bNeedsRewrite = false;
+	};
+
+	/**
+	* @brief Get the index of the file, replaying its log on first access.
+	* A file in the JSON lines format is migrated to the binary format.
+	*
+	* @param FileName The name of the file, not the absolute path.
+	* @return The index of the file, never nullptr.
+	*/
+	virtual FStorageFile& OpenStorageFile(const FString& FileName);
+
+	/**
+	* @brief Append a record to the file and update its index.
+	*
+	* @return Is the record on disk.
+	*/
+	virtual bool AppendRecord(const FString& FileName, FStorageFile& File, ERecordType Type, const FString& Key, const TArray<uint8>& Value);
+
+	/**
+	* @brief Read the value of a key from the file.
+	*/
+	virtual bool ReadRecordValue(const FString& FileName, const FStorageFile& File, const FString& Key, TArray<uint8>& OutValue);
+
+	/**
+	* @brief Rewrite the file with a single Put record per item, through a temporary file so the original survives a crash.
+	*/
+	virtual bool WriteSnapshot(const FString& FileName, const TArray<TPair<FString, TArray<uint8>>>& Items, FStorageFile& OutFile);
+
+	/**
+	* @brief Rewrite the file without dead records once they take more space than the live ones.
+	*/
+	virtual void CompactIfNeeded(const FString& FileName, FStorageFile& File);
+
+	/**
+	* @brief Convert a file from the JSON lines format into the binary format.
+	*
+	* @return True if the file was in the JSON lines format.
+	*/
+	virtual bool MigrateLegacyFile(const FString& FileName, FStorageFile& OutFile);
+
+	static bool IsBinaryFormat(const TArray<uint8>& Content);
+	static void SerializeRecord(ERecordType Type, const FString& Key, const TArray<uint8>& Value, TArray<uint8>& OutRecord, int32& OutValueOffset);
+
+	TMap<FString /*FileName*/, FStorageFile> StorageFiles;
+	FCriticalSection StorageLock;
 };
 
 }
@@ -10,6 +10,9 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 #include <unordered_map>
+#include <type_traits>
+
+#include "Async/Async.h"
 
 #include "Models/AccelByteLobbyModels.h"
 #include "Models/AccelByteErrorModels.h"
@@ -438,18 +441,19 @@ namespace AccelByte
 
 	ACCELBYTEUE4SDK_API void HandleHttpCreateMatchmakingTicketError(FHttpRequestPtr Request, FHttpResponsePtr Response, int& OutCode, FString& OutMessage, FErrorCreateMatchmakingTicketV2& OutErrorCreateMatchmakingV2);
 
-	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const FVoidHandler& OnSuccess)
+	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, const FVoidHandler& OnSuccess)
 	{
 		OnSuccess.ExecuteIfBound();
 		return true;
 	}
 
 	template<typename T>
-	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<TArray<T>>& OnSuccess)
+	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<TArray<T>>& OnSuccess)
 	{
-		FString String = Response == nullptr ? FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true) : Response->GetContentAsString();
 		TArray<T> Result;
-		bool bSuccess = FAccelByteJsonConverter::JsonArrayStringToUStruct(String, &Result);
+		bool bSuccess = Response == nullptr
+			? FAccelByteJsonConverter::JsonArrayStringToUStruct(FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true), &Result)
+			: FAccelByteJsonConverter::JsonArrayBytesToUStruct(Response->GetContent(), &Result);
 		if (bSuccess)
 		{
 			OnSuccess.ExecuteIfBound(Result);
@@ -459,20 +463,19 @@ namespace AccelByte
 	}
 
 	template<>
-	inline bool HandleHttpResultOk<uint8>(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<TArray<uint8>>& OnSuccess)
+	inline bool HandleHttpResultOk<uint8>(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<TArray<uint8>>& OnSuccess)
 	{
-		TArray<uint8> Integers = Response == nullptr ? Payload : Response->GetContent();
-		OnSuccess.ExecuteIfBound(Integers);
+		OnSuccess.ExecuteIfBound(Response == nullptr ? Payload : Response->GetContent());
 		return true;
 	}
 
 	template<typename T>
-	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<T>& OnSuccess)
+	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<T>& OnSuccess)
 	{
-		FString String = Response == nullptr ? FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true) : Response->GetContentAsString();
-
 		typename std::remove_const<typename std::remove_reference<T>::type>::type Result;
-		bool bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(String, &Result);
+		bool bSuccess = Response == nullptr
+			? FAccelByteJsonConverter::JsonObjectStringToUStruct(FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true), &Result)
+			: FAccelByteJsonConverter::JsonObjectBytesToUStruct(Response->GetContent(), &Result);
 		if (bSuccess)
 		{
 			OnSuccess.ExecuteIfBound(Result);
@@ -481,14 +484,14 @@ namespace AccelByte
 	}
 
 	template<>
-	inline bool HandleHttpResultOk<FString>(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<FString>& OnSuccess)
+	inline bool HandleHttpResultOk<FString>(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<FString>& OnSuccess)
 	{
 		FString String = Response == nullptr ? FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true) : Response->GetContentAsString();
 		OnSuccess.ExecuteIfBound(String);
 		return true;
 	}
 
-	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess)
+	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<FAccelByteModelsPartyDataNotif>& OnSuccess)
 	{
 		// custom http result for LobbyServer.GetPartyStorage
 		FString jsonString = Response == nullptr ? FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true) : Response->GetContentAsString();
@@ -521,7 +524,7 @@ namespace AccelByte
 		return bSuccess;
 	}
 
-	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const THandler<FJsonObject>& OnSuccess)
+	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, const THandler<FJsonObject>& OnSuccess)
 	{
 		FString String = Response == nullptr ? FAccelByteArrayByteFStringConverter::BytesToFString(Payload, true) : Response->GetContentAsString();
 
@@ -535,6 +538,102 @@ namespace AccelByte
 		return bSuccess;
 	}
 
+	/**
+	 * @brief Size from which successful responses are deserialized on a worker thread, see [HTTP] AsyncParseThresholdBytes.
+	 * Zero or less keeps every response on the completing thread.
+	 */
+	ACCELBYTEUE4SDK_API int32 GetHttpAsyncParseThresholdBytes();
+
+	/**
+	 * @brief Whether the result of a handler is a model deserialized from JSON, the only results parsed off the game thread.
+	 */
+	template<typename THandlerType>
+	struct TIsHttpResultParsedAsync : std::false_type {};
+
+	template<typename T>
+	struct TIsHttpResultParsedAsync<THandler<T>> : std::integral_constant<bool
+		, !std::is_same<T, FString>::value
+		&& !std::is_same<T, TArray<uint8>>::value
+		&& !std::is_same<T, FJsonObject>::value
+		&& !std::is_same<T, FAccelByteModelsPartyDataNotif>::value> {};
+
+	template<typename T>
+	inline bool ParseHttpResult(TArray<uint8> const& Utf8Json, TArray<T>& OutResult)
+	{
+		return FAccelByteJsonConverter::JsonArrayBytesToUStruct(Utf8Json, &OutResult);
+	}
+
+	template<typename T>
+	inline bool ParseHttpResult(TArray<uint8> const& Utf8Json, T& OutResult)
+	{
+		return FAccelByteJsonConverter::JsonObjectBytesToUStruct(Utf8Json, &OutResult);
+	}
+
+	template<typename THandlerType>
+	inline void DispatchHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, THandlerType const& OnSuccess, TFunction<void()> const& OnInvalid, std::false_type)
+	{
+		if (!HandleHttpResultOk(Response, Payload, OnSuccess) && OnInvalid)
+		{
+			OnInvalid();
+		}
+	}
+
+	template<typename T>
+	inline void DispatchHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, THandler<T> const& OnSuccess, TFunction<void()> const& OnInvalid, std::true_type)
+	{
+		const int32 Size = Response.IsValid() ? Response->GetContent().Num() : Payload.Num();
+		const int32 Threshold = GetHttpAsyncParseThresholdBytes();
+		if (Threshold <= 0 || Size < Threshold || !IsInGameThread())
+		{
+			DispatchHttpResultOk(Response, Payload, OnSuccess, OnInvalid, std::false_type{});
+			return;
+		}
+
+		// The response owns its content, only a cached payload has to be copied for the worker
+		TArray<uint8> CachedPayload;
+		if (!Response.IsValid())
+		{
+			CachedPayload = Payload;
+		}
+
+		using FResultType = typename std::remove_const<typename std::remove_reference<T>::type>::type;
+		Async(EAsyncExecution::ThreadPool, [Response, CachedPayload = MoveTemp(CachedPayload), OnSuccess, OnInvalid]()
+			{
+				TArray<uint8> const& Bytes = Response.IsValid() ? Response->GetContent() : CachedPayload;
+
+				TSharedRef<FResultType, ESPMode::ThreadSafe> Result = MakeShared<FResultType, ESPMode::ThreadSafe>();
+				const bool bSuccess = ParseHttpResult(Bytes, Result.Get());
+
+				AsyncTask(ENamedThreads::GameThread, [bSuccess, Result, OnSuccess, OnInvalid]()
+					{
+						if (bSuccess)
+						{
+							OnSuccess.ExecuteIfBound(Result.Get());
+						}
+						else if (OnInvalid)
+						{
+							OnInvalid();
+						}
+					});
+			});
+	}
+
+	/**
+	 * @brief Deliver a successful response to its handler.
+	 * Large JSON models are parsed on a worker thread and the handler is executed on the game thread afterwards,
+	 * everything else is handled immediately on the calling thread.
+	 *
+	 * @param Response The completed response, or nullptr when the payload comes from the HTTP cache.
+	 * @param Payload The cached payload, used only when Response is nullptr.
+	 * @param OnSuccess Handler receiving the result.
+	 * @param OnInvalid Called instead of OnSuccess when the payload cannot be parsed.
+	 */
+	template<typename THandlerType>
+	inline void DispatchHttpResultOk(FHttpResponsePtr Response, TArray<uint8> const& Payload, THandlerType const& OnSuccess, TFunction<void()> const& OnInvalid)
+	{
+		DispatchHttpResultOk(Response, Payload, OnSuccess, OnInvalid, TIsHttpResultParsedAsync<THandlerType>{});
+	}
+
 	template<typename T>
 	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr)
 	{
@@ -544,10 +643,10 @@ namespace AccelByte
 				ACCELBYTE_SERVICE_LOGGING_HTTP_RESPONSE(Request, Response, bFinished);
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
-					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
-					{
-						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response");
-					}
+					DispatchHttpResultOk(Response, TArray<uint8>(), OnSuccess, [OnError]()
+						{
+							OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response");
+						});
 					return;
 				}
 
@@ -563,8 +662,7 @@ namespace AccelByte
 					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
 					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
-						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
-						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
+						DispatchHttpResultOk(nullptr, Cache->SerializableRequestAndResponse.ResponsePayload, OnSuccess, nullptr);
 						return;
 					}
 				}
@@ -585,10 +683,10 @@ namespace AccelByte
 				ACCELBYTE_SERVICE_LOGGING_HTTP_RESPONSE(Request, Response, bFinished);
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
-					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
-					{
-						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response", FJsonObject{});
-					}
+					DispatchHttpResultOk(Response, TArray<uint8>(), OnSuccess, [OnError]()
+						{
+							OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response", FJsonObject{});
+						});
 					return;
 				}
 
@@ -604,8 +702,7 @@ namespace AccelByte
 					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
 					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
-						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
-						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
+						DispatchHttpResultOk(nullptr, Cache->SerializableRequestAndResponse.ResponsePayload, OnSuccess, nullptr);
 						return;
 					}
 				}
@@ -628,10 +725,10 @@ namespace AccelByte
 				FErrorOAuthInfo ErrorOauthInfo;
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
-					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
-					{
-						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), ErrorOauthInfo);
-					}
+					DispatchHttpResultOk(Response, TArray<uint8>(), OnSuccess, [OnError]()
+						{
+							OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), FErrorOAuthInfo{});
+						});
 					return;
 				}
 
@@ -647,8 +744,7 @@ namespace AccelByte
 					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
 					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
-						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
-						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
+						DispatchHttpResultOk(nullptr, Cache->SerializableRequestAndResponse.ResponsePayload, OnSuccess, nullptr);
 						return;
 					}
 				}
@@ -671,10 +767,10 @@ namespace AccelByte
 
 			if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 			{
-				if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
-				{
-					OnError.ExecuteIfBound({ TEXT("InvalidResponse"), TEXT("Invalid JSON response") });
-				}
+				DispatchHttpResultOk(Response, TArray<uint8>(), OnSuccess, [OnError]()
+					{
+						OnError.ExecuteIfBound({ TEXT("InvalidResponse"), TEXT("Invalid JSON response") });
+					});
 				return;
 			}
 
@@ -690,8 +786,7 @@ namespace AccelByte
 				FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
 				if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 				{ 
-					auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
-					HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
+					DispatchHttpResultOk(nullptr, Cache->SerializableRequestAndResponse.ResponsePayload, OnSuccess, nullptr);
 					return;
 				}
 			}
@@ -711,10 +806,10 @@ namespace AccelByte
 				FErrorCreateMatchmakingTicketV2 ErrorCreateMatchmakingV2Info;
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
-					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
-					{
-						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), ErrorCreateMatchmakingV2Info);
-					}
+					DispatchHttpResultOk(Response, TArray<uint8>(), OnSuccess, [OnError]()
+						{
+							OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), FErrorCreateMatchmakingTicketV2{});
+						});
 					return;
 				}
 
@@ -730,8 +825,7 @@ namespace AccelByte
 					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
 					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
-						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
-						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
+						DispatchHttpResultOk(nullptr, Cache->SerializableRequestAndResponse.ResponsePayload, OnSuccess, nullptr);
 						return;
 					}
 				}
@@ -0,0 +1,101 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteTask.h"
+#include "Interfaces/IHttpRequest.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteFileTransfer, Log, All);
+
+/**
+ * @brief Progress of a file transfer.
+ * TotalBytes is INDEX_NONE while the server has not told the size of the content yet.
+ */
+DECLARE_DELEGATE_TwoParams(FAccelByteTransferProgressDelegate, int64 /* BytesTransferred */, int64 /* TotalBytes */);
+
+namespace AccelByte
+{
+
+class FHttpRetryScheduler;
+
+/**
+ * @brief Downloads a content into a file, one ranged request at a time.
+ *
+ * Chunks are appended to a partial file next to the destination, so only one chunk is held in memory. A dropped
+ * connection resumes from the bytes already on disk, and so does a new download of the same URL into the same file.
+ * The URL and the validator of the content (its strong ETag, or else its Last-Modified date) are kept next to the
+ * partial file and sent as If-Range when resuming, so a content changed in between is received whole instead of
+ * being appended to stale bytes. The partial file replaces the destination once the whole content has been received.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteFileDownload : public TSharedFromThis<FAccelByteFileDownload, ESPMode::ThreadSafe>
+{
+public:
+	static constexpr int64 DefaultChunkBytes = 4 * 1024 * 1024;
+	static constexpr int32 DefaultMaxResumeAttempts = 3;
+
+	FAccelByteFileDownload(FHttpRetryScheduler& InScheduler
+		, FString const& InUrl
+		, FString const& InFilePath
+		, FAccelByteTransferProgressDelegate const& InOnProgress
+		, FVoidHandler const& InOnDownloaded
+		, FErrorHandler const& InOnError
+		, int64 InChunkBytes = DefaultChunkBytes
+		, int32 InMaxResumeAttempts = DefaultMaxResumeAttempts);
+
+	/**
+	 * @brief Start or resume the download.
+	 */
+	void Start();
+
+	/**
+	 * @brief Stop the download, keeping the partial file so it can be resumed later.
+	 */
+	void Cancel();
+
+	/**
+	 * @brief Path of the file holding the bytes received so far.
+	 */
+	static FString GetPartialFilePath(FString const& FilePath);
+
+	/**
+	 * @brief Path of the file holding the URL and the validator of the partial file.
+	 */
+	static FString GetValidatorFilePath(FString const& FilePath);
+
+private:
+	void RequestNextChunk();
+	void OnChunkCompleted(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+	bool WriteChunk(TArray<uint8> const& Content, bool bTruncate);
+	void Resume(FString const& Reason);
+	bool LoadValidator();
+	void SaveValidator(FHttpResponsePtr const& Response);
+	void DiscardPartialFile();
+	void Finish();
+	void Fail(int32 Code, FString const& Message);
+
+	FHttpRetryScheduler& Scheduler;
+	const FString Url;
+	const FString FilePath;
+	const FString PartialFilePath;
+	const FString ValidatorFilePath;
+	const FAccelByteTransferProgressDelegate OnProgress;
+	const FVoidHandler OnDownloaded;
+	const FErrorHandler OnError;
+	const int64 ChunkBytes;
+	const int32 MaxResumeAttempts;
+
+	FAccelByteTaskWPtr CurrentTask;
+	FString Validator;
+	int64 Offset = 0;
+	int64 TotalBytes = INDEX_NONE;
+	int32 ResumeAttempts = 0;
+	bool bCancelled = false;
+};
+
+typedef TSharedPtr<FAccelByteFileDownload, ESPMode::ThreadSafe> FAccelByteFileDownloadPtr;
+
+} // Namespace AccelByte
@@ -50,8 +50,6 @@ namespace AccelByte
 		protected:
 
 			static int MaxAgeCacheThreshold;
-			
-			static FName ConstructKey(const FHttpRequestPtr& Request);
 
 			enum class EHttpCacheFreshness : uint8
 			{
@@ -76,6 +74,14 @@ namespace AccelByte
 			*/
 			static bool IsResponseCacheable(const FHttpRequestPtr& CompletedRequest);
 
+			/**
+			 * @brief Key identifying a request by verb and URL, also used to coalesce identical in-flight requests
+			 *
+			 * @param Request - Request to identify
+			 * @return FName - Hashed key
+			*/
+			static FName ConstructKey(const FHttpRequestPtr& Request);
+
 		private:
 			/**
 			 * @brief Check whether the cached response is not stale nor invalid
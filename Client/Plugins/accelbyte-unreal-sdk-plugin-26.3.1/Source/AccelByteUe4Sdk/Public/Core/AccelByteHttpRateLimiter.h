@@ -0,0 +1,157 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include <atomic>
+#include "CoreMinimal.h"
+#include "Core/AccelByteTask.h"
+
+namespace AccelByte
+{
+
+enum class EAccelByteRateLimitPriority : uint8
+{
+	Low,
+	Normal,
+	High,
+	/** Never held back by the rate limit, e.g. token refresh. */
+	Critical
+};
+
+struct FAccelByteRateLimitPolicy
+{
+	/** Requests waiting on the same endpoint are sent in priority order, then in arrival order. */
+	EAccelByteRateLimitPriority Priority = EAccelByteRateLimitPriority::Normal;
+
+	/** How long a request may wait for the rate limit before it is cancelled, negative uses the configured default. */
+	float MaxWaitSeconds = -1.0f;
+};
+
+struct FAccelByteRateLimitEndpointStats
+{
+	/** Endpoint route, path segments that look like ids are replaced by {id}. */
+	FString Endpoint;
+	/** Requests currently waiting for a token. */
+	int32 QueueDepth = 0;
+	int32 PeakQueueDepth = 0;
+	/** Requests that had to wait for a token since startup. */
+	int32 TotalQueued = 0;
+	/** Requests cancelled because they waited longer than their policy allows. */
+	int32 TotalTimedOut = 0;
+};
+
+/**
+ * Per endpoint token bucket for outgoing HTTP requests.
+ * Requests over the limit are queued and sent as soon as a token frees up; they only fail once they waited too long.
+ * Token acquisition is lock-free and may happen on any thread; the queue is owned by the thread that calls Poll.
+ */
+class ACCELBYTEUE4SDK_API FHttpRateLimiter
+{
+public:
+	/**
+	 * Number of endpoint buckets. A bucket that went idle is handed to the next new endpoint,
+	 * endpoints only share a bucket by hash while every bucket they probe is busy.
+	 */
+	static constexpr int32 MaxBuckets = 1024;
+
+	/** Number of routes tracked by GetStats, the least recently queued idle route makes room for a new one. */
+	static constexpr int32 MaxStatsEndpoints = 256;
+
+	DECLARE_DELEGATE_OneParam(FOnTaskReleased, const FAccelByteTaskPtr& /*Task*/);
+
+	FHttpRateLimiter();
+
+	/**
+	 * @brief Set the sustained rate and burst size of every endpoint.
+	 */
+	void SetRate(uint32 RequestsPerSecond);
+
+	/**
+	 * @brief Try to take a token for the URL, otherwise queue the task until one is available.
+	 *
+	 * @param Task Task that has not been started yet
+	 * @param Url Request URL, the query string is ignored when picking the bucket
+	 * @param Time Current platform time in seconds
+	 * @return true if the task may be started right away, false if it was queued
+	 */
+	bool AcquireOrQueue(const FAccelByteTaskPtr& Task, const FString& Url, double Time);
+
+	/**
+	 * @brief Release queued tasks that got a token and expire the ones that waited too long.
+	 *
+	 * @return Time at which Poll needs to be called again, MAX_dbl if nothing is queued
+	 */
+	double Poll(double Time, const FOnTaskReleased& OnDispatch, const FOnTaskReleased& OnTimedOut);
+
+	bool HasIncoming() const { return !Incoming.IsEmpty(); }
+
+	/** Drop every queued task without notifying it, used on shutdown. */
+	void Empty();
+
+	/** Only valid on the thread that calls Poll. */
+	TArray<FAccelByteRateLimitEndpointStats> GetStats() const;
+
+	/** Policies may be changed at any time, requests read them from the thread that sends them. */
+	static void SetPolicy(const FString& UrlPattern, const FAccelByteRateLimitPolicy& Policy);
+	static bool RemovePolicy(const FString& UrlPattern);
+	static void SetDefaultMaxWaitSeconds(float Seconds);
+
+private:
+	struct FBucket
+	{
+		std::atomic<uint64> Key{0};
+		/** Theoretical arrival time of the next request in microseconds (GCRA). */
+		std::atomic<int64> Tat{0};
+		/** Queued requests, new requests queue behind them instead of taking a token first. */
+		std::atomic<int32> Waiting{0};
+	};
+
+	struct FQueuedTask
+	{
+		FAccelByteTaskPtr Task;
+		FString Endpoint;
+		EAccelByteRateLimitPriority Priority;
+		double Deadline;
+		uint64 Sequence;
+
+		bool operator<(const FQueuedTask& Other) const
+		{
+			return Priority != Other.Priority ? Priority > Other.Priority : Sequence < Other.Sequence;
+		}
+	};
+
+	struct FIncomingTask
+	{
+		FQueuedTask Queued;
+		int32 BucketIndex;
+	};
+
+	struct FRouteStats
+	{
+		FAccelByteRateLimitEndpointStats Stats;
+		double LastQueuedTime = 0.0;
+	};
+
+	int32 FindBucket(const FString& Endpoint, double Time);
+	static bool IsBucketIdle(const FBucket& Bucket, int64 NowMicroseconds);
+	bool TryAcquireToken(FBucket& Bucket, double Time, double& OutAvailableTime) const;
+	static FAccelByteRateLimitPolicy FindPolicy(const FString& Url);
+	FAccelByteRateLimitEndpointStats& FindOrAddStats(const FString& Endpoint, double Time);
+
+	TUniquePtr<FBucket[]> Buckets;
+	std::atomic<int64> IntervalMicroseconds{0};
+	std::atomic<int64> BurstMicroseconds{0};
+	std::atomic<uint64> NextSequence{0};
+
+	TQueue<FIncomingTask, EQueueMode::Mpsc> Incoming;
+	TMap<int32 /*BucketIndex*/, TArray<FQueuedTask>> Queues;
+	TMap<FString /*Route*/, FRouteStats> Stats;
+
+	static FRWLock PoliciesLock;
+	static TArray<TPair<FString, FAccelByteRateLimitPolicy>> Policies;
+	static float DefaultMaxWaitSeconds;
+};
+
+}
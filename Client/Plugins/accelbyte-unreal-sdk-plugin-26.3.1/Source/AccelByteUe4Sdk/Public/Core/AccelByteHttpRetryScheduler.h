@@ -9,6 +9,7 @@
 #include "HttpManager.h"
 #include "Core/AccelByteTask.h"
 #include "Core/AccelByteHttpCache.h"
+#include "Core/AccelByteHttpRateLimiter.h"
 #include "Core/AccelByteDefines.h"
 #include "Dom/JsonObject.h"
 
@@ -16,6 +17,16 @@ DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetry, Log, All);
 
 namespace AccelByte
 {
+struct FAccelByteHttpCoalescingStats
+{
+	/** GET requests currently on the wire that others can be coalesced into. */
+	int32 InFlightRequests = 0;
+	/** Requests that shared another request's network call instead of sending their own. */
+	int32 CoalescedRequests = 0;
+	/** Network calls whose response was handed to more than one caller. */
+	int32 SharedResponses = 0;
+};
+
 class ACCELBYTEUE4SDK_API FHttpRetryScheduler
 {
 public:
@@ -40,11 +51,21 @@ public:
 	static int TotalTimeout;
 	static int PauseTimeout;
 	static constexpr uint32 DefaultRateLimit = 6;
+	static constexpr float DefaultRateLimitMaxWaitSeconds = 5.0f;
+	/** Longest a task goes without a tick, in case its completion or a cancellation through its token is never signalled. */
+	static constexpr double MaxRunningTickInterval = 1.0;
 
 	FHttpRetryScheduler();
 	virtual ~FHttpRetryScheduler();
 
 	void InitializeRateLimit();
+	void InitializeRequestCoalescing();
+
+	/**
+	 * @brief Read [HTTP] bSharedPollingTicker, when set the scheduler is polled by a single ticker shared with every
+	 * other scheduler in the same mode instead of registering its own. Only taken into account by Startup.
+	 */
+	void InitializeSharedPolling();
 
 	FAccelByteTaskPtr ProcessRequest(FHttpRequestPtr Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime);
 
@@ -57,11 +78,44 @@ public:
 
 	virtual void Startup();
 	virtual void Shutdown();
+
+	/**
+	 * @brief Tick every task whose deadline has passed or whose request just completed.
+	 * Cheap when nothing is due, so it is called every frame instead of on a fixed interval.
+	 *
+	 * @param Time Current platform time in seconds
+	 * @return true if any task was ticked
+	 */
 	bool PollRetry(double Time);
 
+	/**
+	 * @brief Earliest time a queued task needs to be ticked, or MAX_dbl if there is none.
+	 */
+	double GetNextPollTime() const { return NextPollTime; }
+
+	/**
+	 * @brief Number of schedulers currently polled by the shared ticker.
+	 */
+	static int32 GetSharedPollingSchedulerCount();
+
 	static void SetHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode, const FHttpResponseCodeHandler& Handler);
 	static bool RemoveHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode);
 
+	/**
+	 * @brief Set the priority and maximum wait of requests whose URL contains the pattern, when the endpoint is over its rate limit.
+	 * Should be set before requests are sent, the first matching pattern wins.
+	 *
+	 * @param UrlPattern Part of the URL, e.g. "/iam/v3/oauth/token"
+	 * @param Policy Priority and maximum wait, Critical requests are never held back
+	 */
+	static void SetRateLimitPolicy(const FString& UrlPattern, const FAccelByteRateLimitPolicy& Policy);
+	static bool RemoveRateLimitPolicy(const FString& UrlPattern);
+
+	/**
+	 * @brief Queue depth and timeouts of every endpoint that hit its rate limit, only valid on the polling thread.
+	 */
+	TArray<FAccelByteRateLimitEndpointStats> GetRateLimitStats() const { return RateLimiter.GetStats(); }
+
 	static void SetHeaderNamespace(const FString& Value) { HeaderNamespace = Value; }
 	static void SetHeaderSDKVersion(const FString& Value) { HeaderSDKVersion = Value; }
 	static void SetHeaderOSSVersion(const FString& Value) { HeaderOSSVersion = Value; }
@@ -69,15 +123,86 @@ public:
 
 	Core::FAccelByteHttpCache& GetHttpCache() { return HttpCache; }
 
+	/**
+	 * @brief Counters of identical GET requests that shared a single network call.
+	 */
+	FAccelByteHttpCoalescingStats GetCoalescingStats() const;
+
 protected:
 
 	FString ParseUStructToJsonString(const TSharedPtr<FJsonObject>& JsonObject, bool bOmitBlankValues = false);
 
 	static TMap<EHttpResponseCodes::Type, FHttpResponseCodeHandler> ResponseCodeDelegates;
-	TMap<FString /*Endpoint*/, FRequestBucket> RequestsBucket;
-	mutable FCriticalSection RequestBucketLock;
+	struct FInFlightRequest
+	{
+		FAccelByteTaskPtr Leader;
+		/** Requests are only coalesced for the same caller, responses may be user specific. */
+		FString Authorization;
+		TArray<FAccelByteTaskPtr> Followers;
+	};
+
+	bool TryCoalesceRequest(const FAccelByteTaskPtr& Task, const FHttpRequestPtr& Request);
+	void CompleteCoalescedRequests(const FAccelByteTaskPtr& Task);
+
+	/** Idempotent requests on the wire, keyed like the HTTP cache. */
+	TMap<FName, FInFlightRequest> InFlightRequests;
+	mutable FCriticalSection InFlightRequestsLock;
+	FAccelByteHttpCoalescingStats CoalescingStats{};
+	bool bEnableRequestCoalescing{true};
+
+	FHttpRateLimiter RateLimiter{};
+	/** Next time a rate limited task can be released or times out. */
+	double RateLimiterPollTime{MAX_dbl};
+
+	struct FScheduledTask
+	{
+		double Time;
+		FAccelByteTaskPtr Task;
+
+		bool operator<(const FScheduledTask& Other) const { return Time < Other.Time; }
+	};
+
+	typedef TQueue<FAccelByteTaskWPtr, EQueueMode::Mpsc> FReadyTaskQueue;
+
+	void ScheduleTask(const FAccelByteTaskPtr& Task, double Time);
+	void DrainIncomingTasks();
+	void RescheduleAll();
+	void StartTask(const FAccelByteTaskPtr& Task);
+	void PollRateLimiter(double Time);
+	void UpdateNextPollTime();
+	void StartPolling();
+	void StopPolling();
+
+	/** Poll every scheduler registered for shared polling, starting from a different one each time so none is always last. */
+	static bool PollSharedSchedulers(float DeltaTime);
+
+	/**
+	 * Handle of a scheduler in shared polling. The shared ticker polls a scheduler under the lock of its own entry,
+	 * so leaving shared polling only waits for the poll of that scheduler.
+	 */
+	struct FSharedPollingEntry
+	{
+		FCriticalSection Lock;
+		/** Cleared under Lock when the scheduler leaves shared polling. */
+		FHttpRetryScheduler* Scheduler = nullptr;
+	};
+	typedef TSharedPtr<FSharedPollingEntry, ESPMode::ThreadSafe> FSharedPollingEntryPtr;
+
+	bool bSharedPolling{false};
+	FSharedPollingEntryPtr SharedPollingEntry;
+	/** Only guards the list of entries and the ticker handle, never held while a scheduler is polled. */
+	static FCriticalSection SharedPollingLock;
+	static TArray<FSharedPollingEntryPtr> SharedPollingSchedulers;
+	static int32 SharedPollingCursor;
+	static FDelegateHandleAlias SharedPollingHandle;
 
+	/** Newly added tasks, may be filled from any thread. */
 	TQueue<FAccelByteTaskPtr, EQueueMode::Mpsc> TaskQueue{};
+	/** Min-heap of tasks ordered by the time they need their next tick, only touched by the polling thread. */
+	TArray<FScheduledTask> ScheduledTasks{};
+	/** Tasks whose request completed and need a tick right away, filled from HTTP completion callbacks. */
+	TSharedRef<FReadyTaskQueue, ESPMode::ThreadSafe> ReadyTasks{MakeShared<FReadyTaskQueue, ESPMode::ThreadSafe>()};
+	double NextPollTime{MAX_dbl};
 	FDelegateHandleAlias PollRetryHandle{};
 
 	Core::FAccelByteHttpCache HttpCache{};
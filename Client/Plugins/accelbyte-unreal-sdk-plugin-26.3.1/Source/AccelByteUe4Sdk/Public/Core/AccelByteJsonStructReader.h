@@ -0,0 +1,59 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/**
+ * @brief Reads JSON text straight into UStruct properties, without building an FJsonObject first.
+ *
+ * Only the cases the DOM based FJsonObjectConverter handles identically are read here: strings, names, texts,
+ * booleans, numbers, enums, ISO 8601 FDateTime strings, FJsonObjectWrapper objects, nested objects and arrays of
+ * those. Null values leave the property as it was, like the DOM converter. Anything else (maps, sets, object
+ * references, other structs imported from strings, unknown enum values...) reports Unsupported and the caller is
+ * expected to use the DOM path instead.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteJsonStructReader
+{
+public:
+	enum class EResult : uint8
+	{
+		Success,
+		Unsupported,
+		Malformed
+	};
+
+	/**
+	 * @brief Read a JSON object into a struct.
+	 *
+	 * @param Json JSON text.
+	 * @param Length Number of characters of the JSON text.
+	 * @param Definition Struct type of OutStruct.
+	 * @param OutStruct Struct to fill, properties absent from the JSON are left untouched. It is partly written when
+	 * the result is not Success.
+	 */
+	static EResult ReadObject(const TCHAR* Json, int32 Length, const UStruct* Definition, void* OutStruct);
+
+	/**
+	 * @brief Read a UTF-8 encoded JSON object into a struct.
+	 */
+	static EResult ReadObject(const ANSICHAR* Utf8Json, int32 Length, const UStruct* Definition, void* OutStruct);
+
+	/**
+	 * @brief Read a JSON array of objects.
+	 *
+	 * @param Json JSON text.
+	 * @param Length Number of characters of the JSON text.
+	 * @param ElementDefinition Struct type of the elements.
+	 * @param AddElement Appends a default constructed element to the output and returns it.
+	 */
+	static EResult ReadArray(const TCHAR* Json, int32 Length, const UStruct* ElementDefinition, TFunctionRef<void*()> AddElement);
+
+	/**
+	 * @brief Read a UTF-8 encoded JSON array of objects.
+	 */
+	static EResult ReadArray(const ANSICHAR* Utf8Json, int32 Length, const UStruct* ElementDefinition, TFunctionRef<void*()> AddElement);
+};
@@ -8,6 +8,8 @@
 #include "Containers/List.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/ScopeLock.h"
+#include "Models/AccelByteGeneralModels.h"
 
 namespace AccelByte
 {
@@ -31,36 +33,35 @@ protected:
 
 	bool bIsInitialized = false;
 
-	TArray<FAccelByteCacheWrapper<T>> ChunkArray;
-	TDoubleLinkedList<FAccelByteCacheWrapper<T>> ChunkDll;
+	typedef TDoubleLinkedList<FAccelByteCacheWrapper<T>> FChunkList;
+	typedef typename FChunkList::TDoubleLinkedListNode FChunkNode;
+
+	/** Recency order of the stored chunks, head is the most recently used. */
+	FChunkList ChunkDll;
+
+	/** Node of each stored key, so lookup, reordering and removal never walk the list. */
+	TMap<FName, FChunkNode*> ChunkIndex;
+
+	/** Sum of the Length of every stored chunk. */
+	size_t CurrentSizeBytes = 0;
 
 #pragma region DOUBLE_LINKED_LIST
 public:
-	typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLGetTail() { return ChunkDll.GetTail(); }
-	typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLGetHead() { return ChunkDll.GetHead(); }
+	FChunkNode* DLLGetTail() { return ChunkDll.GetTail(); }
+	FChunkNode* DLLGetHead() { return ChunkDll.GetHead(); }
 private:
 	void DLLSetEmpty() { ChunkDll.Empty(); }
-	int DLLGetSize() { return ChunkDll.Num(); }
-	void DLLAddHead(FAccelByteCacheWrapper<T> NewHead) { ChunkDll.AddHead(NewHead); }
-	void DLLRemoveNode(typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* Removed) { ChunkDll.RemoveNode(Removed); }
-	void DLLRemoveNode(typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* Removed, bool bDeleteNode) { ChunkDll.RemoveNode(Removed, bDeleteNode); }
-#pragma endregion
-
-#pragma region ARRAY_CONTAINER
-protected:
-	int ArrayGetNum() { return ChunkArray.Num(); }
-	FAccelByteCacheWrapper<T>& ArrayGetIndex(int Index) { return ChunkArray[Index]; }
-private:
-	void ArraySetEmpty() { ChunkArray.Empty(); }
-	void ArrayRemoveAt(int Index) { ChunkArray.RemoveAt(Index); }
-	void ArrayAdd(const FAccelByteCacheWrapper<T>* Entry)
+	void DLLAddHead(const FAccelByteCacheWrapper<T>& NewHead) { ChunkDll.AddHead(NewHead); }
+	void DLLMoveToHead(FChunkNode* Node)
 	{
-		if (Entry == nullptr)
+		if (Node == ChunkDll.GetHead())
 		{
 			return;
 		}
-		ChunkArray.Add(*Entry);
-	};
+		ChunkDll.RemoveNode(Node, false);
+		ChunkDll.AddHead(Node);
+	}
+	void DLLRemoveNode(FChunkNode* Removed) { ChunkDll.RemoveNode(Removed, true); }
 #pragma endregion
 
 /**
@@ -100,7 +101,32 @@ protected:
 * @brief Public function and accessed by HttpCache
 */
 public:
-	virtual ~FAccelByteLRUCache() {}
+	typedef T ValueType;
+
+	virtual ~FAccelByteLRUCache()
+	{
+		ChunkIndex.Empty();
+		DLLSetEmpty();
+	}
+
+	/**
+	* @brief Limit the total Length and the number of stored items, least recently used items are evicted first.
+	* Items that are already stored are evicted on the next insertion.
+	*
+	* @param MaxSizeBytes Upper bound of the sum of every item Length
+	* @param MaxCount Upper bound of the number of items
+	*/
+	virtual void SetCapacity(size_t MaxSizeBytes, int32 MaxCount)
+	{
+		MAX_HTTP_LRU_CACHE_SIZE = MaxSizeBytes;
+		MAX_HTTP_LRU_CACHE_COUNT = MaxCount;
+	}
+
+	inline size_t GetMaxSizeBytes() const { return MAX_HTTP_LRU_CACHE_SIZE; }
+	inline int32 GetMaxCount() const { return MAX_HTTP_LRU_CACHE_COUNT; }
+
+	inline int32 Num() const { return ChunkIndex.Num(); }
+	inline size_t GetCurrentSizeBytes() const { return CurrentSizeBytes; }
 
 	/**
 	* @brief Check if the LRU class stores an item with specified key
@@ -108,9 +134,9 @@ public:
 	* @param Key Identifier of the data
 	* @return True if the key is found
 	*/
-	inline bool Contains(const FName& Key)
+	inline bool Contains(const FName& Key) const
 	{
-		return FindIndex(Key) >= 0;
+		return ChunkIndex.Contains(Key);
 	}
 
 	/**
@@ -120,8 +146,9 @@ public:
 	{
 		this->bIsInitialized = false;
 		FreeCache();
-		ArraySetEmpty();
+		ChunkIndex.Empty();
 		DLLSetEmpty();
+		CurrentSizeBytes = 0;
 	}
 
 	/**
@@ -133,17 +160,18 @@ public:
 	*/
 	inline bool Remove(const FName& Key)
 	{
-		int Index = FindIndex(Key);
-		auto* Node = DLLFindNode(Key);
-
-		if (Index >= 0 && Node != nullptr)
+		FChunkNode* const* NodePtr = ChunkIndex.Find(Key);
+		if (NodePtr == nullptr || *NodePtr == nullptr)
 		{
-			RemoveCache(Key);
-			ArrayRemoveAt(Index);
-			DLLRemoveNode(Node, true);
-			return true;
+			return false;
 		}
-		return false;
+		FChunkNode* Node = *NodePtr;
+
+		RemoveCache(Key);
+		ChunkIndex.Remove(Key);
+		CurrentSizeBytes -= FMath::Min(CurrentSizeBytes, Node->GetValue().Length);
+		DLLRemoveNode(Node);
+		return true;
 	}
 
 	/**
@@ -157,6 +185,11 @@ public:
 		//// Check and remove an existing key that will be overwritten
 		Remove(Key);
 
+		if (EvictBeforeInsertion(Item) == false)
+		{
+			return false;
+		}
+
 		if (FreeCacheBeforeInsertion(Item) == false)
 		{
 			return false;
@@ -168,8 +201,9 @@ public:
 		{
 			return false;
 		}
-		ArrayAdd(Result);
 		DLLAddHead(*Result);
+		ChunkIndex.Add(Key, DLLGetHead());
+		CurrentSizeBytes += Result->Length;
 		return true;
 	}
 
@@ -183,20 +217,15 @@ public:
 	*/
 	inline TSharedPtr<T> Find(const FName& Key, bool bPeekOnly = false)
 	{
-		int Index = FindIndex(Key);
-		if (Index < 0) { return nullptr; }
+		FChunkNode* const* Node = ChunkIndex.Find(Key);
+		if (Node == nullptr || *Node == nullptr) { return nullptr; }
 
 		if (!bPeekOnly)
 		{
-			auto* Node = DLLFindNode(Key);
-			if (Node == nullptr) { return nullptr; }
-
-			// Swap the position
-			DLLRemoveNode(Node);
-			DLLAddHead(ArrayGetIndex(Index));
+			DLLMoveToHead(*Node);
 		}
 
-		return GetTheValueFromChunkArray(Index);
+		return GetTheValueFromChunk((*Node)->GetValue());
 	}
 
 	inline TSharedPtr<T> operator[](const FName& Key)
@@ -205,7 +234,7 @@ public:
 	}
 
 	//LRUCacheFile should override this function
-	virtual inline TSharedPtr<T> GetTheValueFromChunkArray(int Index){ return ArrayGetIndex(Index).Data; }
+	virtual inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& Chunk) { return Chunk.Data; }
 
 	/**
 	* @brief Check the value only, does not affect the order of the linked list
@@ -218,45 +247,51 @@ public:
 protected:
 
 	/**
-	* @brief Find the index of the ChunkArray based on the storage Key
+	* @brief Find the stored chunk based on the storage Key
 	*
 	* @param Key Identifier of the data
-	* @return Index number if it exists, otherwise return -1.
+	* @return Pointer to the chunk if it exists, otherwise return nullptr.
 	*/
-	inline int FindIndex(const FName& Key)
+	inline FAccelByteCacheWrapper<T>* FindChunk(const FName& Key)
 	{
-		int Num = ArrayGetNum();
-		for (int i = 0; i < Num; i++)
+		FChunkNode* const* Node = ChunkIndex.Find(Key);
+		return (Node != nullptr && *Node != nullptr) ? &(*Node)->GetValue() : nullptr;
+	}
+
+	/**
+	* @brief Put back a chunk that is already stored, e.g. loaded from a persistent index, as the most recently used
+	*/
+	inline void RestoreChunk(const FAccelByteCacheWrapper<T>& Chunk)
+	{
+		if (ChunkIndex.Contains(Chunk.Key))
 		{
-			if (ArrayGetIndex(i).Key.IsEqual(Key, ENameCase::CaseSensitive, true))
-			{
-				return i;
-			}
+			return;
 		}
-		return -1;
+		DLLAddHead(Chunk);
+		ChunkIndex.Add(Chunk.Key, DLLGetHead());
+		CurrentSizeBytes += Chunk.Length;
 	}
 
 	/**
-	* @brief Find the pointer of the ChunkDLL's node based on the storage Key
+	* @brief Evict the least recently used items until the new item fits in MAX_HTTP_LRU_CACHE_SIZE and MAX_HTTP_LRU_CACHE_COUNT
 	*
-	* @param Key Identifier of the data
-	* @return Pointer to node if it exists, otherwise return nullptr.
+	* @return False if the item is bigger than the whole cache
 	*/
-	virtual inline typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLFindNode(const FName& Key)
+	inline bool EvictBeforeInsertion(T& Item)
 	{
-		auto* Node = DLLGetHead();
-
-		while (Node != nullptr)
+		const size_t Required = GetRequiredSize(Item);
+		if (Required > MAX_HTTP_LRU_CACHE_SIZE || MAX_HTTP_LRU_CACHE_COUNT <= 0)
 		{
-			if (Node->GetValue().Key == Key)
-			{
-				break;
-			}
-
-			Node = Node->GetNextNode();
+			return false;
 		}
 
-		return Node;
+		FChunkNode* Tail = DLLGetTail();
+		while (Tail != nullptr && (CurrentSizeBytes + Required > MAX_HTTP_LRU_CACHE_SIZE || Num() >= MAX_HTTP_LRU_CACHE_COUNT))
+		{
+			Remove(Tail->GetValue().Key);
+			Tail = DLLGetTail();
+		}
+		return true;
 	}
 
 public:
@@ -265,6 +300,84 @@ public:
 	inline static const size_t GetRequiredSize(T* Data) { return GetRequiredSize(*Data); }
 };
 
+/**
+ * Splits the keys over several independent caches, each behind its own lock, so threads working on different keys don't contend.
+ * TCache is one of the FAccelByteLRUCache implementations, capacity is divided evenly between the shards.
+ */
+template <typename TCache, int32 NumShards = 8>
+class FAccelByteShardedLRUCache
+{
+public:
+	typedef typename TCache::ValueType T;
+
+	static_assert(NumShards > 0, "FAccelByteShardedLRUCache needs at least one shard");
+
+	inline void SetCapacity(size_t MaxSizeBytes, int32 MaxCount)
+	{
+		for (int32 i = 0; i < NumShards; i++)
+		{
+			FScopeLock Lock(&Locks[i]);
+			Shards[i].SetCapacity(MaxSizeBytes / NumShards, FMath::DivideAndRoundUp(MaxCount, NumShards));
+		}
+	}
+
+	inline bool Contains(const FName& Key)
+	{
+		const int32 Index = GetShardIndex(Key);
+		FScopeLock Lock(&Locks[Index]);
+		return Shards[Index].Contains(Key);
+	}
+
+	inline bool Emplace(const FName& Key, T& Item)
+	{
+		const int32 Index = GetShardIndex(Key);
+		FScopeLock Lock(&Locks[Index]);
+		return Shards[Index].Emplace(Key, Item);
+	}
+
+	inline TSharedPtr<T> Find(const FName& Key, bool bPeekOnly = false)
+	{
+		const int32 Index = GetShardIndex(Key);
+		FScopeLock Lock(&Locks[Index]);
+		return Shards[Index].Find(Key, bPeekOnly);
+	}
+
+	inline TSharedPtr<T> Peek(const FName& Key) { return Find(Key, true); }
+
+	inline bool Remove(const FName& Key)
+	{
+		const int32 Index = GetShardIndex(Key);
+		FScopeLock Lock(&Locks[Index]);
+		return Shards[Index].Remove(Key);
+	}
+
+	inline void Empty()
+	{
+		for (int32 i = 0; i < NumShards; i++)
+		{
+			FScopeLock Lock(&Locks[i]);
+			Shards[i].Empty();
+		}
+	}
+
+	inline int32 Num()
+	{
+		int32 Result = 0;
+		for (int32 i = 0; i < NumShards; i++)
+		{
+			FScopeLock Lock(&Locks[i]);
+			Result += Shards[i].Num();
+		}
+		return Result;
+	}
+
+private:
+	inline static int32 GetShardIndex(const FName& Key) { return GetTypeHash(Key) % NumShards; }
+
+	TCache Shards[NumShards];
+	FCriticalSection Locks[NumShards];
+};
+
 // Override specific for HTTP response size
 template<>
 inline const size_t FAccelByteLRUCache<FHttpRequestPtr>::GetRequiredSize(FHttpRequestPtr& Data)
@@ -279,6 +392,25 @@ inline const size_t FAccelByteLRUCache<FHttpRequestPtr>::GetRequiredSize(FHttpRe
 	return Output;
 }
 
+// Override specific for HTTP cache item, the serialized payload is what a cache loaded from storage holds
+template<>
+inline const size_t FAccelByteLRUCache<FAccelByteHttpCacheItem>::GetRequiredSize(FAccelByteHttpCacheItem& Data)
+{
+	size_t Output = sizeof(FAccelByteHttpCacheItem);
+
+	if (Data.Request.IsValid())
+	{
+		Output += Data.Request->GetURL().Len() * sizeof(TCHAR);
+		Output += Data.Request->GetContentLength();
+		if (Data.Request->GetResponse().IsValid())
+		{
+			Output += Data.Request->GetResponse()->GetContentLength();
+		}
+	}
+	Output += Data.SerializableRequestAndResponse.ResponsePayload.Num();
+	return Output;
+}
+
 // Override specific for FString size
 template<>
 inline const size_t FAccelByteLRUCache<FString>::GetRequiredSize(FString& Data)
@@ -13,28 +13,133 @@
 #include "Models/AccelByteGeneralModels.h"
 #include "HAL/FileManager.h"
 #include "HAL/FileManagerGeneric.h"
+#include "Async/Future.h"
 
 namespace AccelByte
 {
 namespace Core
 {
 
+struct FAccelByteCacheFileIndexEntry
+{
+	FString Key{};
+	int32 Segment = 0;
+	int64 Offset = 0;
+	int32 Size = 0;
+	/** UTC expiry of the stored item, FDateTime(0) if it never expires. */
+	FDateTime ExpiresAt{0};
+	FString ETag{};
+	/** Higher is more recently used. */
+	uint64 LastAccess = 0;
+};
+
+/**
+ * Persistent key value store for the LRU file cache.
+ * Items are appended to segment files and located through a single index file that is loaded at startup, so there is no directory scan.
+ * Overwritten and removed items leave dead bytes behind, segments that are mostly dead are compacted on a background thread.
+ * Thread safe.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteCacheFileStore
+{
+public:
+	/** A segment is closed and a new one started once it grows past this size. */
+	static constexpr int64 MaxSegmentBytes = 4 * 1024 * 1024;
+	/**
+	 * The index file is rewritten after this many items are written or removed, and always on destruction.
+	 * Reads only update the recency order, which is persisted along with the next rewrite.
+	 */
+	static constexpr int32 IndexFlushThreshold = 16;
+
+	/**
+	 * @param InDirectory Absolute directory of the cache files
+	 * @param InPrefix Prefix of every file of this store
+	 */
+	FAccelByteCacheFileStore(const FString& InDirectory, const FString& InPrefix);
+	~FAccelByteCacheFileStore();
+
+	/**
+	 * @brief Load the index file, or remove leftovers of an older cache format if there is none.
+	 *
+	 * @return Every stored entry, least recently used first
+	 */
+	TArray<FAccelByteCacheFileIndexEntry> Load();
+
+	bool Write(const FString& Key, const TArray<uint8>& Bytes, const FDateTime& ExpiresAt, const FString& ETag);
+	bool Read(const FString& Key, TArray<uint8>& OutBytes, FAccelByteCacheFileIndexEntry& OutEntry);
+	void Touch(const FString& Key);
+	void Remove(const FString& Key);
+
+	/** Delete every segment and the index. */
+	void Clear();
+
+	/** Persist the index file if it has pending changes. */
+	void Flush();
+
+private:
+	struct FSegment
+	{
+		int64 Size = 0;
+		int64 DeadBytes = 0;
+	};
+
+	FString GetIndexPath() const;
+	FString GetSegmentPath(int32 Segment) const;
+
+	bool AppendLocked(const FString& Key, const TArray<uint8>& Bytes, FAccelByteCacheFileIndexEntry& Entry);
+	bool ReadLocked(const FAccelByteCacheFileIndexEntry& Entry, TArray<uint8>& OutBytes);
+	void RemoveLocked(const FString& Key);
+	void OpenNewSegmentLocked();
+	void MarkDirtyLocked();
+	void FlushLocked();
+	void RemoveLegacyFiles();
+
+	void ScheduleCompaction();
+	void WaitForCompaction();
+	void Compact(int32 Segment);
+
+	FString Directory;
+	FString Prefix;
+
+	TMap<FString, FAccelByteCacheFileIndexEntry> Index;
+	TMap<int32, FSegment> Segments;
+	int32 ActiveSegment = INDEX_NONE;
+	int32 NextSegment = 0;
+	TUniquePtr<IFileHandle> ActiveSegmentHandle;
+	uint64 AccessCounter = 0;
+	int32 PendingIndexChanges = 0;
+	/** Recency order changed since the index was written. */
+	bool bHasPendingAccess = false;
+
+	TFuture<void> Compaction;
+	bool bIsCompacting = false;
+	mutable FCriticalSection Lock;
+};
+
 template <typename T>
 class FAccelByteLRUCacheFile : public FAccelByteLRUCache<T> 
 {
 public:
 	const FString PREFIX_CACHE_NAME = TEXT("ACCELBYTE_LRU_CACHE");
 	const FString EXTENSION_CACHE_NAME = TEXT(".cache");
-	inline FAccelByteLRUCacheFile(){}
+	inline FAccelByteLRUCacheFile()
+	{
+		InitializeStorage();
+	}
 
 	inline FAccelByteLRUCacheFile(int32 MaxFileCount_, size_t MaxFileSizeBytes_)
 	{
 		MaxFileCount = MaxFileCount_;
 		MaxFileSizeBytes = MaxFileSizeBytes_;
-		FAccelByteLRUCacheFile();
+		InitializeStorage();
 	}
 
-	inline ~FAccelByteLRUCacheFile(){}
+	inline ~FAccelByteLRUCacheFile()
+	{
+		if (Store.IsValid())
+		{
+			Store->Flush();
+		}
+	}
 
 private:
 	int32 MaxFileCount = 100;
@@ -45,78 +150,50 @@ private:
 	
 	DataStorageBinaryFile DataStorage;
 
-	TArray<FAccelByteCacheWrapper<T>> DerivedChunkArray;
+	TUniquePtr<FAccelByteCacheFileStore> Store;
+
+	/** Chunk of the last insertion, copied by the base class right away. */
+	FAccelByteCacheWrapper<T> InsertedChunk;
 
 	/**
 	* @brief Initialize the Storage
+	* Entries stored by a previous run are restored from the index in their last LRU order, their content is read on first access.
 	*/
 	inline void InitializeStorage()
 	{
-		this->bIsInitialized = true;
-	}
+		FDirectoryPath Directory = DataStorage.GetAbsoluteFileDirectory();
+		Store = MakeUnique<FAccelByteCacheFileStore>(Directory.Path, PREFIX_CACHE_NAME);
 
-	FString ConvertKeyToFilename(FString Key)
-	{
-		FString FileName = TEXT("");
-		if (!Key.IsEmpty())
+		TArray<FAccelByteCacheFileIndexEntry> Entries = Store->Load();
+		for (const FAccelByteCacheFileIndexEntry& Entry : Entries)
 		{
-			Key = FGenericPlatformHttp::UrlEncode(Key);
-			FileName = PREFIX_CACHE_NAME + Key + EXTENSION_CACHE_NAME;
+			this->RestoreChunk(FAccelByteCacheWrapper<T>{ FName(*Entry.Key), nullptr, static_cast<size_t>(Entry.Size) });
+			CurrentFileCount += 1;
+			CurrentFileSizeBytes += Entry.Size;
 		}
-		return FileName;
-	}
 
-	FString CompleteFilenameToAbsolute(const FString& Filename)
-	{
-		FDirectoryPath Directory = DataStorage.GetAbsoluteFileDirectory();
-		return Directory.Path + Filename;
+		this->bIsInitialized = true;
 	}
 
-	FString ConvertKeyToFilename(const FName& Key) { return ConvertKeyToFilename(Key.ToString()); }
-
 	/**
-	* @brief Get All files from data storage binary class directory
-	* delete each file with specified prefix & suffix
+	* @brief Delete every segment and the index of the store
 	*/
 	inline void FreeCache() override 
 	{
-		FDirectoryPath Directory = DataStorage.GetAbsoluteFileDirectory();
-		FString AbsoluteDirPath = Directory.Path;
-		TArray<FString> Files;
-		IFileManager::Get().FindFiles(Files, *AbsoluteDirPath, *EXTENSION_CACHE_NAME);
-
-		for (int i = 0; i < Files.Num(); i++)
-		{
-			if (!Files[i].Contains(PREFIX_CACHE_NAME))
-			{
-				continue;
-			}
-			FString AbsFilePath = AbsoluteDirPath + Files[i];
-			IFileManager::Get().Delete(*AbsFilePath, true, true, true);
-		}
+		Store->Clear();
 
 		CurrentFileCount = 0;
 		CurrentFileSizeBytes = 0;
-		DerivedChunkArray.Empty();
 	}
 
 	inline void RemoveCache(const FName& Key) override
 	{
-		auto Filename = ConvertKeyToFilename(Key);
-		size_t CurrentSize = this->ArrayGetIndex(this->FindIndex(Key)).Length;
+		const FAccelByteCacheWrapper<T>* Chunk = this->FindChunk(Key);
+		size_t CurrentSize = Chunk != nullptr ? Chunk->Length : 0;
 		
-		IFileManager::Get().Delete(*Filename, true, true, true);
+		Store->Remove(Key.ToString());
 		CurrentFileCount -= 1;
-		CurrentFileSizeBytes -= CurrentSize;
-
-		for (int i = 0; i < DerivedChunkArray.Num(); i++)
-		{
-			if (DerivedChunkArray[i].Key == Key)
-			{
-				DerivedChunkArray.RemoveAt(i);
-			}
-		}
-
+		CurrentFileSizeBytes -= FMath::Min(CurrentFileSizeBytes, CurrentSize);
 	}
 
 	inline bool FreeCacheBeforeInsertion(T& Item) override
@@ -132,7 +209,7 @@ private:
 		}
 
 		auto Node = this->DLLGetTail();
-		while (Node != nullptr && (Required > Left || this->ArrayGetNum() >= MaxFileCount))
+		while (Node != nullptr && (Required > Left || this->Num() >= MaxFileCount))
 		{
 			size_t TailSize = Node->GetValue().Length;
 			this->Remove(this->DLLGetTail()->GetValue().Key);
@@ -141,7 +218,7 @@ private:
 		}
 
 		size_t ModifiedStorageSizeLeft = MaxFileSizeBytes - CurrentFileSizeBytes;
-		return (Required <= ModifiedStorageSizeLeft) && (this->ArrayGetNum() < MaxFileCount);
+		return (Required <= ModifiedStorageSizeLeft) && (this->Num() < MaxFileCount);
 	}
 
 	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FName& Key) override
@@ -150,9 +227,6 @@ private:
 		{
 			return nullptr;
 		}
-		
-		auto Size = FAccelByteLRUCache<T>::GetRequiredSize(Item);
-		FAccelByteCacheWrapper<T> Result{ Key, nullptr, Size};
 
 		TArray<uint8> ArrayByte = ToArrayByte(Item);
 		if (ArrayByte.Num() == 0)
@@ -160,15 +234,17 @@ private:
 			return nullptr;
 		}
 
-		auto AbsPath = CompleteFilenameToAbsolute(ConvertKeyToFilename(Key));
-		bool bIsSuccess = FFileHelper::SaveArrayToFile(ArrayByte, *AbsPath);
-		
-		if (!bIsSuccess) return nullptr;
-		int Index = DerivedChunkArray.Add(Result);
+		if (!Store->Write(Key.ToString(), ArrayByte, GetExpiresAt(Item), GetETag(Item)))
+		{
+			return nullptr;
+		}
+
+		// Stored size, so entries restored from the index account the same way
+		InsertedChunk = FAccelByteCacheWrapper<T>{ Key, nullptr, static_cast<size_t>(ArrayByte.Num()) };
 		CurrentFileCount += 1;
-		CurrentFileSizeBytes += Result.Length;
+		CurrentFileSizeBytes += InsertedChunk.Length;
 
-		return &DerivedChunkArray[Index];
+		return &InsertedChunk;
 	}
 
 	inline bool InsertPrerequisiteOkay() 
@@ -187,14 +263,24 @@ private:
 	inline const TArray<uint8> ToArrayByte(T& Item) { return TArray<uint8>(); }
 	inline TSharedPtr<T> FromFString(const FString& Content) { return nullptr; };
 
-	inline TSharedPtr<T> GetTheValueFromChunkArray(int Index) override
+	/** Expiry persisted in the index, items stored with platform time have to be converted. */
+	inline FDateTime GetExpiresAt(T& Item) { return FDateTime(0); }
+	inline FString GetETag(T& Item) { return TEXT(""); }
+	inline void RestoreExpiry(T& Item, const FDateTime& ExpiresAt) {}
+
+	inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& ChunkInfo) override
 	{
-		FAccelByteCacheWrapper<T>& ChunkInfo = this->ArrayGetIndex(Index);
 		FString Key = ChunkInfo.Key.ToString();
 
+		if (ChunkInfo.Data.IsValid())
+		{
+			Store->Touch(Key);
+			return ChunkInfo.Data;
+		}
+
 		TArray<uint8> ArrayByte;
-		auto AbsPath = CompleteFilenameToAbsolute(ConvertKeyToFilename(Key));
-		bool bIsOK = FFileHelper::LoadFileToArray(ArrayByte, *AbsPath);
+		FAccelByteCacheFileIndexEntry Entry;
+		bool bIsOK = Store->Read(Key, ArrayByte, Entry);
 		if (!bIsOK || ArrayByte.Num() == 0) return nullptr;
 
 		FString StringValue = FAccelByteArrayByteFStringConverter::BytesToFString(ArrayByte, false);
@@ -202,6 +288,7 @@ private:
 		TSharedPtr<T> Output = FromFString(StringValue);
 		if (Output.IsValid())
 		{
+			RestoreExpiry(*Output, Entry.ExpiresAt);
 			ChunkInfo.Data = Output;
 			return ChunkInfo.Data;
 		}
@@ -295,6 +382,32 @@ inline TSharedPtr<FAccelByteHttpCacheItem> FAccelByteLRUCacheFile<FAccelByteHttp
 
 	return Output;
 }
+
+template<>
+inline FDateTime FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>::GetExpiresAt(FAccelByteHttpCacheItem& CacheItem)
+{
+	return FDateTime::UtcNow() + FTimespan::FromSeconds(CacheItem.ExpireTime - FPlatformTime::Seconds());
+}
+
+template<>
+inline FString FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>::GetETag(FAccelByteHttpCacheItem& CacheItem)
+{
+	if (CacheItem.Request.IsValid() && CacheItem.Request->GetResponse().IsValid())
+	{
+		return CacheItem.Request->GetResponse()->GetHeader(TEXT("ETag"));
+	}
+	return TEXT("");
+}
+
+// Platform time does not survive a restart, the index keeps the expiry in UTC
+template<>
+inline void FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>::RestoreExpiry(FAccelByteHttpCacheItem& CacheItem, const FDateTime& ExpiresAt)
+{
+	if (ExpiresAt.GetTicks() > 0)
+	{
+		CacheItem.ExpireTime = FPlatformTime::Seconds() + (ExpiresAt - FDateTime::UtcNow()).GetTotalSeconds();
+	}
+}
 #pragma endregion
 
 }
@@ -34,6 +34,20 @@ public:
 		FreeCache();
 	}
 
+	/**
+	* @brief The Memory class enforces the same limits on its own, so it is resized along with the cache
+	*/
+	inline void SetCapacity(size_t MaxSizeBytes, int32 MaxCount) override
+	{
+		FAccelByteLRUCache<T>::SetCapacity(MaxSizeBytes, MaxCount);
+		MemoryParameter.PoolSize = MaxSizeBytes;
+		MemoryParameter.ChunkCount = MaxCount;
+		if (Memory != nullptr)
+		{
+			Memory->SetLimits(MaxSizeBytes, MaxCount);
+		}
+	}
+
 private:
 	/**
 	* @brief Initialize the Memory class
@@ -63,7 +77,7 @@ private:
 		auto Required = this->GetRequiredSize(Item);
 		size_t Left = Memory->GetMemoryPoolLeft();
 
-		bool bChunkCountIsSafe = this->ArrayGetNum() < MemoryParameter.ChunkCount;
+		bool bChunkCountIsSafe = this->Num() < MemoryParameter.ChunkCount;
 
 		if (Left >= Required && bChunkCountIsSafe)
 		{
@@ -71,7 +85,7 @@ private:
 		}
 
 		auto Node = this->DLLGetTail();
-		while (Node != nullptr && (Required > Left || this->ArrayGetNum() >= MemoryParameter.ChunkCount))
+		while (Node != nullptr && (Required > Left || this->Num() >= MemoryParameter.ChunkCount))
 		{
 			size_t TailSize = Node->GetValue().Length;
 			this->Remove(this->DLLGetTail()->GetValue().Key);
@@ -79,7 +93,7 @@ private:
 			Node = this->DLLGetTail();
 		}
 
-		return (this->GetRequiredSize(Item) <= Memory->GetMemoryPoolLeft()) && (this->ArrayGetNum() < MemoryParameter.ChunkCount);
+		return (this->GetRequiredSize(Item) <= Memory->GetMemoryPoolLeft()) && (this->Num() < MemoryParameter.ChunkCount);
 	}
 
 	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FName& Key) override
@@ -90,7 +104,7 @@ private:
 	}
 
 	TSharedPtr<FAccelByteMemory<T>> Memory;
-	MemoryConstructionParameter MemoryParameter = { MemoryMethod::Dynamic, this->MAX_HTTP_LRU_CACHE_SIZE, this->MAX_HTTP_LRU_CACHE_COUNT };
+	MemoryConstructionParameter MemoryParameter = { MemoryMethod::PoolAllocation, this->MAX_HTTP_LRU_CACHE_SIZE, this->MAX_HTTP_LRU_CACHE_COUNT };
 };
 }
 }
@@ -6,19 +6,68 @@
 
 #include "Models/AccelByteLobbyModels.h"
 #include "CoreMinimal.h"
+#include <atomic>
 
 DECLARE_LOG_CATEGORY_CLASS(LogAccelByteLockableQueue, Log, All);
 
+/**
+ * @brief What a bounded queue does with items enqueued past its capacity.
+ */
+enum class EAccelByteQueueOverflowPolicy : uint8
+{
+	/** Keep every item, the capacity is ignored. */
+	Grow,
+	/** Reject the incoming item. */
+	DropNewest,
+	/** Accept the incoming item, the consumer discards the oldest items over capacity before its next dequeue. */
+	DropOldest
+};
+
+/**
+ * @brief Multi-producer single-consumer queue whose consumer side can be paused with a key.
+ * Enqueue is lock-free and can be called from any thread, Dequeue must only be called from one thread.
+ */
 template<typename ItemType>
 class FAccelByteLockableQueue
 {
 public:
 	FAccelByteLockableQueue(){}
+
+	/**
+	 * @brief Bound the number of queued items, Grow (the default) leaves the queue unbounded.
+	 */
+	void SetOverflowPolicy(EAccelByteQueueOverflowPolicy InPolicy, int32 InCapacity)
+	{
+		Policy = InCapacity > 0 ? InPolicy : EAccelByteQueueOverflowPolicy::Grow;
+		Capacity = InCapacity;
+	}
 	
 	bool Enqueue(const ItemType& Item)
 	{
 		UE_LOG(LogAccelByteLockableQueue, VeryVerbose, TEXT("Item enqueued to lockable queue"));
-		return Queue.Enqueue(Item);
+
+		// Counted before the item is visible to the consumer, so Count never goes below zero
+		const int32 PreviousCount = Count.fetch_add(1);
+		if (Policy == EAccelByteQueueOverflowPolicy::DropNewest && PreviousCount >= Capacity)
+		{
+			Count--;
+			Dropped++;
+			UE_LOG(LogAccelByteLockableQueue, VeryVerbose, TEXT("Item dropped, lockable queue is full"));
+			return false;
+		}
+
+		if (!Queue.Enqueue(Item))
+		{
+			Count--;
+			return false;
+		}
+		Published++;
+
+		int32 HighWater = HighWaterMark.load();
+		while (PreviousCount + 1 > HighWater && !HighWaterMark.compare_exchange_weak(HighWater, PreviousCount + 1))
+		{
+		}
+		return true;
 	}
 
 	bool Dequeue(ItemType& Item)
@@ -29,8 +78,43 @@ public:
 			return false;
 		}
 
+		DropOverCapacity();
+
 		UE_LOG(LogAccelByteLockableQueue, VeryVerbose, TEXT("Item dequeued from lockable queue"));
-		return Queue.Dequeue(Item);
+		if (!Queue.Dequeue(Item))
+		{
+			return false;
+		}
+		Count--;
+		Taken++;
+		return true;
+	}
+
+	/**
+	 * @brief Move up to MaxItems queued items at the end of OutItems.
+	 *
+	 * @return Number of items dequeued.
+	 */
+	int32 DequeueBatch(TArray<ItemType>& OutItems, int32 MaxItems)
+	{
+		if(IsLocked())
+		{
+			UE_LOG(LogAccelByteLockableQueue, VeryVerbose, TEXT("Item dequeue failed, queue is locked"));
+			return 0;
+		}
+
+		DropOverCapacity();
+
+		int32 Dequeued = 0;
+		ItemType Item;
+		while (Dequeued < MaxItems && Queue.Dequeue(Item))
+		{
+			OutItems.Add(MoveTemp(Item));
+			Dequeued++;
+		}
+		Count -= Dequeued;
+		Taken += Dequeued;
+		return Dequeued;
 	}
 
 	bool IsEmpty() const
@@ -38,6 +122,30 @@ public:
 		return Queue.IsEmpty();
 	}
 
+	/**
+	 * @brief Number of items waiting in the queue, may be stale by the time it is read when other threads enqueue.
+	 */
+	int32 Num() const
+	{
+		return Count.load();
+	}
+
+	/**
+	 * @brief Highest number of items that waited in the queue at once.
+	 */
+	int32 GetHighWaterMark() const
+	{
+		return HighWaterMark.load();
+	}
+
+	/**
+	 * @brief Number of items discarded by the overflow policy.
+	 */
+	int64 GetDroppedCount() const
+	{
+		return Dropped.load();
+	}
+
 	TSharedPtr<FAccelByteKey> LockQueue()
 	{
 		TSharedPtr<FAccelByteKey> NewKey = Key.Pin();
@@ -59,8 +167,36 @@ public:
 
 private:
 
-	TQueue<ItemType> Queue;
+	void DropOverCapacity()
+	{
+		if (Policy != EAccelByteQueueOverflowPolicy::DropOldest)
+		{
+			return;
+		}
+
+		// Count also holds items still being enqueued, dropping down to it would take visible items in their place
+		int64 Available = Published.load() - Taken;
+		while (Available > Capacity && Queue.Pop())
+		{
+			Available--;
+			Taken++;
+			Count--;
+			Dropped++;
+		}
+	}
+
+	// Mpsc mode makes Enqueue an atomic exchange, safe for concurrent producers
+	TQueue<ItemType, EQueueMode::Mpsc> Queue;
 	TWeakPtr<FAccelByteKey> Key;
+	std::atomic<int32> Count{0};
+	std::atomic<int32> HighWaterMark{0};
+	std::atomic<int64> Dropped{0};
+	/** Items visible to the consumer since the queue was created, counted once their enqueue completed. */
+	std::atomic<int64> Published{0};
+	/** Items dequeued or dropped by the consumer, only touched by the consumer thread. */
+	int64 Taken{0};
+	EAccelByteQueueOverflowPolicy Policy{EAccelByteQueueOverflowPolicy::Grow};
+	int32 Capacity{0};
 
 	/** Hidden copy constructor. */
 	FAccelByteLockableQueue(const FAccelByteLockableQueue&) = delete;
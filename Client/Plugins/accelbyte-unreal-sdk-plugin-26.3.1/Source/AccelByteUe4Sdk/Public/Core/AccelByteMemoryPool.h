@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "HttpManager.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Core/AccelByteBlockPool.h"
 #include "Core/AccelByteLRUCache.h"
 #include "Models/AccelByteGeneralModels.h"
 
@@ -81,6 +82,18 @@ public:
 	*/
 	virtual const TSharedPtr<T> Get(const FName& Key) = 0;
 
+	/**
+	* @brief Change the limits checked before every insertion, stored data above the new limits is kept until removed
+	*
+	* @param PoolSize Upper bound of the sum of every item Length
+	* @param ChunkCount Upper bound of the number of items
+	*/
+	virtual void SetLimits(size_t PoolSize, int32 ChunkCount)
+	{
+		MemoryParameter.PoolSize = PoolSize;
+		MemoryParameter.ChunkCount = ChunkCount;
+	}
+
 	inline const size_t GetCurrentMemoryPoolSize() { return CurrentMemoryPoolSize; }
 	inline const size_t GetMemoryPoolLeft() { return MemoryParameter.PoolSize - CurrentMemoryPoolSize; }
 	inline const int32 GetCurrentChunkCount() { return CurrentChunkCount; }
@@ -103,16 +116,39 @@ protected:
 	*/
 	inline const int32 FindIndexFromChunkList(const FName& Key)
 	{
-		int Index = -1;
-		for (int i = 0; i < ChunkList.Num(); i++)
+		const int32* Index = ChunkListIndex.Find(Key);
+		return Index != nullptr ? *Index : -1;
+	}
+
+	/**
+	* @brief Append a chunk and index it by its Key
+	*
+	* @return Index of the chunk in the ChunkList
+	*/
+	inline int32 AddToChunkList(const FChunkInfo<T>& Chunk)
+	{
+		const int32 Index = ChunkList.Add(Chunk);
+		ChunkListIndex.Add(Chunk.Key, Index);
+		return Index;
+	}
+
+	/**
+	* @brief Remove a chunk by swapping the last one into its place, so no other index shifts
+	*/
+	inline void RemoveFromChunkList(int32 Index)
+	{
+		ChunkListIndex.Remove(ChunkList[Index].Key);
+		ChunkList.RemoveAtSwap(Index);
+		if (Index < ChunkList.Num())
 		{
-			if (ChunkList[i].Key == Key)
-			{
-				Index = i;
-			}
+			ChunkListIndex.Add(ChunkList[Index].Key, Index);
 		}
+	}
 
-		return Index;
+	inline void EmptyChunkList()
+	{
+		ChunkList.Empty();
+		ChunkListIndex.Empty();
 	}
 
 	MemoryConstructionParameter MemoryParameter;
@@ -120,6 +156,7 @@ protected:
 	int32 CurrentChunkCount = 0;
 	
 	TArray<FChunkInfo<T>> ChunkList;
+	TMap<FName, int32> ChunkListIndex;
 };
 
 template<typename T>
@@ -141,39 +178,72 @@ public:
 };
 
 
+/**
+ * Stores the cached items in a FAccelByteBlockPool, which saves one heap allocation per insertion.
+ * Only the item itself is pooled, buffers it owns such as the HTTP payloads are still allocated by their own containers.
+ */
 template<typename T>
 class FAccelByteMemoryPoolAllocation : public FAccelByteMemory<T>
 {
+	static_assert(alignof(T) <= FAccelByteBlockPool::BlockAlignment, "FAccelByteMemoryPoolAllocation cannot align this type");
+
 public:
 	FAccelByteMemoryPoolAllocation(size_t PoolSize_, int32 ChunkCount_)
+		: Pool(MakeShared<FAccelByteBlockPool, ESPMode::ThreadSafe>(GetReservedSize(PoolSize_, ChunkCount_)))
 	{
 		this->MemoryParameter.Method = MemoryMethod::PoolAllocation;
 		this->MemoryParameter.PoolSize = PoolSize_;
 		this->MemoryParameter.ChunkCount = ChunkCount_;
-		ReservedMemory = std::malloc(PoolSize_);
 	}
 
 	~FAccelByteMemoryPoolAllocation()
 	{
-		free(ReservedMemory);
-		this->ChunkList.Empty();
+		// Items still referenced outside keep the pool alive through their deleter.
+		this->EmptyChunkList();
 	}
 
 	inline void RemoveAll() override
 	{
 		this->CurrentChunkCount = 0;
 		this->CurrentMemoryPoolSize = 0;
-		this->ChunkList.Empty();
+		this->EmptyChunkList();
+		Pool->Defragment();
 	}
 
 	inline const FChunkInfo<T>* Insert(T& Data, const FName& Key) override
 	{
-		if (this->ChunkList.Num() >= this->MemoryParameter.ChunkCount)
+		if (!InsertPrerequisiteOkay())
 		{
 			return nullptr;
 		}
-		// Store to the reserved memory 
-		return nullptr;
+
+		void* Block = Pool->Allocate(sizeof(T));
+		if (Block == nullptr && Pool->Defragment() > 0)
+		{
+			Block = Pool->Allocate(sizeof(T));
+		}
+		if (Block == nullptr)
+		{
+			return nullptr;
+		}
+
+		TSharedRef<FAccelByteBlockPool, ESPMode::ThreadSafe> PoolRef = Pool;
+		FChunkInfo<T> Result;
+		Result.Key = Key;
+		Result.Data = MakeShareable<T>(new (Block) T(Data), [PoolRef](T* Item)
+			{
+				Item->~T();
+				PoolRef->Free(Item);
+			});
+		Result.Length = FAccelByteLRUCache<T>::GetRequiredSize(*Result.Data);
+		Result.Pool = this;
+
+		int Index = this->AddToChunkList(Result);
+
+		this->CurrentChunkCount += 1;
+		this->CurrentMemoryPoolSize += Result.Length;
+
+		return &this->ChunkList[Index];
 	}
 
 	inline void Remove(const FName& Key) override
@@ -181,8 +251,10 @@ public:
 		auto Index = this->FindIndexFromChunkList(Key);
 		if (Index >= 0)
 		{
-			// deal with raw memory immediately
-			this->ChunkList.RemoveAt(Index);
+			// The block goes back to the pool once the last reference to the item is gone
+			this->CurrentChunkCount -= 1;
+			this->CurrentMemoryPoolSize -= this->ChunkList[Index].Length;
+			this->RemoveFromChunkList(Index);
 		}
 	}
 
@@ -196,24 +268,53 @@ public:
 		return nullptr;
 	}
 
+	/**
+	* @brief A pool too small for the new item count is replaced, items already stored go back to the previous pool when freed
+	*/
+	inline void SetLimits(size_t PoolSize_, int32 ChunkCount_) override
+	{
+		FAccelByteMemory<T>::SetLimits(PoolSize_, ChunkCount_);
+
+		const size_t ReservedSize = GetReservedSize(PoolSize_, ChunkCount_);
+		if (ReservedSize > Pool->GetStats().ReservedBytes)
+		{
+			Pool = MakeShared<FAccelByteBlockPool, ESPMode::ThreadSafe>(ReservedSize);
+		}
+	}
+
+	/**
+	* @brief Give slabs that no longer hold any item back to the pool
+	*
+	* @return Number of slabs reclaimed
+	*/
+	inline int32 DefragmentMemory() { return Pool->Defragment(); }
+
+	inline FAccelByteBlockPoolStats GetPoolStats() const { return Pool->GetStats(); }
+
 private:
 	inline bool InsertPrerequisiteOkay() override
 	{
-		if (this->ChunkList.Num() >= this->MemoryParameter.ChunkCount)
+		if (this->GetCurrentChunkCount() >= this->MemoryParameter.ChunkCount)
+		{
+			return false;
+		}
+		if (this->GetCurrentMemoryPoolSize() >= this->MemoryParameter.PoolSize)
 		{
 			return false;
 		}
-		// if (ReservedMemory is full)
-
 		return true;
 	}
 
-	//TODO void DefragmentMemory() = 0;
-
-	// Constructor don't forget to reserve based on the PoolSize byte
-	// Makeshareable for ChunkInfo
+	/**
+	* @brief Only the items live in the pool, the payload they point to is accounted against PoolSize through their Length
+	*/
+	inline static size_t GetReservedSize(size_t PoolSize_, int32 ChunkCount_)
+	{
+		const size_t ItemBlockSize = FMath::Max<size_t>(FMath::RoundUpToPowerOfTwo64(sizeof(T)), FAccelByteBlockPool::MinBlockSize);
+		return FMath::Min<size_t>(PoolSize_, ItemBlockSize * FMath::Max(ChunkCount_, 1));
+	}
 
-	void* ReservedMemory;
+	TSharedRef<FAccelByteBlockPool, ESPMode::ThreadSafe> Pool;
 };
 
 
@@ -230,14 +331,14 @@ public:
 
 	~FAccelByteMemoryDynamicAllocation()
 	{
-		this->ChunkList.Empty();
+		this->EmptyChunkList();
 	}
 
 	inline void RemoveAll() override
 	{
 		this->CurrentChunkCount = 0;
 		this->CurrentMemoryPoolSize = 0;
-		this->ChunkList.Empty();
+		this->EmptyChunkList();
 	}
 
 	inline const FChunkInfo<T>* Insert(T& Data, const FName& Key) override
@@ -253,7 +354,7 @@ public:
 		Result.Length = FAccelByteLRUCache<T>::GetRequiredSize(Data);
 		Result.Pool = this;
 
-		int Index = this->ChunkList.Add(Result);
+		int Index = this->AddToChunkList(Result);
 		Result.Length = FAccelByteLRUCache<T>::GetRequiredSize(*this->ChunkList[Index].Data);
 
 		this->CurrentChunkCount += 1;
@@ -269,7 +370,7 @@ public:
 		{
 			this->CurrentChunkCount -= 1;
 			this->CurrentMemoryPoolSize -= this->ChunkList[Index].Length;
-			this->ChunkList.RemoveAt(Index);
+			this->RemoveFromChunkList(Index);
 		}
 	}
 
@@ -7,10 +7,14 @@
 #include "AccelByteApiClient.h"
 #include "Api/AccelByteUserProfileApi.h"
 #include "AccelByteServerApiClient.h"
+#include "HAL/CriticalSection.h"
 
 namespace AccelByte
 {
 
+/**
+ * @brief Keeps API clients by key, safe to use from any thread.
+ */
 class ACCELBYTEUE4SDK_API FMultiRegistry
 {
 public:
@@ -24,6 +28,8 @@ public:
 private:
 	static TMap<FString, FApiClientPtr> ApiClientInstances;
 	static TMap<FString, FServerApiClientPtr> ServerApiClientInstances;
+	/** Guards both maps, clients are released outside of it since their destruction may call back into the registry. */
+	static FCriticalSection InstancesLock;
 
 	FMultiRegistry() = delete;
 	FMultiRegistry(FMultiRegistry const& Other) = delete;
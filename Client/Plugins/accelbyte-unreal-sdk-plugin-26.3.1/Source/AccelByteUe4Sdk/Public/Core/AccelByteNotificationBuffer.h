@@ -64,6 +64,28 @@ namespace AccelByte
 		 */
 		TArray<FAccelByteModelsUserNotification> GetSortedBuffer();
 
+		/**
+		 * @brief Take the buffered notifications sorted by sequence and clear the buffer, without copying them.
+		 *
+		 * @return Array of sorted notifications buffer
+		 */
+		TArray<FAccelByteModelsUserNotification> TakeSortedBuffer();
+
+		/**
+		 * @brief Bound the time and memory spent waiting for missing notifications.
+		 *
+		 * @param InMaxBufferedNotifications Number of buffered notifications from which the buffer should be released.
+		 * @param InGapTimeoutSeconds Time after buffering started from which the buffer should be released, 0 to wait indefinitely.
+		 */
+		void SetLimits(int32 InMaxBufferedNotifications, double InGapTimeoutSeconds);
+
+		/**
+		 * @brief Check if the buffer should be released without waiting for the missing notifications anymore.
+		 *
+		 * @return true if buffering and either the buffer is full or the gap timed out.
+		 */
+		bool ShouldRelease() const;
+
 		/**
 		 * @brief Check if this buffer is in process of retrieving missing notification.
 		 *
@@ -71,15 +93,33 @@ namespace AccelByte
 		 */
 		bool IsBuffering() const;
 
+		/**
+		 * @brief Get the id of the current buffering episode, a new one starts each time buffering starts.
+		 *
+		 * @return id to tag the missing notification request of the episode with.
+		 */
+		uint32 GetBufferingEpisode() const;
+
 	private:
 		bool bBuffering{false};
+		uint32 BufferingEpisode{0};
 
 		FLobbySequenceID LastSequenceID{0};
 		FLobbySequenceNumber LastSequenceNumber{0};
 		FDateTime LastSentAt{0};
 
+		static constexpr int32 DefaultMaxBufferedNotifications = 1000;
+		static constexpr double DefaultGapTimeoutSeconds = 60.0;
+		int32 MaxBufferedNotifications{DefaultMaxBufferedNotifications};
+		double GapTimeoutSeconds{DefaultGapTimeoutSeconds};
+		double BufferingStartTime{0.0};
+
 		mutable FCriticalSection BufferLock;
+		// Binary min-heap ordered by sequence, so adding a notification does not sort the whole buffer
 		TArray<FAccelByteModelsUserNotification> Buffer;
+		TSet<uint64> BufferedSequences;
+
+		static uint64 GetSequenceKey(int32 SequenceID, int32 SequenceNumber);
 
 		void UpdateLastSequence(const FAccelByteModelsUserNotification& InNotification);
 		bool HasValidSequence(const FAccelByteModelsUserNotification& InNotification) const;
@@ -87,6 +127,5 @@ namespace AccelByte
 		bool IsDuplicateNotification(const FAccelByteModelsUserNotification& InNotification) const;
 		bool IsExistInBuffer(const FLobbySequenceID& InSequenceID, const FLobbySequenceNumber& InSequenceNumber) const;
 		void AddToBuffer(const FAccelByteModelsUserNotification& InNotification);
-		void SortBuffer();
 	};
 }
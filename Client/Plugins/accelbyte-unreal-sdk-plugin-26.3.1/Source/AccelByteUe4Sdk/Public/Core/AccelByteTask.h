@@ -229,6 +229,11 @@ public:
 	 */
 	virtual double Time() const { return TaskTime; }
 
+	/**
+	 * @brief Time at which the Task needs its next Tick, schedulers may sleep until then.
+	 */
+	virtual double NextTickTime() const { return TaskTime; }
+
 	/**
 	 * @brief Create Cancellation Token handler.
 	 */
@@ -238,7 +243,11 @@ public:
 	}
 
 protected:
+	friend class FHttpRetryScheduler;
+
 	double TaskTime = 0.0;
+	/** Deadline the Task is currently queued under by its scheduler, used to skip stale queue entries. */
+	double ScheduledTime = -1.0;
 	EAccelByteTaskState TaskState = EAccelByteTaskState::Pending;
 	bool bIsFinished = false;
 	FAccelByteCancellationTokenRef Token = MakeShared<FAccelByteCancellationTokenSource, ESPMode::ThreadSafe>();
@@ -0,0 +1,117 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/UniquePtr.h"
+
+class IFileHandle;
+
+namespace AccelByte
+{
+
+/**
+ * @brief Event read back from the spool that has not been acknowledged yet.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteSpooledEvent
+{
+	int64 Sequence = 0;
+	FString Payload;
+};
+
+/**
+ * @brief Append-only spool of telemetry events stored in segment files.
+ *
+ * Events are appended as checksummed records to the newest segment. Acknowledgements are appended as records as well,
+ * and segments are deleted from the oldest one once every event they hold has been acknowledged. When the spool grows
+ * past its size limit the oldest segments are dropped even if they still hold pending events.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteTelemetrySpool
+{
+public:
+	static constexpr int64 DefaultMaxSegmentBytes = 1024 * 1024;
+	static constexpr int64 DefaultMaxTotalBytes = 16 * 1024 * 1024;
+
+	FAccelByteTelemetrySpool(const FString& InDirectory
+		, int64 InMaxSegmentBytes = DefaultMaxSegmentBytes
+		, int64 InMaxTotalBytes = DefaultMaxTotalBytes);
+	~FAccelByteTelemetrySpool();
+
+	/**
+	 * @brief Replay the segments found on disk, dropping torn records left by a crash.
+	 *
+	 * @return Events that were never acknowledged, ordered by sequence.
+	 */
+	TArray<FAccelByteSpooledEvent> Open();
+
+	/**
+	 * @brief Append an event to the newest segment.
+	 *
+	 * @param Payload Serialized event.
+	 * @return Sequence of the event, or INDEX_NONE when it could not be written.
+	 */
+	int64 Append(const FString& Payload);
+
+	/**
+	 * @brief Mark events as delivered, deleting the oldest segments that no longer hold pending events.
+	 *
+	 * @param Sequences Sequences returned by Append or Open.
+	 */
+	void Acknowledge(const TArray<int64>& Sequences);
+
+	/** Number of events written but not acknowledged yet. */
+	int32 GetPendingCount() const;
+
+	/** Bytes currently used on disk by all segments. */
+	int64 GetTotalBytes() const;
+
+	/** Number of pending events lost because the spool exceeded its size limit. */
+	int64 GetDroppedCount() const;
+
+private:
+	enum class ERecordType : uint8
+	{
+		Event = 1,
+		Acknowledge = 2
+	};
+
+	struct FSegment
+	{
+		int64 FirstSequence = 0;
+		FString Path;
+		int64 Size = 0;
+		TSet<int64> Pending;
+	};
+
+	FString GetSegmentPath(int64 FirstSequence) const;
+	bool ReplaySegment(int32 SegmentIndex, TMap<int64, FString>& OutEvents, TMap<int64, int32>& OutEventSegments);
+	bool WriteRecord(ERecordType Type, int64 Sequence, const uint8* Payload, int32 PayloadSize);
+	bool OpenActiveSegment();
+	void CloseActiveSegment();
+	void DeleteOldestSegment();
+	void TruncateAcknowledged();
+	void EnforceSizeLimit();
+
+	const FString Directory;
+	const int64 MaxSegmentBytes;
+	const int64 MaxTotalBytes;
+
+	TArray<FSegment> Segments;
+	TUniquePtr<IFileHandle> ActiveHandle;
+	int64 NextSequence = 0;
+	int64 TotalBytes = 0;
+	int64 DroppedCount = 0;
+	int32 PendingCount = 0;
+	/** Reused for every record written, guarded by Lock. */
+	TArray<uint8> RecordBuffer;
+
+	mutable FCriticalSection Lock;
+
+	FAccelByteTelemetrySpool(FAccelByteTelemetrySpool const&) = delete;
+	FAccelByteTelemetrySpool& operator=(FAccelByteTelemetrySpool const&) = delete;
+};
+
+} // Namespace AccelByte
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/ReflectedTypeAccessors.h"
+#include "Core/AccelByteJsonStructReader.h"
 
 class ACCELBYTEUE4SDK_API FAccelByteArrayByteFStringConverter
 {
@@ -51,6 +52,69 @@ class ACCELBYTEUE4SDK_API FAccelByteJsonConverter
 public:
 	template<typename OutStructType>
 	static bool JsonObjectStringToUStruct(const FString& JsonString, OutStructType* OutStruct)
+	{
+		// The fast path stops midway on anything it cannot read, so it fills a copy that is only kept on success
+		OutStructType Scratch(*OutStruct);
+		if (FAccelByteJsonStructReader::ReadObject(*JsonString, JsonString.Len(), OutStructType::StaticStruct(), &Scratch) == FAccelByteJsonStructReader::EResult::Success)
+		{
+			*OutStruct = MoveTemp(Scratch);
+			return true;
+		}
+		return JsonObjectStringToUStructDom(JsonString, OutStruct);
+	}
+
+	/**
+	 * @brief Same as JsonObjectStringToUStruct, reading UTF-8 bytes such as an HTTP response content without decoding
+	 * them into an FString first.
+	 */
+	template<typename OutStructType>
+	static bool JsonObjectBytesToUStruct(const TArray<uint8>& Utf8Json, OutStructType* OutStruct)
+	{
+		const ANSICHAR* Json = reinterpret_cast<const ANSICHAR*>(Utf8Json.GetData());
+		OutStructType Scratch(*OutStruct);
+		if (FAccelByteJsonStructReader::ReadObject(Json, Utf8Json.Num(), OutStructType::StaticStruct(), &Scratch) == FAccelByteJsonStructReader::EResult::Success)
+		{
+			*OutStruct = MoveTemp(Scratch);
+			return true;
+		}
+		return JsonObjectStringToUStructDom(Utf8BytesToFString(Utf8Json), OutStruct);
+	}
+
+	template<typename OutStructType>
+	static bool JsonArrayStringToUStruct(const FString& JsonString, TArray<OutStructType>* OutStructArray)
+	{
+		TArray<OutStructType> Scratch(*OutStructArray);
+		int32 Count = 0;
+		if (FAccelByteJsonStructReader::ReadArray(*JsonString, JsonString.Len(), OutStructType::StaticStruct(), ArrayElementAdder(&Scratch, Count)) == FAccelByteJsonStructReader::EResult::Success)
+		{
+			Scratch.SetNum(Count);
+			*OutStructArray = MoveTemp(Scratch);
+			return true;
+		}
+		return JsonArrayStringToUStructDom(JsonString, OutStructArray);
+	}
+
+	/**
+	 * @brief Same as JsonArrayStringToUStruct, reading UTF-8 bytes such as an HTTP response content without decoding
+	 * them into an FString first.
+	 */
+	template<typename OutStructType>
+	static bool JsonArrayBytesToUStruct(const TArray<uint8>& Utf8Json, TArray<OutStructType>* OutStructArray)
+	{
+		const ANSICHAR* Json = reinterpret_cast<const ANSICHAR*>(Utf8Json.GetData());
+		TArray<OutStructType> Scratch(*OutStructArray);
+		int32 Count = 0;
+		if (FAccelByteJsonStructReader::ReadArray(Json, Utf8Json.Num(), OutStructType::StaticStruct(), ArrayElementAdder(&Scratch, Count)) == FAccelByteJsonStructReader::EResult::Success)
+		{
+			Scratch.SetNum(Count);
+			*OutStructArray = MoveTemp(Scratch);
+			return true;
+		}
+		return JsonArrayStringToUStructDom(Utf8BytesToFString(Utf8Json), OutStructArray);
+	}
+
+	template<typename OutStructType>
+	static bool JsonObjectStringToUStructDom(const FString& JsonString, OutStructType* OutStruct)
 	{
 		TSharedPtr<FJsonObject> JsonObject;
 		TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(JsonString);
@@ -69,7 +133,7 @@ public:
 	}
 
 	template<typename OutStructType>
-	static bool JsonArrayStringToUStruct(const FString& JsonString, TArray<OutStructType>* OutStructArray)
+	static bool JsonArrayStringToUStructDom(const FString& JsonString, TArray<OutStructType>* OutStructArray)
 	{
 		TArray<TSharedPtr<FJsonValue> > JsonArray;
 		TSharedRef<TJsonReader<> > JsonReader = TJsonReaderFactory<>::Create(JsonString);
@@ -187,4 +251,27 @@ public:
 		}
 		return ValueInt;
 	}
+
+private:
+	/**
+	 * @brief Reuses the elements already in the array before adding new ones, like FJsonObjectConverter does.
+	 */
+	template<typename OutStructType>
+	static TFunction<void*()> ArrayElementAdder(TArray<OutStructType>* OutStructArray, int32& Count)
+	{
+		return [OutStructArray, &Count]() -> void*
+		{
+			if (Count == OutStructArray->Num())
+			{
+				OutStructArray->AddDefaulted();
+			}
+			return &(*OutStructArray)[Count++];
+		};
+	}
+
+	static FString Utf8BytesToFString(const TArray<uint8>& Utf8Json)
+	{
+		FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+		return FString(Converter.Length(), Converter.Get());
+	}
 };
\ No newline at end of file
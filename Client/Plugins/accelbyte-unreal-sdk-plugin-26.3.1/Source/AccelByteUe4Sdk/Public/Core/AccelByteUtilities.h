@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Core/AccelByteError.h"
+#include "Core/AccelByteFileTransfer.h"
 #include "Core/AccelByteIdValidator.h"
 #include "JsonObjectConverter.h"
 #include "Models/AccelByteEcommerceModels.h"
@@ -664,6 +665,44 @@ public:
 		, FString const& ContentType = TEXT("application/octet-stream"));
 #endif
 
+	/**
+	 * @brief Download a content from specified URL into a file without holding the whole content in memory.
+	 * The content is requested in ranged chunks appended to FilePath.part, and a dropped connection resumes from the
+	 * bytes already written. Downloading the same URL into the same file again also resumes from them.
+	 *
+	 * @param Url Specified URL to download the content.
+	 * @param FilePath Destination file, replaced once the whole content has been received.
+	 * @param OnProgress Callback function for on progress delegate.
+	 * @param OnDownloaded Callback function for successful download delegate.
+	 * @param OnError Callback function for error delegate.
+	 * @param ChunkBytes Number of bytes requested at once.
+	 *
+	 * @return The download, which can be cancelled and started again later.
+	 */
+	static AccelByte::FAccelByteFileDownloadPtr DownloadToFile(FString const& Url
+		, FString const& FilePath
+		, FAccelByteTransferProgressDelegate const& OnProgress
+		, AccelByte::FVoidHandler const& OnDownloaded
+		, FErrorHandler const& OnError
+		, int64 ChunkBytes = AccelByte::FAccelByteFileDownload::DefaultChunkBytes);
+
+	/**
+	 * @brief Upload the content of a file using specified URL, streaming it from disk instead of loading it in memory.
+	 *
+	 * @param Url Specified URL to upload the content.
+	 * @param FilePath File to upload.
+	 * @param OnProgress Callback function for on progress delegate.
+	 * @param OnSuccess Callback function for successful upload delegate.
+	 * @param OnError Callback function for error delegate.
+	 * @param ContentType Specified content-type header which determine the type of uploaded content (default: application/octet-stream)
+	 */
+	static void UploadFromFile(FString const& Url
+		, FString const& FilePath
+		, FAccelByteTransferProgressDelegate const& OnProgress
+		, AccelByte::FVoidHandler const& OnSuccess
+		, FErrorHandler const& OnError
+		, FString const& ContentType = TEXT("application/octet-stream"));
+
 	/**
 	 * @brief Check whether specified URL is a valid URL format or not.
 	 *
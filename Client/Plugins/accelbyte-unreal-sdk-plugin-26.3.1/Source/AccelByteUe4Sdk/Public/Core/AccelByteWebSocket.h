@@ -57,6 +57,44 @@ struct FMassiveOutageInfo
 
 ENUM_CLASS_FLAGS(EWebSocketEvent);
 
+/**
+ * @brief Order in which queued outbound messages are sent, messages of the same priority keep their order.
+ */
+enum class EWebSocketSendPriority : uint8
+{
+	High = 0,
+	Normal = 1,
+	Low = 2,
+	Count
+};
+
+enum class EWebSocketSendResult : uint8
+{
+	/** Sent to the socket right away. */
+	Sent,
+	/** Waiting in the outbound queue for the send rate limit. */
+	Queued,
+	/** Replaced the content of a queued message with the same coalesce key, which will not be sent anymore. */
+	Coalesced
+};
+
+/**
+ * @brief Counters of the outbound queue of a websocket.
+ * Sizes are counted in UTF-8 bytes, as the messages are sent.
+ */
+struct FWebSocketSendStats
+{
+	int32 QueuedMessages = 0;
+	int64 QueuedBytes = 0;
+	int64 SentMessages = 0;
+	int64 SentBytes = 0;
+	int64 CoalescedMessages = 0;
+	/** Time between the Send call and the message reaching the socket. */
+	double AverageSendLatencySeconds = 0.0;
+	double MaxSendLatencySeconds = 0.0;
+	bool bBackpressured = false;
+};
+
 class ACCELBYTEUE4SDK_API AccelByteWebSocket
 {
 public:
@@ -66,10 +104,13 @@ public:
 	// To be used as multicast delegate (member of this WebSocket class)
 	DECLARE_MULTICAST_DELEGATE(FConnectDelegate)
 	DECLARE_MULTICAST_DELEGATE_OneParam(FMessageReceiveDelegate, const FString&)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FMessageBatchReceiveDelegate, const TArray<FString>&)
 	DECLARE_MULTICAST_DELEGATE_OneParam(FConnectionErrorDelegate, const FString&)
 	DECLARE_MULTICAST_DELEGATE_ThreeParams(FConnectionCloseMulticastDelegate, const int32, const FString&, const bool)
 	DECLARE_MULTICAST_DELEGATE_OneParam(FReconnectAttemptMulticastDelegate, const FReconnectAttemptInfo&)
 	DECLARE_MULTICAST_DELEGATE_OneParam(FMassiveOutageMulticastDelegate, const FMassiveOutageInfo&)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FSendBackpressureDelegate, bool /* bBackpressured */)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FSendDroppedDelegate, const TArray<FString>& /* Messages */)
 	
 	AccelByteWebSocket(
 		const Credentials& Credentials,
@@ -87,11 +128,28 @@ public:
 
 	FConnectDelegate& OnConnected();
 	FMessageReceiveDelegate& OnMessageReceived();
+
+	/**
+	 * @brief Receives every message dequeued in a tick with a single call, in the order they arrived.
+	 * Messages are still broadcast one by one to OnMessageReceived before the batch is delivered.
+	 */
+	FMessageBatchReceiveDelegate& OnMessageBatchReceived();
 	FConnectionErrorDelegate& OnConnectionError();
 	FConnectionCloseMulticastDelegate& OnConnectionClosed();
 	FReconnectAttemptMulticastDelegate& OnReconnectAttempt();
 	FMassiveOutageMulticastDelegate& OnMassiveOutage();
 
+	/**
+	 * @brief Called when the queued outbound bytes cross the backpressure threshold, in either direction.
+	 */
+	FSendBackpressureDelegate& OnSendBackpressureChanged();
+
+	/**
+	 * @brief Called with the queued messages dropped when the websocket is set up again for a new connection.
+	 * High priority messages are not dropped, they are sent once the new connection is up.
+	 */
+	FSendDroppedDelegate& OnSendDropped();
+
 	void Reconnect();
 
 	FTickerDelegate TickerDelegate;
@@ -126,7 +184,29 @@ public:
 	void Disconnect(bool ForceCleanup = false);
 	bool IsConnected() const;
 	void SendPing() const;
-	void Send(const FString& Message) const;
+
+	/**
+	 * @brief Send a message, or queue it when the send rate limit is reached.
+	 *
+	 * @param Message Message to send.
+	 * @param Priority Queued messages with a higher priority are sent first.
+	 * @param CoalesceKey Messages carrying state that a newer message supersedes (presence, heartbeat...) share a key,
+	 * a queued message with the same key gets its content replaced instead of queueing another one.
+	 */
+	EWebSocketSendResult Send(const FString& Message
+		, EWebSocketSendPriority Priority = EWebSocketSendPriority::Normal
+		, FName CoalesceKey = NAME_None);
+
+	/**
+	 * @brief Limit the rate at which messages are sent. Messages are sent right away when the limit is 0.
+	 *
+	 * @param BytesPerSecond Send rate limit, a burst of up to one second of it can be sent at once.
+	 * @param BackpressureThresholdBytes Queued bytes from which IsSendBackpressured returns true.
+	 */
+	void SetSendRateLimit(int32 BytesPerSecond, int32 BackpressureThresholdBytes);
+
+	bool IsSendBackpressured() const;
+	FWebSocketSendStats GetSendStats() const;
 
 private:
 	bool bConnectTriggered {false};
@@ -137,8 +217,45 @@ private:
 	TQueue<FMassiveOutageInfo> OnMassiveOutageQueue;
 	bool bConnectedBroadcasted {false};
 
+#pragma region SEND_QUEUE_RELATED_MEMBERS
+	struct FOutboundMessage
+	{
+		FString Message;
+		FName CoalesceKey;
+		double EnqueueTime;
+		int32 SizeBytes;
+	};
+	typedef TSharedPtr<FOutboundMessage> FOutboundMessagePtr;
+
+	static constexpr int32 DefaultSendBackpressureThresholdBytes = 64 * 1024;
+
+	mutable FCriticalSection SendQueueLock;
+	TQueue<FOutboundMessagePtr> SendQueues[static_cast<uint8>(EWebSocketSendPriority::Count)];
+	TMap<FName, FOutboundMessagePtr> QueuedMessagesByCoalesceKey;
+	int32 SendRateLimitBytesPerSecond {0};
+	int32 SendBackpressureThresholdBytes {DefaultSendBackpressureThresholdBytes};
+	double SendBudgetBytes {0.0};
+	double SendBudgetUpdateTime {0.0};
+	double TotalSendLatencySeconds {0.0};
+	FWebSocketSendStats SendStats;
+	FSendBackpressureDelegate SendBackpressureDelegate;
+	FSendDroppedDelegate SendDroppedDelegate;
+	FDelegateHandleAlias SendQueueTickerHandle;
+
+	void LoadSendQueueConfig();
+	bool HasSendBudget(double CurrentTime);
+	void SendNow(const FString& Message, int32 SizeBytes, double EnqueueTime, double CurrentTime);
+	bool UpdateSendBackpressure();
+	bool SendQueueTick(float DeltaTime);
+	void DropQueuedMessages();
+	static int32 GetUtf8Size(const FString& Message);
+	void TeardownSendQueueTicker();
+#pragma endregion SEND_QUEUE_RELATED_MEMBERS
+
 	FConnectDelegate ConnectDelegate;
 	FMessageReceiveDelegate MessageReceiveDelegate;
+	FMessageBatchReceiveDelegate MessageBatchReceiveDelegate;
+	TArray<FString> MessageBatch;
 	FConnectionErrorDelegate ConnectionErrorDelegate;
 	FConnectionCloseMulticastDelegate ConnectionCloseDelegate;
 	FReconnectAttemptMulticastDelegate ReconnectAttemptDelegate;
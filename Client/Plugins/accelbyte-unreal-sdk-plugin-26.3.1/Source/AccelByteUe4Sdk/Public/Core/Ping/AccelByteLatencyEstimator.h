@@ -0,0 +1,103 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Summarizes the ping rounds of one target.
+ *
+ * The latency is an exponentially weighted moving average, so a single noisy round only moves it by a fraction of
+ * the difference. The 95th percentile and the packet loss are computed over a sliding window of the latest rounds,
+ * the jitter is the smoothed difference between consecutive round trips (RFC 3550).
+ */
+class ACCELBYTEUE4SDK_API FAccelByteLatencyEstimator
+{
+public:
+	static constexpr int32 DefaultWindowSize = 20;
+	static constexpr float DefaultSmoothingFactor = 0.2f;
+	/** Fully lost rounds in a row after which the previous latency is no longer trusted. */
+	static constexpr int32 MaxConsecutiveLostRounds = 3;
+
+	explicit FAccelByteLatencyEstimator(int32 InWindowSize = DefaultWindowSize, float InSmoothingFactor = DefaultSmoothingFactor);
+
+	/**
+	 * @brief Record a ping round.
+	 *
+	 * @param LatencyMs Average round trip of the received probes, in milliseconds. Ignored when none was received.
+	 * @param Sent Number of probes sent.
+	 * @param Received Number of probes answered.
+	 */
+	void AddRound(float LatencyMs, int32 Sent, int32 Received);
+
+	/**
+	 * @brief Whether at least one probe has been answered.
+	 */
+	bool HasLatency() const { return bHasLatency; }
+
+	/**
+	 * @brief Whether the smoothed latency still describes the target: a probe was answered in one of the last
+	 * MaxConsecutiveLostRounds rounds.
+	 */
+	bool HasRecentLatency() const { return bHasLatency && ConsecutiveLostRounds < MaxConsecutiveLostRounds; }
+
+	/**
+	 * @brief Number of latest rounds in a row where every probe was lost.
+	 */
+	int32 GetConsecutiveLostRounds() const { return ConsecutiveLostRounds; }
+
+	/**
+	 * @brief Smoothed latency, in milliseconds.
+	 */
+	float GetLatency() const { return SmoothedLatency; }
+
+	/**
+	 * @brief 95th percentile of the round trips in the window, in milliseconds.
+	 */
+	float GetLatencyP95() const;
+
+	/**
+	 * @brief Smoothed variation between consecutive round trips, in milliseconds.
+	 */
+	float GetJitter() const { return Jitter; }
+
+	/**
+	 * @brief Ratio of probes lost in the window, between 0 and 1.
+	 */
+	float GetPacketLoss() const;
+
+	/**
+	 * @brief Number of rounds in the window.
+	 */
+	int32 GetRoundCount() const { return Rounds.Num(); }
+
+	/**
+	 * @brief Whether the estimate is settled: enough rounds were recorded, the last one lost nothing and stayed
+	 * within the usual jitter of the smoothed latency.
+	 */
+	bool IsStable() const;
+
+private:
+	struct FRound
+	{
+		float LatencyMs;
+		int32 Sent;
+		int32 Received;
+	};
+
+	int32 WindowSize;
+	float SmoothingFactor;
+
+	TArray<FRound> Rounds;
+	int32 NextRoundIndex = 0;
+
+	float SmoothedLatency = 0.0f;
+	float LastLatency = 0.0f;
+	float Jitter = 0.0f;
+	int32 ConsecutiveLostRounds = 0;
+	bool bHasLatency = false;
+	bool bLastRoundDeviated = false;
+	bool bLastRoundLost = false;
+};
@@ -42,4 +42,9 @@ public:
 	
 	static void SendUdpPing(FPingConfig const& Config, FPingCompleteDelegate const& OnPingCompleteDelegate);
 	static void SendUdpPing(FString const& Address, int32 Port, float Timeout, FPingCompleteDelegate const& OnPingCompleteDelegate);
+
+	/**
+	 * @brief Stop the worker and close the socket shared by UDP pings, pending pings complete as canceled.
+	 */
+	static void ShutdownUdpPinger();
 };
\ No newline at end of file
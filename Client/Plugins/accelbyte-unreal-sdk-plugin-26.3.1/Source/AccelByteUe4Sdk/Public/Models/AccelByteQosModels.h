@@ -55,6 +55,39 @@ struct FAccelByteModelsQosRegionLatency
 	float Latency{};
 };
 
+/**
+ * Latency of a region summarized over the latest ping rounds, all durations are in milliseconds.
+ */
+USTRUCT(BlueprintType)
+struct FAccelByteModelsQosRegionLatencyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	FString Region{};
+
+	/** Smoothed latency, the value reported by the cached latencies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	float Latency{};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	float LatencyP95{};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	float Jitter{};
+
+	/** Ratio of lost pings, between 0 and 1. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	float PacketLoss{};
+
+	/** Number of ping rounds the stats are computed from. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	int32 RoundCount{};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Server | Qos | Models | QosRegionLatencyStats")
+	bool bStable{};
+};
+
 USTRUCT(BlueprintType)
 struct FAccelByteModelsQosRegionLatencies
 {
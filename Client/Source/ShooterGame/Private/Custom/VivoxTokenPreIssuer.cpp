@@ -0,0 +1,120 @@
+// Copyright (c) 2023-2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "ShooterGame.h"
+#include "Custom/VivoxTokenPreIssuer.h"
+#include "Core/AccelByteMultiRegistry.h"
+#include "Online/ShooterPlayerState.h"
+#include "Vivox/VivoxGameInstance.h"
+#include "Vivox/VivoxPlayerController.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVivoxTokenPreIssuer, Log, All);
+
+void FVivoxTokenPreIssuer::AddPlayer(AVivoxPlayerController* PlayerController, const FString& GameMode, const FString& OnlineSessionId, int32 TeamNum)
+{
+    if (PlayerController == nullptr)
+    {
+        return;
+    }
+
+    FPendingPlayer& Player = PendingPlayers.AddDefaulted_GetRef();
+    Player.PlayerController = PlayerController;
+    Player.GameMode = GameMode;
+    Player.OnlineSessionId = OnlineSessionId;
+    Player.TeamNum = TeamNum;
+
+    // The client logs into Vivox with the same name, derived from its unique net id.
+    APlayerState* PlayerState = PlayerController->PlayerState;
+    if (PlayerState != nullptr && PlayerState->GetUniqueId().IsValid())
+    {
+        const FString PlayerName = UVivoxGameInstance::GetVivoxSafePlayerName(PlayerState->GetUniqueId()->ToString());
+        UVivoxGameInstance::BuildJoinTokenRequests(PlayerName, GameMode, OnlineSessionId, TeamNum, Player.TokenRequests);
+    }
+}
+
+void FVivoxTokenPreIssuer::Flush()
+{
+    if (PendingPlayers.Num() == 0)
+    {
+        return;
+    }
+
+    TArray<FPendingPlayer> Players = MoveTemp(PendingPlayers);
+    PendingPlayers.Reset();
+
+    TArray<FTokenRequestV1> TokenRequests;
+    for (const FPendingPlayer& Player : Players)
+    {
+        TokenRequests.Append(Player.TokenRequests);
+    }
+
+    // The token provider authorizes the server with its client access token, log in first if nothing else did.
+    AccelByte::FServerApiClientPtr ServerApiClient = AccelByte::FMultiRegistry::GetServerApiClient();
+    if (IsRunningDedicatedServer() && ServerApiClient->ServerCredentialsRef->GetClientAccessToken().IsEmpty())
+    {
+        UE_LOG(LogVivoxTokenPreIssuer, Log, TEXT("Logging the server in with client credentials before requesting voice tokens"));
+        ServerApiClient->ServerOauth2.LoginWithClientCredentials(AccelByte::FVoidHandler::CreateLambda([Players, TokenRequests]()
+        {
+            RequestTokens(Players, TokenRequests);
+        }), AccelByte::FErrorHandler::CreateLambda([Players](int32 ErrorCode, const FString& ErrorMessage)
+        {
+            UE_LOG(LogVivoxTokenPreIssuer, Warning, TEXT("Server login failed (%d: %s), not pre-issuing voice tokens"), ErrorCode, *ErrorMessage);
+            OnTokensReceived(TArray<FTokenResponseV1>(), Players, FPlatformTime::Seconds());
+        }));
+        return;
+    }
+
+    RequestTokens(Players, TokenRequests);
+}
+
+void FVivoxTokenPreIssuer::RequestTokens(const TArray<FPendingPlayer>& Players, const TArray<FTokenRequestV1>& TokenRequests)
+{
+    UE_LOG(LogVivoxTokenPreIssuer, Log, TEXT("Requesting %d voice tokens for %d players"), TokenRequests.Num(), Players.Num());
+
+    const double RequestTime = FPlatformTime::Seconds();
+    VivoxTokenProvider::GetTokens(TokenRequests, FOnTokensReceived::CreateLambda([Players, RequestTime](const TArray<FTokenResponseV1>& TokenResponses)
+    {
+        OnTokensReceived(TokenResponses, Players, RequestTime);
+    }));
+}
+
+void FVivoxTokenPreIssuer::OnTokensReceived(const TArray<FTokenResponseV1>& TokenResponses, const TArray<FPendingPlayer>& Players, double RequestTime)
+{
+    if (TokenResponses.Num() == 0)
+    {
+        UE_LOG(LogVivoxTokenPreIssuer, Warning, TEXT("Voice token batch failed, clients will fetch their own tokens"));
+    }
+
+    // Count the round trip against the token lifetime, the token provider started the clock when it issued them.
+    const float Elapsed = static_cast<float>(FPlatformTime::Seconds() - RequestTime);
+
+    int32 ResponseIndex = 0;
+    for (const FPendingPlayer& Player : Players)
+    {
+        TArray<FVivoxPreIssuedToken> PreIssuedTokens;
+
+        for (const FTokenRequestV1& TokenRequest : Player.TokenRequests)
+        {
+            if (TokenResponses.IsValidIndex(ResponseIndex))
+            {
+                const FTokenResponseV1& TokenResponse = TokenResponses[ResponseIndex];
+                if (!TokenResponse.AccessToken.IsEmpty() && TokenResponse.ExpiresIn > 0)
+                {
+                    FVivoxPreIssuedToken& PreIssuedToken = PreIssuedTokens.AddDefaulted_GetRef();
+                    PreIssuedToken.ChannelId = TokenRequest.ChannelId;
+                    PreIssuedToken.AccessToken = TokenResponse.AccessToken;
+                    PreIssuedToken.RemainingSeconds = TokenResponse.ExpiresIn - Elapsed;
+                }
+            }
+            ++ResponseIndex;
+        }
+
+        // Players may have left while the batch was in flight.
+        AVivoxPlayerController* PlayerController = Player.PlayerController.Get();
+        if (PlayerController != nullptr)
+        {
+            PlayerController->ClientJoinVoice(Player.GameMode, Player.OnlineSessionId, PreIssuedTokens, Player.TeamNum);
+        }
+    }
+}
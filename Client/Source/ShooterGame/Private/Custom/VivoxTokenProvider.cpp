@@ -7,6 +7,125 @@
 #include "Core/AccelByteMultiRegistry.h"
 
 #define VIVOX_TOKEN_PROVIDER_URL TEXT("GET VALUE FROM EXTEND APP")
+#define VIVOX_TOKEN_BATCH_PROVIDER_URL TEXT("GET VALUE FROM EXTEND APP")
+
+DEFINE_LOG_CATEGORY_STATIC(LogVivoxTokenProvider, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("VivoxTokenProvider"), STATGROUP_VivoxTokenProvider, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Requests"), STAT_VivoxTokenRequests, STATGROUP_VivoxTokenProvider);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Retries"), STAT_VivoxTokenRetries, STATGROUP_VivoxTokenProvider);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Failures"), STAT_VivoxTokenFailures, STATGROUP_VivoxTokenProvider);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rejected By Circuit Breaker"), STAT_VivoxTokenRejected, STATGROUP_VivoxTokenProvider);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Circuit Breaker State"), STAT_VivoxTokenCircuitState, STATGROUP_VivoxTokenProvider);
+
+FVivoxTokenRetryPolicy VivoxTokenProvider::RetryPolicy;
+
+namespace
+{
+    FVivoxTokenProviderStats TokenProviderStats;
+
+    /** Circuit breaker state, only touched from the game thread where HTTP completions are delivered. */
+    int32 ConsecutiveFailures = 0;
+    double CircuitOpenedAt = 0.0;
+    bool bHalfOpenProbeInFlight = false;
+
+    void SetCircuitState(EVivoxTokenCircuitState NewState)
+    {
+        if (TokenProviderStats.CircuitState != NewState)
+        {
+            UE_LOG(LogVivoxTokenProvider, Log, TEXT("Token provider circuit breaker %d -> %d"), static_cast<int32>(TokenProviderStats.CircuitState), static_cast<int32>(NewState));
+            TokenProviderStats.CircuitState = NewState;
+        }
+        SET_DWORD_STAT(STAT_VivoxTokenCircuitState, static_cast<uint32>(NewState));
+    }
+
+    /** Returns false if the token provider should not be called right now. */
+    bool TryAcquireCircuit()
+    {
+        switch (TokenProviderStats.CircuitState)
+        {
+            case EVivoxTokenCircuitState::Open:
+                if (FPlatformTime::Seconds() - CircuitOpenedAt < VivoxTokenProvider::RetryPolicy.CircuitOpenSeconds)
+                {
+                    return false;
+                }
+                // Cooldown elapsed, let a single request through to probe the service.
+                SetCircuitState(EVivoxTokenCircuitState::HalfOpen);
+                bHalfOpenProbeInFlight = true;
+                return true;
+            case EVivoxTokenCircuitState::HalfOpen:
+                if (bHalfOpenProbeInFlight)
+                {
+                    return false;
+                }
+                bHalfOpenProbeInFlight = true;
+                return true;
+            default:
+                return true;
+        }
+    }
+
+    void RecordSuccess()
+    {
+        ConsecutiveFailures = 0;
+        bHalfOpenProbeInFlight = false;
+        SetCircuitState(EVivoxTokenCircuitState::Closed);
+    }
+
+    void OpenCircuit()
+    {
+        CircuitOpenedAt = FPlatformTime::Seconds();
+        SetCircuitState(EVivoxTokenCircuitState::Open);
+    }
+
+    /** A token request gave up, after its retries or because the failure was not retryable. */
+    void RecordFailure()
+    {
+        ++ConsecutiveFailures;
+        bHalfOpenProbeInFlight = false;
+
+        // Late failures of requests sent before the circuit opened must not extend its cooldown
+        if (TokenProviderStats.CircuitState == EVivoxTokenCircuitState::HalfOpen
+            || (TokenProviderStats.CircuitState == EVivoxTokenCircuitState::Closed
+                && ConsecutiveFailures >= VivoxTokenProvider::RetryPolicy.CircuitFailureThreshold))
+        {
+            OpenCircuit();
+        }
+    }
+
+    /**
+     * A single attempt failed and will be retried. Only whole requests count towards the threshold, so one caller
+     * retrying cannot open the circuit for everyone, but a failed half-open probe reopens it.
+     */
+    void RecordAttemptFailure()
+    {
+        bHalfOpenProbeInFlight = false;
+
+        if (TokenProviderStats.CircuitState == EVivoxTokenCircuitState::HalfOpen)
+        {
+            OpenCircuit();
+        }
+    }
+
+    /** Full jitter exponential backoff, see "Exponential Backoff And Jitter". */
+    float GetRetryDelay(int32 Attempt)
+    {
+        const FVivoxTokenRetryPolicy& Policy = VivoxTokenProvider::RetryPolicy;
+        const float Ceiling = FMath::Min(Policy.MaxBackoffSeconds, Policy.InitialBackoffSeconds * FMath::Pow(2.0f, static_cast<float>(Attempt)));
+        return FMath::FRandRange(Policy.InitialBackoffSeconds * 0.5f, FMath::Max(Ceiling, Policy.InitialBackoffSeconds * 0.5f));
+    }
+
+    FString GetTokenProviderAccessToken()
+    {
+        // Dedicated servers request tokens on behalf of their players, so they authorize as the game client.
+        if (IsRunningDedicatedServer())
+        {
+            return AccelByte::FMultiRegistry::GetServerApiClient()->ServerCredentialsRef->GetClientAccessToken();
+        }
+
+        return AccelByte::FMultiRegistry::GetApiClient()->CredentialsRef->GetAccessToken();
+    }
+}
 
 FString FTokenRequestV1::ToJson() const
 {
@@ -96,6 +215,11 @@ FString FTokenResponseV1::ToJson() const
         JsonObject->SetStringField(TEXT("uri"), Uri);
     }
 
+    if (ExpiresIn > 0)
+    {
+        JsonObject->SetNumberField(TEXT("expiresIn"), ExpiresIn);
+    }
+
     FString JsonString;
     TSharedRef<TJsonWriter<TCHAR>> Writer = TJsonWriterFactory<TCHAR>::Create(&JsonString);
     FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
@@ -108,33 +232,70 @@ bool FTokenResponseV1::FromJson(const FString& JsonString)
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JsonString);
 
-    if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+    if (FJsonSerializer::Deserialize(Reader, JsonObject))
     {
-        if (JsonObject->HasField(TEXT("accessToken")))
-        {
-            AccessToken = JsonObject->GetStringField(TEXT("accessToken"));
-        }
+        return FromJsonObject(JsonObject);
+    }
 
-        if (JsonObject->HasField(TEXT("uri")))
-        {
-            Uri = JsonObject->GetStringField(TEXT("uri"));
-        }
+    return false;
+}
 
-        return true;
+bool FTokenResponseV1::FromJsonObject(const TSharedPtr<FJsonObject>& JsonObject)
+{
+    if (!JsonObject.IsValid())
+    {
+        return false;
     }
 
-    return false;
+    if (JsonObject->HasField(TEXT("accessToken")))
+    {
+        AccessToken = JsonObject->GetStringField(TEXT("accessToken"));
+    }
+
+    if (JsonObject->HasField(TEXT("uri")))
+    {
+        Uri = JsonObject->GetStringField(TEXT("uri"));
+    }
+
+    if (JsonObject->HasField(TEXT("expiresIn")))
+    {
+        ExpiresIn = static_cast<int32>(JsonObject->GetNumberField(TEXT("expiresIn")));
+    }
+
+    return true;
+}
+
+FVivoxTokenProviderStats VivoxTokenProvider::GetStats()
+{
+    return TokenProviderStats;
 }
 
 void VivoxTokenProvider::GetToken(const FTokenRequestV1& TokenRequest, FOnTokenReceived OnTokenReceived)
 {
+    SendTokenRequest(TokenRequest, OnTokenReceived, 0, FPlatformTime::Seconds());
+}
+
+void VivoxTokenProvider::SendTokenRequest(const FTokenRequestV1& TokenRequest, FOnTokenReceived OnTokenReceived, int32 Attempt, double StartTime)
+{
+    if (!TryAcquireCircuit())
+    {
+        UE_LOG(LogVivoxTokenProvider, Warning, TEXT("Token provider circuit breaker is open, not requesting a %s token"), *TokenRequest.Type);
+        ++TokenProviderStats.RejectedByCircuitBreaker;
+        INC_DWORD_STAT(STAT_VivoxTokenRejected);
+        OnTokenReceived.ExecuteIfBound(FString());
+        return;
+    }
+
+    ++TokenProviderStats.Requests;
+    INC_DWORD_STAT(STAT_VivoxTokenRequests);
+
     TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 
     HttpRequest->SetURL(VIVOX_TOKEN_PROVIDER_URL);
     HttpRequest->SetVerb(TEXT("POST"));
     HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 
-    FString AccessToken = AccelByte::FMultiRegistry::GetApiClient()->CredentialsRef->GetAccessToken();
+    FString AccessToken = GetTokenProviderAccessToken();
     if (!AccessToken.IsEmpty())
     {
         HttpRequest->SetHeader(TEXT("Authorization"), "Bearer " + AccessToken);
@@ -144,23 +305,158 @@ void VivoxTokenProvider::GetToken(const FTokenRequestV1& TokenRequest, FOnTokenR
 
     HttpRequest->SetContentAsString(JsonPayload);
 
-    HttpRequest->OnProcessRequestComplete().BindLambda([OnTokenReceived](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+    HttpRequest->OnProcessRequestComplete().BindLambda([TokenRequest, OnTokenReceived, Attempt, StartTime](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
     {
         FString Token;
+        bool bRetryable = true;
 
         if (bWasSuccessful && Response.IsValid())
         {
+            const int32 ResponseCode = Response->GetResponseCode();
+
+            // Other client errors will fail the same way again.
+            bRetryable = ResponseCode == EHttpResponseCodes::TooManyRequests || ResponseCode >= EHttpResponseCodes::ServerError;
+
             FString ResponseContent = Response->GetContentAsString();
 
             FTokenResponseV1 TokenResponse;
 
-            if (TokenResponse.FromJson(ResponseContent))
+            if (EHttpResponseCodes::IsOk(ResponseCode) && TokenResponse.FromJson(ResponseContent) && !TokenResponse.AccessToken.IsEmpty())
             {
-                Token = TokenResponse.AccessToken;
+                // Don't hand out a token that is already about to expire, the caller would be rejected by Vivox.
+                if (TokenResponse.ExpiresIn > 0 && TokenResponse.ExpiresIn < RetryPolicy.MinTokenLifetimeSeconds)
+                {
+                    UE_LOG(LogVivoxTokenProvider, Warning, TEXT("Received a %s token with only %d seconds left"), *TokenRequest.Type, TokenResponse.ExpiresIn);
+                    bRetryable = true;
+                }
+                else
+                {
+                    Token = TokenResponse.AccessToken;
+                }
             }
+            else if (EHttpResponseCodes::IsOk(ResponseCode))
+            {
+                // Malformed body from a healthy looking service, most likely a proxy or a deployment in progress.
+                bRetryable = true;
+            }
+        }
+
+        if (!Token.IsEmpty())
+        {
+            RecordSuccess();
+            OnTokenReceived.ExecuteIfBound(Token);
+            return;
+        }
+
+        const int32 NextAttempt = Attempt + 1;
+        const float Delay = GetRetryDelay(Attempt);
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+        if (!bRetryable || NextAttempt > RetryPolicy.MaxRetries || Elapsed + Delay > RetryPolicy.MaxRetrySeconds)
+        {
+            RecordFailure();
+            UE_LOG(LogVivoxTokenProvider, Warning, TEXT("Failed to get a %s token after %d attempts"), *TokenRequest.Type, NextAttempt);
+            ++TokenProviderStats.Failures;
+            INC_DWORD_STAT(STAT_VivoxTokenFailures);
+            OnTokenReceived.ExecuteIfBound(FString());
+            return;
+        }
+
+        RecordAttemptFailure();
+        UE_LOG(LogVivoxTokenProvider, Verbose, TEXT("Retrying %s token request in %.2f seconds (attempt %d)"), *TokenRequest.Type, Delay, NextAttempt);
+        ++TokenProviderStats.Retries;
+        INC_DWORD_STAT(STAT_VivoxTokenRetries);
+
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([TokenRequest, OnTokenReceived, NextAttempt, StartTime](float)
+        {
+            SendTokenRequest(TokenRequest, OnTokenReceived, NextAttempt, StartTime);
+            return false;
+        }), Delay);
+    });
+
+    HttpRequest->ProcessRequest();
+}
+
+void VivoxTokenProvider::GetTokens(const TArray<FTokenRequestV1>& TokenRequests, FOnTokensReceived OnTokensReceived)
+{
+    // Without a token the batch would only be rejected, let the clients fetch their own tokens right away.
+    const FString AccessToken = GetTokenProviderAccessToken();
+    if (AccessToken.IsEmpty() && IsRunningDedicatedServer())
+    {
+        UE_LOG(LogVivoxTokenProvider, Warning, TEXT("The server is not logged in, not requesting a token batch"));
+        OnTokensReceived.ExecuteIfBound(TArray<FTokenResponseV1>());
+        return;
+    }
+
+    // Batches are not retried, every client falls back to fetching its own tokens instead.
+    if (TokenRequests.Num() == 0 || !TryAcquireCircuit())
+    {
+        OnTokensReceived.ExecuteIfBound(TArray<FTokenResponseV1>());
+        return;
+    }
+
+    ++TokenProviderStats.Requests;
+    INC_DWORD_STAT(STAT_VivoxTokenRequests);
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+
+    HttpRequest->SetURL(VIVOX_TOKEN_BATCH_PROVIDER_URL);
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+
+    if (!AccessToken.IsEmpty())
+    {
+        HttpRequest->SetHeader(TEXT("Authorization"), "Bearer " + AccessToken);
+    }
+
+    FString JsonPayload = TEXT("{\"requests\":[");
+    for (int32 Index = 0; Index < TokenRequests.Num(); ++Index)
+    {
+        if (Index > 0)
+        {
+            JsonPayload += TEXT(",");
+        }
+        JsonPayload += TokenRequests[Index].ToJson();
+    }
+    JsonPayload += TEXT("]}");
+
+    HttpRequest->SetContentAsString(JsonPayload);
+
+    const int32 ExpectedCount = TokenRequests.Num();
+    HttpRequest->OnProcessRequestComplete().BindLambda([OnTokensReceived, ExpectedCount](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+    {
+        TArray<FTokenResponseV1> TokenResponses;
+
+        if (bWasSuccessful && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+        {
+            TSharedPtr<FJsonObject> JsonObject;
+            TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Response->GetContentAsString());
+
+            const TArray<TSharedPtr<FJsonValue>>* JsonResponses = nullptr;
+            if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid()
+                && JsonObject->TryGetArrayField(TEXT("responses"), JsonResponses)
+                && JsonResponses->Num() == ExpectedCount)
+            {
+                TokenResponses.SetNum(ExpectedCount);
+                for (int32 Index = 0; Index < ExpectedCount; ++Index)
+                {
+                    TokenResponses[Index].FromJsonObject((*JsonResponses)[Index]->AsObject());
+                }
+            }
+        }
+
+        if (TokenResponses.Num() > 0)
+        {
+            RecordSuccess();
+        }
+        else
+        {
+            RecordFailure();
+            ++TokenProviderStats.Failures;
+            INC_DWORD_STAT(STAT_VivoxTokenFailures);
         }
 
-        OnTokenReceived.ExecuteIfBound(Token);
+        OnTokensReceived.ExecuteIfBound(TokenResponses);
     });
 
     HttpRequest->ProcessRequest();
@@ -71,6 +71,9 @@ UVivoxGameInstance::UVivoxGameInstance(const FObjectInitializer & ObjectInitiali
     bInitialized = false;
     bLoggedIn = false;
     bLoggingIn = false;
+    // EDIT BEGIN
+    PreIssuedTokenMinRemainingSeconds = 10.0f;
+    // EDIT END
     VivoxVoiceClient = &static_cast<FVivoxCoreModule *>(&FModuleManager::Get().LoadModuleChecked(TEXT("VivoxCore")))->VoiceClient();
 }
 
@@ -374,6 +377,16 @@ void UVivoxGameInstance::OnAccelByteLoginFinished(const FString& PlayerName)
 
 void UVivoxGameInstance::OnLoginTokenReceived(FString Token)
 {
+    if (Token.IsEmpty())
+    {
+        // VivoxTokenProvider already retried, give up until the next Login call.
+        UE_LOG(LogVivoxGameInstance, Error, TEXT("Login failure for %s: no login token"), *LoggedInPlayerName);
+        LoggedInAccountID = AccountId();
+        LoggedInPlayerName = FString();
+        bLoggingIn = false;
+        return;
+    }
+
     ILoginSession& LoginSession = VivoxVoiceClient->GetLoginSession(LoggedInAccountID);
 
     UE_LOG(LogVivoxGameInstance, Verbose, TEXT("Logging in %s with token %s"), *LoggedInPlayerName, *Token);
@@ -440,6 +453,28 @@ void UVivoxGameInstance::Logout()
     bLoggedIn = false;
 }
 
+// EDIT BEGIN
+VivoxCoreError UVivoxGameInstance::JoinVoiceChannels(FString GameMode, FString OnlineSessionId, int32 TeamNum, const TArray<FVivoxPreIssuedToken>& PreIssuedTokens)
+{
+    PreIssuedJoinTokens.Reset();
+
+    const FDateTime Now = FDateTime::UtcNow();
+    for (const FVivoxPreIssuedToken& PreIssuedToken : PreIssuedTokens)
+    {
+        if (PreIssuedToken.AccessToken.IsEmpty())
+        {
+            continue;
+        }
+
+        FVivoxPreIssuedJoinToken& JoinToken = PreIssuedJoinTokens.Add(PreIssuedToken.ChannelId);
+        JoinToken.AccessToken = PreIssuedToken.AccessToken;
+        JoinToken.ExpiresAt = Now + FTimespan::FromSeconds(PreIssuedToken.RemainingSeconds);
+    }
+
+    return JoinVoiceChannels(GameMode, OnlineSessionId, TeamNum);
+}
+// EDIT END
+
 VivoxCoreError UVivoxGameInstance::JoinVoiceChannels(FString GameMode, FString OnlineSessionId, int32 TeamNum)
 {
     Tracer::MajorMethodPrologue("%s %s %d", *GameMode, *OnlineSessionId, TeamNum);
@@ -550,7 +585,17 @@ void UVivoxGameInstance::Join(ChannelType Type, bool ShouldTransmitOnJoin, const
     // BindChannelSessionHandlers(true, ChannelSession);
     //
     // return ChannelSession.BeginConnect(true, false, ShouldTransmitOnJoin, JoinToken, OnBeginConnectCompleteCallback);
-    Channel3DProperties ChannelProperties = Channel3DProperties(8100, 270, 1.0, EAudioFadeModel::InverseByDistance);
+    Channel3DProperties ChannelProperties = GetDefaultChannelProperties();
+
+    FTokenRequestV1 TokenRequest = BuildJoinTokenRequest(LoggedInPlayerName, Type, ChannelName, ChannelProperties);
+
+    FString PreIssuedToken;
+    if (ConsumePreIssuedJoinToken(TokenRequest.ChannelId, PreIssuedToken))
+    {
+        UE_LOG(LogVivoxGameInstance, Verbose, TEXT("Using pre-issued join token for %s"), *ChannelName);
+        OnJoinTokenReceived(PreIssuedToken, Type, ShouldTransmitOnJoin, ChannelName, AssignChanneltoPTTKey, ChannelProperties);
+        return;
+    }
 
     FOnTokenReceived OnTokenReceived;
     OnTokenReceived.BindLambda([this, Type, ShouldTransmitOnJoin, ChannelName, AssignChanneltoPTTKey, ChannelProperties](FString Token)
@@ -558,9 +603,21 @@ void UVivoxGameInstance::Join(ChannelType Type, bool ShouldTransmitOnJoin, const
         OnJoinTokenReceived(Token, Type, ShouldTransmitOnJoin, ChannelName, AssignChanneltoPTTKey, ChannelProperties);
     });
 
+    VivoxTokenProvider::GetToken(TokenRequest, OnTokenReceived);
+    // EDIT END
+}
+
+// EDIT BEGIN
+Channel3DProperties UVivoxGameInstance::GetDefaultChannelProperties()
+{
+    return Channel3DProperties(8100, 270, 1.0, EAudioFadeModel::InverseByDistance);
+}
+
+FTokenRequestV1 UVivoxGameInstance::BuildJoinTokenRequest(const FString& PlayerName, ChannelType Type, const FString& ChannelName, const Channel3DProperties& ChannelProperties)
+{
     FTokenRequestV1 TokenRequest;
     TokenRequest.Type = "join";
-    TokenRequest.Username = LoggedInPlayerName;
+    TokenRequest.Username = PlayerName;
     TokenRequest.ChannelId = ChannelName;
 
     switch (Type)
@@ -568,22 +625,70 @@ void UVivoxGameInstance::Join(ChannelType Type, bool ShouldTransmitOnJoin, const
         case ChannelType::NonPositional:
             TokenRequest.ChannelType = TEXT("nonpositional");
             break;
-	    case ChannelType::Positional:
+        case ChannelType::Positional:
             TokenRequest.ChannelId += "!" + ChannelProperties.ToString();
-	        TokenRequest.ChannelType = TEXT("positional");
-	        break;
+            TokenRequest.ChannelType = TEXT("positional");
+            break;
         case ChannelType::Echo:
             TokenRequest.ChannelType = TEXT("echo");
             break;
     }
 
-    VivoxTokenProvider::GetToken(TokenRequest, OnTokenReceived);
-    // EDIT END
+    return TokenRequest;
+}
+
+void UVivoxGameInstance::BuildJoinTokenRequests(const FString& PlayerName, const FString& GameMode, const FString& OnlineSessionId, int32 TeamNum, TArray<FTokenRequestV1>& OutTokenRequests)
+{
+    // Must mirror the channels joined by JoinVoiceChannels, otherwise clients fall back to fetching their own tokens.
+    const Channel3DProperties ChannelProperties = GetDefaultChannelProperties();
+
+    if (GameMode.Equals(TEXT("FFA")))
+    {
+        OutTokenRequests.Add(BuildJoinTokenRequest(PlayerName, ChannelType::Positional, FString::Printf(TEXT("FP%s"), *OnlineSessionId), ChannelProperties));
+    }
+    else if (GameMode.Equals(TEXT("TDM")))
+    {
+        OutTokenRequests.Add(BuildJoinTokenRequest(PlayerName, ChannelType::Positional, FString::Printf(TEXT("TP%s"), *OnlineSessionId), ChannelProperties));
+        OutTokenRequests.Add(BuildJoinTokenRequest(PlayerName, ChannelType::NonPositional, FString::Printf(TEXT("TN%d_%s"), TeamNum, *OnlineSessionId), ChannelProperties));
+    }
 }
 
+bool UVivoxGameInstance::ConsumePreIssuedJoinToken(const FString& TokenChannelId, FString& OutToken)
+{
+    FVivoxPreIssuedJoinToken PreIssuedToken;
+    if (!PreIssuedJoinTokens.RemoveAndCopyValue(TokenChannelId, PreIssuedToken))
+    {
+        return false;
+    }
+
+    const FTimespan Remaining = PreIssuedToken.ExpiresAt - FDateTime::UtcNow();
+    if (Remaining.GetTotalSeconds() < PreIssuedTokenMinRemainingSeconds)
+    {
+        UE_LOG(LogVivoxGameInstance, Verbose, TEXT("Pre-issued join token for %s is about to expire, fetching a new one"), *TokenChannelId);
+        return false;
+    }
+
+    OutToken = PreIssuedToken.AccessToken;
+    return true;
+}
+// EDIT END
+
 // EDIT BEGIN
 void UVivoxGameInstance::OnJoinTokenReceived(FString Token, ChannelType Type, bool ShouldTransmitOnJoin, const FString& ChannelName, PTTKey AssignChanneltoPTTKey, Channel3DProperties ChannelProperties)
 {
+    if (Token.IsEmpty())
+    {
+        UE_LOG(LogVivoxGameInstance, Error, TEXT("Join failure for %s: no join token"), *ChannelName);
+        return;
+    }
+
+    // The player may have logged out while the token was being fetched.
+    if (!bLoggedIn)
+    {
+        UE_LOG(LogVivoxGameInstance, Warning, TEXT("Not logged in anymore; not joining %s"), *ChannelName);
+        return;
+    }
+
     ILoginSession& LoginSession = VivoxVoiceClient->GetLoginSession(LoggedInAccountID);
     // It's perfectly safe to add 3D properties to any channel type (they don't have any effect if the channel type is not Positional)
     ChannelId Channel = ChannelId(VIVOX_VOICE_ISSUER, ChannelName, VIVOX_VOICE_DOMAIN, Type, ChannelProperties);
@@ -662,6 +767,9 @@ void UVivoxGameInstance::LeaveVoiceChannels()
     ConnectedPositionalChannel = ChannelId();
     PTTAreaChannel.Key = ChannelId();
     PTTTeamChannel.Key = ChannelId();
+    // EDIT BEGIN
+    PreIssuedJoinTokens.Reset();
+    // EDIT END
 }
 
 void UVivoxGameInstance::OnChannelParticipantAdded(const IParticipant &Participant)
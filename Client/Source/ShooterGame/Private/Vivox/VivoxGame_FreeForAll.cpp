@@ -44,5 +44,29 @@ void AVivoxGame_FreeForAll::PostLogin(APlayerController* NewPlayer)
     OnlineSessionId = Session->SessionInfo->GetSessionId().ToString();
 
     // Needs to be called after the parent constructor is called, otherwise the player's team will not have been set yet.
-    VivoxPlayerController->ClientJoinVoice(GameMode, OnlineSessionId);
+    // EDIT BEGIN
+    // VivoxPlayerController->ClientJoinVoice(GameMode, OnlineSessionId);
+    // Voice is joined once the server has fetched tokens for everyone who joined within the batch window.
+    VoiceTokenPreIssuer.AddPlayer(VivoxPlayerController, GameMode, OnlineSessionId);
+    if (!GetWorldTimerManager().IsTimerActive(TimerHandle_FlushVoiceTokens))
+    {
+        GetWorldTimerManager().SetTimer(TimerHandle_FlushVoiceTokens, this, &AVivoxGame_FreeForAll::FlushVoiceTokens, FVivoxTokenPreIssuer::BatchWindowSeconds, false);
+    }
+    // EDIT END
 }
+
+// EDIT BEGIN
+void AVivoxGame_FreeForAll::HandleMatchHasStarted()
+{
+    Super::HandleMatchHasStarted();
+
+    // The roster is final, don't keep anyone waiting for the rest of the batch window.
+    FlushVoiceTokens();
+}
+
+void AVivoxGame_FreeForAll::FlushVoiceTokens()
+{
+    GetWorldTimerManager().ClearTimer(TimerHandle_FlushVoiceTokens);
+    VoiceTokenPreIssuer.Flush();
+}
+// EDIT END
@@ -51,8 +51,32 @@ void AVivoxGame_TeamDeathMatch::PostLogin(APlayerController* NewPlayer)
     TeamNum = ShooterPlayerState->GetTeamNum();
 
     // Needs to be called after the parent constructor is called, otherwise the player's team will not have been set yet.
-    VivoxPlayerController->ClientJoinVoice(GameMode, OnlineSessionId, TeamNum);
+    // EDIT BEGIN
+    // VivoxPlayerController->ClientJoinVoice(GameMode, OnlineSessionId, TeamNum);
+    // Voice is joined once the server has fetched tokens for everyone who joined within the batch window.
+    VoiceTokenPreIssuer.AddPlayer(VivoxPlayerController, GameMode, OnlineSessionId, TeamNum);
+    if (!GetWorldTimerManager().IsTimerActive(TimerHandle_FlushVoiceTokens))
+    {
+        GetWorldTimerManager().SetTimer(TimerHandle_FlushVoiceTokens, this, &AVivoxGame_TeamDeathMatch::FlushVoiceTokens, FVivoxTokenPreIssuer::BatchWindowSeconds, false);
+    }
+    // EDIT END
+}
+
+// EDIT BEGIN
+void AVivoxGame_TeamDeathMatch::HandleMatchHasStarted()
+{
+    Super::HandleMatchHasStarted();
+
+    // The roster is final, don't keep anyone waiting for the rest of the batch window.
+    FlushVoiceTokens();
+}
+
+void AVivoxGame_TeamDeathMatch::FlushVoiceTokens()
+{
+    GetWorldTimerManager().ClearTimer(TimerHandle_FlushVoiceTokens);
+    VoiceTokenPreIssuer.Flush();
 }
+// EDIT END
 
 /**
  * \brief This override prevents the engine's default voice implementation from sending networked voice traffic by omitting a few lines from the original method.
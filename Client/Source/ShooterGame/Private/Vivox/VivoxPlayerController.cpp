@@ -111,7 +111,10 @@ void AVivoxPlayerController::SetupInputComponent()
 #endif
 }
 
-void AVivoxPlayerController::ClientJoinVoice_Implementation(const FString &GameMode, const FString &OnlineSessionId, const int32 &TeamNum)
+// EDIT BEGIN
+// void AVivoxPlayerController::ClientJoinVoice_Implementation(const FString &GameMode, const FString &OnlineSessionId, const int32 &TeamNum)
+void AVivoxPlayerController::ClientJoinVoice_Implementation(const FString &GameMode, const FString &OnlineSessionId, const TArray<FVivoxPreIssuedToken> &PreIssuedTokens, const int32 &TeamNum)
+// EDIT END
 {
     Tracer::MajorMethodPrologue("%s %s %d", *GameMode, *OnlineSessionId, TeamNum);
 
@@ -121,7 +124,10 @@ void AVivoxPlayerController::ClientJoinVoice_Implementation(const FString &GameM
     UVivoxGameInstance *VivoxGameInstance = GetWorld() ? CastChecked<UVivoxGameInstance>(GetWorld()->GetGameInstance()) : NULL;
     CHECKRET(VivoxGameInstance);
 
-    VivoxGameInstance->JoinVoiceChannels(GameMode, OnlineSessionId, TeamNum);
+    // EDIT BEGIN
+    // VivoxGameInstance->JoinVoiceChannels(GameMode, OnlineSessionId, TeamNum);
+    VivoxGameInstance->JoinVoiceChannels(GameMode, OnlineSessionId, TeamNum, PreIssuedTokens);
+    // EDIT END
 }
 
 void AVivoxPlayerController::ClientReturnToMainMenu_Implementation(const FString& ReturnReason)
@@ -0,0 +1,45 @@
+// Copyright (c) 2023-2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Custom/VivoxTokenProvider.h"
+
+class AVivoxPlayerController;
+
+/**
+ * Collects the players of a match on the server and requests the join tokens for all of their voice channels
+ * in a single batch, instead of every client asking the token provider on its own when the match starts.
+ * Players are told to join voice once the batch completes; clients fetch their own tokens for anything missing.
+ */
+class SHOOTERGAME_API FVivoxTokenPreIssuer
+{
+public:
+    /** How long the server waits for more players before sending the batch. */
+    static constexpr float BatchWindowSeconds = 0.5f;
+
+    void AddPlayer(AVivoxPlayerController* PlayerController, const FString& GameMode, const FString& OnlineSessionId, int32 TeamNum = -1);
+
+    /** Requests tokens for every queued player at once. */
+    void Flush();
+
+    bool HasPendingPlayers() const { return PendingPlayers.Num() > 0; }
+
+private:
+    struct FPendingPlayer
+    {
+        TWeakObjectPtr<AVivoxPlayerController> PlayerController;
+        FString GameMode;
+        FString OnlineSessionId;
+        int32 TeamNum = -1;
+        TArray<FTokenRequestV1> TokenRequests;
+    };
+
+    static void RequestTokens(const TArray<FPendingPlayer>& Players, const TArray<FTokenRequestV1>& TokenRequests);
+
+    static void OnTokensReceived(const TArray<FTokenResponseV1>& TokenResponses, const TArray<FPendingPlayer>& Players, double RequestTime);
+
+    TArray<FPendingPlayer> PendingPlayers;
+};
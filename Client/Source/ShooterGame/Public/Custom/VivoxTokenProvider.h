@@ -9,6 +9,7 @@
 #include "VivoxTokenProvider.generated.h"
 
 DECLARE_DELEGATE_OneParam(FOnTokenReceived, FString);
+DECLARE_DELEGATE_OneParam(FOnTokensReceived, const TArray<struct FTokenResponseV1>&);
 
 USTRUCT(BlueprintType)
 struct SHOOTERGAME_API FTokenRequestV1
@@ -46,12 +47,94 @@ struct SHOOTERGAME_API FTokenResponseV1
     UPROPERTY(BlueprintReadWrite, Category = "Vivox | ShooterGame | TokenModels")
     FString Uri;
 
+    /** Token lifetime in seconds as reported by the token provider, 0 if unknown. */
+    UPROPERTY(BlueprintReadWrite, Category = "Vivox | ShooterGame | TokenModels")
+    int32 ExpiresIn = 0;
+
     FString ToJson() const;
 
     bool FromJson(const FString& JsonString);
+
+    bool FromJsonObject(const TSharedPtr<FJsonObject>& JsonObject);
+};
+
+/** A token issued by the game server on behalf of a player, handed to the client together with its remaining lifetime. */
+USTRUCT(BlueprintType)
+struct SHOOTERGAME_API FVivoxPreIssuedToken
+{
+    GENERATED_BODY()
+
+    /** Channel id exactly as sent in the token request (including 3D properties for positional channels). */
+    UPROPERTY(BlueprintReadWrite, Category = "Vivox | ShooterGame | TokenModels")
+    FString ChannelId;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Vivox | ShooterGame | TokenModels")
+    FString AccessToken;
+
+    /** Seconds left before the token expires, measured on the server when the token was handed out. */
+    UPROPERTY(BlueprintReadWrite, Category = "Vivox | ShooterGame | TokenModels")
+    float RemainingSeconds = 0.0f;
+};
+
+enum class EVivoxTokenCircuitState : uint8
+{
+    /** Requests flow normally. */
+    Closed,
+    /** Too many consecutive failures, requests fail immediately until the cooldown elapses. */
+    Open,
+    /** Cooldown elapsed, a single probe request decides whether to close or reopen the circuit. */
+    HalfOpen
+};
+
+struct FVivoxTokenRetryPolicy
+{
+    /** Retries after the first attempt; 0 disables retrying. */
+    int32 MaxRetries = 4;
+
+    float InitialBackoffSeconds = 0.5f;
+
+    float MaxBackoffSeconds = 8.0f;
+
+    /** Upper bound for the whole request including retries, so callers are not kept waiting indefinitely. */
+    float MaxRetrySeconds = 30.0f;
+
+    /** Tokens with less lifetime than this are never returned to the caller, a fresh one is requested instead. */
+    int32 MinTokenLifetimeSeconds = 10;
+
+    /** Consecutive failed requests that open the circuit breaker, each counted once after all of its retries. */
+    int32 CircuitFailureThreshold = 5;
+
+    float CircuitOpenSeconds = 30.0f;
+};
+
+struct FVivoxTokenProviderStats
+{
+    int32 Requests = 0;
+    int32 Retries = 0;
+    int32 Failures = 0;
+    int32 RejectedByCircuitBreaker = 0;
+    EVivoxTokenCircuitState CircuitState = EVivoxTokenCircuitState::Closed;
 };
 
 struct VivoxTokenProvider
 {
+    /**
+     * Requests a single token. Transient failures are retried with jittered exponential backoff according to RetryPolicy.
+     * OnTokenReceived gets an empty string if no usable token could be obtained.
+     */
     static void GetToken(const FTokenRequestV1& TokenRequest, FOnTokenReceived OnTokenReceived);
+
+    /**
+     * Requests tokens for many players in a single call, e.g. from a game server once the match roster is known.
+     * Responses are in request order; failed entries have an empty AccessToken, and the array is empty if the whole call failed.
+     */
+    static void GetTokens(const TArray<FTokenRequestV1>& TokenRequests, FOnTokensReceived OnTokensReceived);
+
+    /** Counters since startup; also available through "stat VivoxTokenProvider". */
+    static FVivoxTokenProviderStats GetStats();
+
+    static FVivoxTokenRetryPolicy RetryPolicy;
+
+private:
+    static void SendTokenRequest(const FTokenRequestV1& TokenRequest, FOnTokenReceived OnTokenReceived, int32 Attempt, double StartTime);
 };
\ No newline at end of file
@@ -17,6 +17,9 @@
 
 #include "VivoxCore.h"
 #include "ShooterGameInstance.h"
+// EDIT BEGIN
+#include "Custom/VivoxTokenProvider.h"
+// EDIT END
 #include "VivoxGameInstance.generated.h"
 
 template<class T>
@@ -59,6 +62,14 @@ enum class PTTKey : uint8
     PTTTeamChannel
 };
 
+// EDIT BEGIN
+struct FVivoxPreIssuedJoinToken
+{
+    FString AccessToken;
+    FDateTime ExpiresAt;
+};
+// EDIT END
+
 UCLASS(config=Game)
 class UVivoxGameInstance : public UShooterGameInstance
 {
@@ -92,6 +103,7 @@ public:
     void Logout();
     VivoxCoreError JoinVoiceChannels(FString GameMode, FString OnlineSessionId, int32 TeamNum = -1);
     // EDIT BEGIN
+    VivoxCoreError JoinVoiceChannels(FString GameMode, FString OnlineSessionId, int32 TeamNum, const TArray<FVivoxPreIssuedToken>& PreIssuedTokens);
     // VivoxCoreError Join(ChannelType ChannelType, bool ShouldTransmitOnJoin, const FString& ChannelName, PTTKey AssignChanneltoPTTKey=PTTKey::PTTNoChannel);
     void Join(ChannelType ChannelType, bool ShouldTransmitOnJoin, const FString& ChannelName, PTTKey AssignChanneltoPTTKey = PTTKey::PTTNoChannel);
     void OnJoinTokenReceived(FString Token, ChannelType Type, bool ShouldTransmitOnJoin, const FString& ChannelName, PTTKey AssignChanneltoPTTKey, Channel3DProperties ChannelProperties);
@@ -118,6 +130,12 @@ public:
     TSharedPtr<IChannelSession> GetChannelSessionForRoster();
     ChannelId GetLastKnownTransmittingChannel() { return LastKnownTransmittingChannel; }
     static FString GetVivoxSafePlayerName(FString BaseName);
+    // EDIT BEGIN
+    /// Token requests for every channel JoinVoiceChannels will join for this player, so a server can fetch them ahead of time.
+    static void BuildJoinTokenRequests(const FString& PlayerName, const FString& GameMode, const FString& OnlineSessionId, int32 TeamNum, TArray<FTokenRequestV1>& OutTokenRequests);
+    static FTokenRequestV1 BuildJoinTokenRequest(const FString& PlayerName, ChannelType Type, const FString& ChannelName, const Channel3DProperties& ChannelProperties);
+    static Channel3DProperties GetDefaultChannelProperties();
+    // EDIT END
 private:
     bool ChangeSoundClassVolume(float Volume, const FSoftObjectPath& SoundClassPath);
 private:
@@ -143,4 +161,15 @@ private:
     /// Privates methods to check and clear dirtiness of cached 3D position
     bool Get3DValuesAreDirty() const;
     void Clear3DValuesAreDirty();
+
+    // EDIT BEGIN
+    /// Join tokens handed out by the game server, keyed by token request channel id. Each token is used at most once.
+    TMap<FString, FVivoxPreIssuedJoinToken> PreIssuedJoinTokens;
+
+    /// Pre-issued tokens with less lifetime left than this are ignored and fetched again by the client.
+    UPROPERTY(config)
+    float PreIssuedTokenMinRemainingSeconds;
+
+    bool ConsumePreIssuedJoinToken(const FString& TokenChannelId, FString& OutToken);
+    // EDIT END
 };
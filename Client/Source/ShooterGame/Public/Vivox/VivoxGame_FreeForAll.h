@@ -16,6 +16,9 @@
 #pragma once
 
 #include "Online/ShooterGame_FreeForAll.h"
+// EDIT BEGIN
+#include "Custom/VivoxTokenPreIssuer.h"
+// EDIT END
 #include "VivoxGame_FreeForAll.generated.h"
 
 UCLASS()
@@ -24,4 +27,15 @@ class AVivoxGame_FreeForAll : public AShooterGame_FreeForAll
     GENERATED_UCLASS_BODY()
 
     void PostLogin(APlayerController* NewPlayer) override;
+
+    // EDIT BEGIN
+    void HandleMatchHasStarted() override;
+
+    /** Requests voice tokens for all players that joined since the last batch. */
+    void FlushVoiceTokens();
+
+    FVivoxTokenPreIssuer VoiceTokenPreIssuer;
+
+    FTimerHandle TimerHandle_FlushVoiceTokens;
+    // EDIT END
 };
@@ -16,6 +16,9 @@
 #pragma once
 
 #include "Online/ShooterGame_TeamDeathMatch.h"
+// EDIT BEGIN
+#include "Custom/VivoxTokenPreIssuer.h"
+// EDIT END
 #include "VivoxGame_TeamDeathMatch.generated.h"
 
 UCLASS()
@@ -25,6 +28,17 @@ class AVivoxGame_TeamDeathMatch : public AShooterGame_TeamDeathMatch
 
     void PostLogin(APlayerController* NewPlayer) override;
 
+    // EDIT BEGIN
+    void HandleMatchHasStarted() override;
+
+    /** Requests voice tokens for all players that joined since the last batch. */
+    void FlushVoiceTokens();
+
+    FVivoxTokenPreIssuer VoiceTokenPreIssuer;
+
+    FTimerHandle TimerHandle_FlushVoiceTokens;
+    // EDIT END
+
     /**
      * Handles all player initialization that is shared between the travel methods
      * (i.e. called from both PostLogin() and HandleSeamlessTravelPlayer())
@@ -18,6 +18,9 @@
 #include "Player/ShooterPlayerController.h"
 #include "UnrealNetwork.h"
 #include "Online.h"
+// EDIT BEGIN
+#include "Custom/VivoxTokenProvider.h"
+// EDIT END
 #include "VivoxPlayerController.generated.h"
 
 #define CHECKRET(cond) if (!(cond)) { UE_LOG(LogTemp, Error, TEXT("CHECKRET(%s) Failed"), TEXT(#cond)); return; }
@@ -41,6 +44,10 @@ public:
     virtual void HandleReturnToMainMenu() override;
     void ClientReturnToMainMenu_Implementation(const FString& ReturnReason);
 
+    // EDIT BEGIN
+    // UFUNCTION(reliable, client)
+    // void ClientJoinVoice(const FString &GameMode, const FString &OnlineSessionId, const int32 &TeamNum = -1);
     UFUNCTION(reliable, client)
-    void ClientJoinVoice(const FString &GameMode, const FString &OnlineSessionId, const int32 &TeamNum = -1);
+    void ClientJoinVoice(const FString &GameMode, const FString &OnlineSessionId, const TArray<FVivoxPreIssuedToken> &PreIssuedTokens, const int32 &TeamNum = -1);
+    // EDIT END
 };
@@ -95,6 +95,7 @@ vivox_signing_key = env.str("VIVOX_SIGNING_KEY")
 vivox_channel_prefix = env.str("VIVOX_CHANNEL_PREFIX", "confctl")
 vivox_domain = env.str("VIVOX_DOMAIN", "tla.vivox.com")
 vivox_token_duration = env.int("VIVOX_TOKEN_DURATION", 90)
+vivox_token_batch_limit = env.int("VIVOX_TOKEN_BATCH_LIMIT", 256)
 
 vivox_channel_types: Dict[str, str] = {
     "echo": "e",
@@ -111,144 +112,180 @@ def vivox_format_user_name(user_id: str) -> str:
     return f"sip:.{vivox_issuer}.{user_id}.@{vivox_domain}"
 
 
-class TokenV1(HTTPEndpoint):
-    async def post(self, request: Request) -> Response:
-        authorization = request.headers.get("Authorization")
-        if not authorization and ab_authorization:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": "missing required Authorization header",
-                },
-                status_code=400,
-            )
+def issue_token(body: Dict) -> Dict:
+    """Issues a single token for a request body, returns either a token response or an error payload."""
+    action = body.get("action", body.get("type", None))
+    user_id = body.get("user_id", body.get("username", None))
 
-        try:
-            body = await request.json()
-        except json.decoder.JSONDecodeError as error:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": str(error),
-                },
-                status_code=400,
-            )
-        
-        logger.debug("received:\n%s", body)
+    if not action:
+        return {
+            "code": 400,
+            "message": "type not found",
+        }
 
-        action = body.get("action", body.get("type", None))
-        user_id = body.get("user_id", body.get("username", None))
+    if action not in ("login", "join", "join_muted", "kick"):
+        return {
+            "code": 400,
+            "message": f"invalid type: {action}",
+        }
 
-        if not action:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": "type not found",
-                },
-                status_code=400,
-            )
+    if not user_id:
+        return {
+            "code": 400,
+            "message": "username not found",
+        }
 
-        if action not in ("login", "join", "join_muted", "kick"):
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": f"invalid type: {action}",
-                },
-                status_code=400,
-            )
+    target_id = body.get("target_id", body.get("targetUsername", None))
+    channel_id = body.get("channel_id", body.get("channelId", None))
+    channel_type = body.get("channel_type", body.get("channelType", None))
 
-        if not user_id:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": "username not found",
-                },
-                status_code=400,
-            )
+    if action in ("kick",) and not target_id:
+        return {
+            "code": 400,
+            "message": "targetUsername not found",
+        }
 
-        target_id = body.get("target_id", body.get("targetUsername", None))
-        channel_id = body.get("channel_id", body.get("channelId", None))
-        channel_type = body.get("channel_type", body.get("channelType", None))
+    if action in ("join", "join_muted", "kick") and not channel_id:
+        return {
+            "code": 400,
+            "message": "channelId not found",
+        }
 
-        if action in ("kick",) and not target_id:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": "targetUsername not found",
-                },
-                status_code=400,
-            )
+    if action in ("join", "join_muted", "kick") and not channel_type:
+        return {
+            "code": 400,
+            "message": "channelType not found",
+        }
 
-        if action in ("join", "join_muted", "kick") and not channel_id:
-            return JSONResponse(
-                content={
-                    "code": 400,
-                    "message": "channelId not found",
-                },
-                status_code=400,
-            )
+    if (
+        action in ("join", "join_muted", "kick")
+        and channel_type not in vivox_channel_types
+    ):
+        return {
+            "code": 400,
+            "message": f"invalid channelType: {channel_type}",
+        }
+
+    channel_type = vivox_channel_types.get(channel_type, "")
+
+    t = vivox_format_channel_name(channel_id=channel_id, channel_type=channel_type)
+
+    generate_token_kwargs = {
+        "key": vivox_signing_key,
+        "iss": vivox_issuer,
+        "exp": get_unix_timestamp() + vivox_token_duration,
+        "vxa": action,
+        "vxi": generate_uid(),
+        "f": vivox_format_user_name(user_id=user_id),
+    }
+
+    if action == "login":
+        token = generate_token(
+            **generate_token_kwargs,
+        )
+        response = {
+            "accessToken": token.decode(encoding=encoding),
+        }
+    elif action in ("join", "join_muted"):
+        token = generate_token(
+            t=t,
+            **generate_token_kwargs,
+        )
+        response = {
+            "accessToken": token.decode(encoding=encoding),
+            "uri": t,
+        }
+    elif action == "kick":
+        token = generate_token(
+            t=t,
+            sub=target_id,
+            **generate_token_kwargs,
+        )
+        response = {
+            "accessToken": token.decode(encoding=encoding),
+            "uri": t,
+        }
+
+    # Relative lifetime, so callers are not affected by clock skew against this server.
+    response["expiresIn"] = vivox_token_duration
+
+    return response
+
+
+async def read_request_body(request: Request):
+    authorization = request.headers.get("Authorization")
+    if not authorization and ab_authorization:
+        return None, JSONResponse(
+            content={
+                "code": 400,
+                "message": "missing required Authorization header",
+            },
+            status_code=400,
+        )
+
+    try:
+        body = await request.json()
+    except json.decoder.JSONDecodeError as error:
+        return None, JSONResponse(
+            content={
+                "code": 400,
+                "message": str(error),
+            },
+            status_code=400,
+        )
 
-        if action in ("join", "join_muted", "kick") and not channel_type:
+    logger.debug("received:\n%s", body)
+
+    return body, None
+
+
+class TokenV1(HTTPEndpoint):
+    async def post(self, request: Request) -> Response:
+        body, error_response = await read_request_body(request)
+        if error_response:
+            return error_response
+
+        response = issue_token(body)
+        if "accessToken" not in response:
+            return JSONResponse(content=response, status_code=400)
+
+        logger.debug("sent:\n%s", response)
+
+        return JSONResponse(response)
+
+
+class TokensV1(HTTPEndpoint):
+    """Issues tokens for many players at once, e.g. for a whole match roster from a game server."""
+
+    async def post(self, request: Request) -> Response:
+        body, error_response = await read_request_body(request)
+        if error_response:
+            return error_response
+
+        requests = body.get("requests", None) if isinstance(body, dict) else None
+        if not isinstance(requests, list):
             return JSONResponse(
                 content={
                     "code": 400,
-                    "message": "channelType not found",
+                    "message": "requests not found",
                 },
                 status_code=400,
             )
 
-        if (
-            action in ("join", "join_muted", "kick")
-            and channel_type not in vivox_channel_types
-        ):
+        if len(requests) > vivox_token_batch_limit:
             return JSONResponse(
                 content={
                     "code": 400,
-                    "message": f"invalid channelType: {channel_type}",
+                    "message": f"too many requests: {len(requests)} > {vivox_token_batch_limit}",
                 },
                 status_code=400,
             )
 
-        channel_type = vivox_channel_types.get(channel_type, "")
-
-        t = vivox_format_channel_name(channel_id=channel_id, channel_type=channel_type)
-
-        generate_token_kwargs = {
-            "key": vivox_signing_key,
-            "iss": vivox_issuer,
-            "exp": get_unix_timestamp() + vivox_token_duration,
-            "vxa": action,
-            "vxi": generate_uid(),
-            "f": vivox_format_user_name(user_id=user_id),
+        # Responses keep the order of the requests; failed entries carry code and message instead of a token.
+        response = {
+            "responses": [issue_token(item if isinstance(item, dict) else {}) for item in requests],
         }
 
-        if action == "login":
-            token = generate_token(
-                **generate_token_kwargs,
-            )
-            response = {
-                "accessToken": token.decode(encoding=encoding),
-            }
-        elif action in ("join", "join_muted"):
-            token = generate_token(
-                t=t,
-                **generate_token_kwargs,
-            )
-            response = {
-                "accessToken": token.decode(encoding=encoding),
-                "uri": t,
-            }
-        elif action == "kick":
-            token = generate_token(
-                t=t,
-                sub=target_id,
-                **generate_token_kwargs,
-            )
-            response = {
-                "accessToken": token.decode(encoding=encoding),
-                "uri": t,
-            }
-
         logger.debug("sent:\n%s", response)
 
         return JSONResponse(response)
@@ -256,6 +293,7 @@ class TokenV1(HTTPEndpoint):
 
 routes: List[Route] = [
     Route("/v1/token", TokenV1),
+    Route("/v1/tokens", TokensV1),
 ] 
 
 
@@ -268,4 +306,5 @@ __all__ = [
     "generate_token",
     "generate_uid",
     "get_unix_timestamp",
+    "issue_token",
 ]